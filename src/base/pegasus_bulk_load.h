@@ -0,0 +1,105 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <dsn/utility/filesystem.h>
+#include <dsn/utility/string_conv.h>
+
+namespace pegasus {
+
+// The directory of bulk load, which is generated by the shell command `generate_sst` and
+// ingested by `ingest_sst`:
+//   <dir>/bulk_load_info              the partition count and data version of the sst files
+//   <dir>/<partition_index>/*.sst     the sorted sst files of each partition, whose key ranges
+//                                     don't overlap, ingested at once
+//
+// The directory should be kept until all the replicas have ingested it. A replica which replays
+// the ingestion after the directory is removed fails, and learns the data from the others.
+struct bulk_load_info
+{
+    int32_t partition_count{0};
+    uint32_t data_version{0};
+
+    static std::string info_file(const std::string &dir)
+    {
+        return dsn::utils::filesystem::path_combine(dir, "bulk_load_info");
+    }
+
+    static std::string partition_dir(const std::string &dir, int32_t partition_index)
+    {
+        return dsn::utils::filesystem::path_combine(dir, std::to_string(partition_index));
+    }
+
+    // the name of the `seq`-th sst file of a partition
+    static std::string sst_file(const std::string &dir, int32_t partition_index, int seq)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%08d.sst", seq);
+        return dsn::utils::filesystem::path_combine(partition_dir(dir, partition_index), name);
+    }
+
+    // returns the paths of the sst files of a partition in the order to be ingested.
+    static bool
+    get_sst_files(const std::string &dir, int32_t partition_index, std::vector<std::string> &files)
+    {
+        files.clear();
+        std::string pdir = partition_dir(dir, partition_index);
+        if (!dsn::utils::filesystem::directory_exists(pdir)) {
+            // no record of this partition
+            return true;
+        }
+        std::vector<std::string> subfiles;
+        if (!dsn::utils::filesystem::get_subfiles(pdir, subfiles, false)) {
+            return false;
+        }
+        for (std::string &f : subfiles) {
+            if (f.size() > 4 && f.compare(f.size() - 4, 4, ".sst") == 0) {
+                files.emplace_back(std::move(f));
+            }
+        }
+        std::sort(files.begin(), files.end());
+        return true;
+    }
+
+    bool save(const std::string &dir) const
+    {
+        std::ofstream out(info_file(dir), std::ios::trunc);
+        out << "partition_count=" << partition_count << std::endl;
+        out << "data_version=" << data_version << std::endl;
+        return out.good();
+    }
+
+    bool load(const std::string &dir)
+    {
+        std::ifstream in(info_file(dir));
+        if (!in.is_open()) {
+            return false;
+        }
+        bool has_count = false, has_version = false;
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t pos = line.find('=');
+            if (pos == std::string::npos) {
+                continue;
+            }
+            std::string key = line.substr(0, pos);
+            std::string value = line.substr(pos + 1);
+            if (key == "partition_count") {
+                has_count = dsn::buf2int32(value, partition_count) && partition_count > 0;
+            } else if (key == "data_version") {
+                int32_t version = 0;
+                has_version = dsn::buf2int32(value, version) && version >= 0;
+                data_version = static_cast<uint32_t>(version);
+            }
+        }
+        return has_count && has_version;
+    }
+};
+
+} // namespace pegasus
@@ -61,6 +61,21 @@ const std::string MANUAL_COMPACT_BOTTOMMOST_LEVEL_COMPACTION_SKIP("skip");
 /// <= 0 means no effect
 const std::string TABLE_LEVEL_DEFAULT_TTL("default_ttl");
 
+/// blind incr mode of a table, for the counters which are mostly written. If "true",
+///   * `incr` is written as a merge operand without reading the old value, and is applied
+///     on the old value when the record is read or compacted.
+///   * `new_value` of the incr response is always 0, and the failure of applying the
+///     increment (the old value is not an integer, or the new value is out of range) is
+///     not returned but the increment is ignored.
+/// default is "false"
+const std::string TABLE_LEVEL_BLIND_INCR("replica.blind_incr");
+
+/// key-value separation of a table. The user data not smaller than this size is separated
+/// into the blob column family, and the record keeps a reference to it, see
+/// pegasus_value_separation.
+/// 0 means no separation, which is the default; otherwise it should be no less than 64
+const std::string TABLE_LEVEL_VALUE_SEPARATION_MIN_SIZE("rocksdb.value_separation.min_size");
+
 const std::string ROCKDB_CHECKPOINT_RESERVE_MIN_COUNT("rocksdb.checkpoint.reserve_min_count");
 const std::string ROCKDB_CHECKPOINT_RESERVE_TIME_SECONDS("rocksdb.checkpoint.reserve_time_seconds");
 
@@ -39,6 +39,10 @@ extern const std::string MANUAL_COMPACT_BOTTOMMOST_LEVEL_COMPACTION_SKIP;
 
 extern const std::string TABLE_LEVEL_DEFAULT_TTL;
 
+extern const std::string TABLE_LEVEL_BLIND_INCR;
+
+extern const std::string TABLE_LEVEL_VALUE_SEPARATION_MIN_SIZE;
+
 extern const std::string ROCKDB_CHECKPOINT_RESERVE_MIN_COUNT;
 extern const std::string ROCKDB_CHECKPOINT_RESERVE_TIME_SECONDS;
 
@@ -106,6 +106,22 @@ pegasus_restore_key(const ::dsn::blob &key, ::dsn::blob &hash_key, ::dsn::blob &
     }
 }
 
+// restore hash_key and sort_key from rocksdb key.
+// no data copied, the output views refer to the memory of 'key'.
+inline void pegasus_restore_key(dsn::string_view key,
+                                dsn::string_view &hash_key,
+                                dsn::string_view &sort_key)
+{
+    dassert(key.length() >= 2, "key length must be no less than 2");
+
+    // hash_key_len is in big endian
+    uint16_t hash_key_len = be16toh(*(int16_t *)(key.data()));
+    dassert(key.length() >= 2 + hash_key_len,
+            "key length must be no less than (2 + hash_key_len)");
+    hash_key = key.substr(2, hash_key_len);
+    sort_key = key.substr(2 + hash_key_len);
+}
+
 // restore hash_key and sort_key from rocksdb key.
 // data is copied into output 'hash_key' and 'sort_key'.
 inline void
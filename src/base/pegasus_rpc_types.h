@@ -15,6 +15,11 @@ using put_rpc = dsn::rpc_holder<dsn::apps::update_request, dsn::apps::update_res
 using multi_remove_rpc =
     dsn::rpc_holder<dsn::apps::multi_remove_request, dsn::apps::multi_remove_response>;
 
+using delete_range_rpc =
+    dsn::rpc_holder<dsn::apps::delete_range_request, dsn::apps::update_response>;
+
+using ingest_rpc = dsn::rpc_holder<dsn::apps::ingest_request, dsn::apps::update_response>;
+
 using remove_rpc = dsn::rpc_holder<dsn::blob, dsn::apps::update_response>;
 
 using incr_rpc = dsn::rpc_holder<dsn::apps::incr_request, dsn::apps::incr_response>;
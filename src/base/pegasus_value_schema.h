@@ -47,28 +47,50 @@ inline uint32_t pegasus_extract_expire_ts(uint32_t version, dsn::string_view val
     return dsn::data_input(value).read_u32();
 }
 
-/// Extracts user value from a raw rocksdb value.
-/// In order to avoid data copy, the ownership of `raw_value` will be transferred
-/// into `user_data`.
-/// \param user_data: the result.
-inline void
-pegasus_extract_user_data(uint32_t version, std::string &&raw_value, ::dsn::blob &user_data)
+/// Extracts user value from a raw rocksdb value without data copy.
+/// \return a view of the user data, which is valid only while `raw_value` is alive.
+inline dsn::string_view pegasus_extract_user_data(uint32_t version, dsn::string_view raw_value)
 {
     dassert_f(version <= PEGASUS_DATA_VERSION_MAX,
               "data version({}) must be <= {}",
               version,
               PEGASUS_DATA_VERSION_MAX);
 
-    auto *s = new std::string(std::move(raw_value));
-    dsn::data_input input(*s);
+    dsn::data_input input(raw_value);
     input.skip(sizeof(uint32_t));
     if (version == 1) {
         input.skip(sizeof(uint64_t));
     }
-    dsn::string_view view = input.read_str();
+    return input.read_str();
+}
+
+/// Extracts user value from a raw rocksdb value.
+/// In order to avoid data copy, the ownership of `raw_value` will be transferred
+/// into `user_data`.
+/// \param user_data: the result.
+inline void
+pegasus_extract_user_data(uint32_t version, std::string &&raw_value, ::dsn::blob &user_data)
+{
+    auto s = std::make_shared<std::string>(std::move(raw_value));
+    dsn::string_view view = pegasus_extract_user_data(version, dsn::string_view(*s));
 
-    // tricky code to avoid memory copy
-    std::shared_ptr<char> buf(const_cast<char *>(view.data()), [s](char *) { delete s; });
+    // share the ownership of `s` by the aliasing constructor, which costs no extra allocation
+    std::shared_ptr<char> buf(s, const_cast<char *>(view.data()));
+    user_data.assign(std::move(buf), 0, static_cast<unsigned int>(view.length()));
+}
+
+/// Extracts user value from a pinned rocksdb value.
+/// The ownership of `raw_value` is shared with `user_data`, so the pinned memory (e.g. a
+/// block in block cache) is released only after `user_data` is destroyed.
+/// \param user_data: the result.
+inline void pegasus_extract_user_data(uint32_t version,
+                                      std::shared_ptr<rocksdb::PinnableSlice> raw_value,
+                                      ::dsn::blob &user_data)
+{
+    dsn::string_view view =
+        pegasus_extract_user_data(version, dsn::string_view(raw_value->data(), raw_value->size()));
+
+    std::shared_ptr<char> buf(std::move(raw_value), const_cast<char *>(view.data()));
     user_data.assign(std::move(buf), 0, static_cast<unsigned int>(view.length()));
 }
 
@@ -197,6 +219,10 @@ public:
     ///    [timestamp in μs (56 bit)] [cluster_id (7 bit)] [deleted_tag (1 bit)]
     ///    [user_data(bytes)]
     ///
+    /// The deleted tag is never set in a stored record, since a deleted record is removed, so
+    /// it is reused to mark the records whose user data is separated, see
+    /// pegasus_value_separation.
+    ///
     /// \internal
     rocksdb::SliceParts
     generate_value_v1(uint32_t expire_ts, uint64_t timetag, dsn::string_view user_data)
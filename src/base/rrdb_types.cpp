@@ -70,6 +70,12 @@ const std::map<int, const char *> _mutate_operation_VALUES_TO_NAMES(
     ::apache::thrift::TEnumIterator(2, _kmutate_operationValues, _kmutate_operationNames),
     ::apache::thrift::TEnumIterator(-1, NULL, NULL));
 
+int _kcount_modeValues[] = {count_mode::CM_EXACT, count_mode::CM_APPROXIMATE};
+const char *_kcount_modeNames[] = {"CM_EXACT", "CM_APPROXIMATE"};
+const std::map<int, const char *> _count_mode_VALUES_TO_NAMES(
+    ::apache::thrift::TEnumIterator(2, _kcount_modeValues, _kcount_modeNames),
+    ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+
 update_request::~update_request() throw() {}
 
 void update_request::__set_key(const ::dsn::blob &val) { this->key = val; }
@@ -744,6 +750,124 @@ void ttl_response::printTo(std::ostream &out) const
     out << ")";
 }
 
+count_request::~count_request() throw() {}
+
+void count_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+
+void count_request::__set_mode(const count_mode::type val) { this->mode = val; }
+
+uint32_t count_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast16;
+                xfer += iprot->readI32(ecast16);
+                this->mode = (count_mode::type)ecast16;
+                this->__isset.mode = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t count_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("count_request");
+
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("mode", ::apache::thrift::protocol::T_I32, 2);
+    xfer += oprot->writeI32((int32_t)this->mode);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(count_request &a, count_request &b)
+{
+    using ::std::swap;
+    swap(a.hash_key, b.hash_key);
+    swap(a.mode, b.mode);
+    swap(a.__isset, b.__isset);
+}
+
+count_request::count_request(const count_request &other17)
+{
+    hash_key = other17.hash_key;
+    mode = other17.mode;
+    __isset = other17.__isset;
+}
+count_request::count_request(count_request &&other18)
+{
+    hash_key = std::move(other18.hash_key);
+    mode = std::move(other18.mode);
+    __isset = std::move(other18.__isset);
+}
+count_request &count_request::operator=(const count_request &other19)
+{
+    hash_key = other19.hash_key;
+    mode = other19.mode;
+    __isset = other19.__isset;
+    return *this;
+}
+count_request &count_request::operator=(count_request &&other20)
+{
+    hash_key = std::move(other20.hash_key);
+    mode = std::move(other20.mode);
+    __isset = std::move(other20.__isset);
+    return *this;
+}
+void count_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "count_request(";
+    out << "hash_key=" << to_string(hash_key);
+    out << ", "
+        << "mode=" << to_string(mode);
+    out << ")";
+}
+
 count_response::~count_response() throw() {}
 
 void count_response::__set_error(const int32_t val) { this->error = val; }
@@ -869,42 +993,42 @@ void swap(count_response &a, count_response &b)
     swap(a.__isset, b.__isset);
 }
 
-count_response::count_response(const count_response &other16)
+count_response::count_response(const count_response &other21)
 {
-    error = other16.error;
-    count = other16.count;
-    app_id = other16.app_id;
-    partition_index = other16.partition_index;
-    server = other16.server;
-    __isset = other16.__isset;
+    error = other21.error;
+    count = other21.count;
+    app_id = other21.app_id;
+    partition_index = other21.partition_index;
+    server = other21.server;
+    __isset = other21.__isset;
 }
-count_response::count_response(count_response &&other17)
+count_response::count_response(count_response &&other22)
 {
-    error = std::move(other17.error);
-    count = std::move(other17.count);
-    app_id = std::move(other17.app_id);
-    partition_index = std::move(other17.partition_index);
-    server = std::move(other17.server);
-    __isset = std::move(other17.__isset);
+    error = std::move(other22.error);
+    count = std::move(other22.count);
+    app_id = std::move(other22.app_id);
+    partition_index = std::move(other22.partition_index);
+    server = std::move(other22.server);
+    __isset = std::move(other22.__isset);
 }
-count_response &count_response::operator=(const count_response &other18)
+count_response &count_response::operator=(const count_response &other23)
 {
-    error = other18.error;
-    count = other18.count;
-    app_id = other18.app_id;
-    partition_index = other18.partition_index;
-    server = other18.server;
-    __isset = other18.__isset;
+    error = other23.error;
+    count = other23.count;
+    app_id = other23.app_id;
+    partition_index = other23.partition_index;
+    server = other23.server;
+    __isset = other23.__isset;
     return *this;
 }
-count_response &count_response::operator=(count_response &&other19)
+count_response &count_response::operator=(count_response &&other24)
 {
-    error = std::move(other19.error);
-    count = std::move(other19.count);
-    app_id = std::move(other19.app_id);
-    partition_index = std::move(other19.partition_index);
-    server = std::move(other19.server);
-    __isset = std::move(other19.__isset);
+    error = std::move(other24.error);
+    count = std::move(other24.count);
+    app_id = std::move(other24.app_id);
+    partition_index = std::move(other24.partition_index);
+    server = std::move(other24.server);
+    __isset = std::move(other24.__isset);
     return *this;
 }
 void count_response::printTo(std::ostream &out) const
@@ -1003,30 +1127,30 @@ void swap(key_value &a, key_value &b)
     swap(a.__isset, b.__isset);
 }
 
-key_value::key_value(const key_value &other20)
+key_value::key_value(const key_value &other25)
 {
-    key = other20.key;
-    value = other20.value;
-    __isset = other20.__isset;
+    key = other25.key;
+    value = other25.value;
+    __isset = other25.__isset;
 }
-key_value::key_value(key_value &&other21)
+key_value::key_value(key_value &&other26)
 {
-    key = std::move(other21.key);
-    value = std::move(other21.value);
-    __isset = std::move(other21.__isset);
+    key = std::move(other26.key);
+    value = std::move(other26.value);
+    __isset = std::move(other26.__isset);
 }
-key_value &key_value::operator=(const key_value &other22)
+key_value &key_value::operator=(const key_value &other27)
 {
-    key = other22.key;
-    value = other22.value;
-    __isset = other22.__isset;
+    key = other27.key;
+    value = other27.value;
+    __isset = other27.__isset;
     return *this;
 }
-key_value &key_value::operator=(key_value &&other23)
+key_value &key_value::operator=(key_value &&other28)
 {
-    key = std::move(other23.key);
-    value = std::move(other23.value);
-    __isset = std::move(other23.__isset);
+    key = std::move(other28.key);
+    value = std::move(other28.value);
+    __isset = std::move(other28.__isset);
     return *this;
 }
 void key_value::printTo(std::ostream &out) const
@@ -1081,13 +1205,13 @@ uint32_t multi_put_request::read(::apache::thrift::protocol::TProtocol *iprot)
             if (ftype == ::apache::thrift::protocol::T_LIST) {
                 {
                     this->kvs.clear();
-                    uint32_t _size24;
-                    ::apache::thrift::protocol::TType _etype27;
-                    xfer += iprot->readListBegin(_etype27, _size24);
-                    this->kvs.resize(_size24);
-                    uint32_t _i28;
-                    for (_i28 = 0; _i28 < _size24; ++_i28) {
-                        xfer += this->kvs[_i28].read(iprot);
+                    uint32_t _size29;
+                    ::apache::thrift::protocol::TType _etype32;
+                    xfer += iprot->readListBegin(_etype32, _size29);
+                    this->kvs.resize(_size29);
+                    uint32_t _i33;
+                    for (_i33 = 0; _i33 < _size29; ++_i33) {
+                        xfer += this->kvs[_i33].read(iprot);
                     }
                     xfer += iprot->readListEnd();
                 }
@@ -1130,9 +1254,9 @@ uint32_t multi_put_request::write(::apache::thrift::protocol::TProtocol *oprot)
     {
         xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                       static_cast<uint32_t>(this->kvs.size()));
-        std::vector<key_value>::const_iterator _iter29;
-        for (_iter29 = this->kvs.begin(); _iter29 != this->kvs.end(); ++_iter29) {
-            xfer += (*_iter29).write(oprot);
+        std::vector<key_value>::const_iterator _iter34;
+        for (_iter34 = this->kvs.begin(); _iter34 != this->kvs.end(); ++_iter34) {
+            xfer += (*_iter34).write(oprot);
         }
         xfer += oprot->writeListEnd();
     }
@@ -1156,34 +1280,34 @@ void swap(multi_put_request &a, multi_put_request &b)
     swap(a.__isset, b.__isset);
 }
 
-multi_put_request::multi_put_request(const multi_put_request &other30)
+multi_put_request::multi_put_request(const multi_put_request &other35)
 {
-    hash_key = other30.hash_key;
-    kvs = other30.kvs;
-    expire_ts_seconds = other30.expire_ts_seconds;
-    __isset = other30.__isset;
+    hash_key = other35.hash_key;
+    kvs = other35.kvs;
+    expire_ts_seconds = other35.expire_ts_seconds;
+    __isset = other35.__isset;
 }
-multi_put_request::multi_put_request(multi_put_request &&other31)
+multi_put_request::multi_put_request(multi_put_request &&other36)
 {
-    hash_key = std::move(other31.hash_key);
-    kvs = std::move(other31.kvs);
-    expire_ts_seconds = std::move(other31.expire_ts_seconds);
-    __isset = std::move(other31.__isset);
+    hash_key = std::move(other36.hash_key);
+    kvs = std::move(other36.kvs);
+    expire_ts_seconds = std::move(other36.expire_ts_seconds);
+    __isset = std::move(other36.__isset);
 }
-multi_put_request &multi_put_request::operator=(const multi_put_request &other32)
+multi_put_request &multi_put_request::operator=(const multi_put_request &other37)
 {
-    hash_key = other32.hash_key;
-    kvs = other32.kvs;
-    expire_ts_seconds = other32.expire_ts_seconds;
-    __isset = other32.__isset;
+    hash_key = other37.hash_key;
+    kvs = other37.kvs;
+    expire_ts_seconds = other37.expire_ts_seconds;
+    __isset = other37.__isset;
     return *this;
 }
-multi_put_request &multi_put_request::operator=(multi_put_request &&other33)
+multi_put_request &multi_put_request::operator=(multi_put_request &&other38)
 {
-    hash_key = std::move(other33.hash_key);
-    kvs = std::move(other33.kvs);
-    expire_ts_seconds = std::move(other33.expire_ts_seconds);
-    __isset = std::move(other33.__isset);
+    hash_key = std::move(other38.hash_key);
+    kvs = std::move(other38.kvs);
+    expire_ts_seconds = std::move(other38.expire_ts_seconds);
+    __isset = std::move(other38.__isset);
     return *this;
 }
 void multi_put_request::printTo(std::ostream &out) const
@@ -1240,13 +1364,13 @@ uint32_t multi_remove_request::read(::apache::thrift::protocol::TProtocol *iprot
             if (ftype == ::apache::thrift::protocol::T_LIST) {
                 {
                     this->sort_keys.clear();
-                    uint32_t _size34;
-                    ::apache::thrift::protocol::TType _etype37;
-                    xfer += iprot->readListBegin(_etype37, _size34);
-                    this->sort_keys.resize(_size34);
-                    uint32_t _i38;
-                    for (_i38 = 0; _i38 < _size34; ++_i38) {
-                        xfer += this->sort_keys[_i38].read(iprot);
+                    uint32_t _size39;
+                    ::apache::thrift::protocol::TType _etype42;
+                    xfer += iprot->readListBegin(_etype42, _size39);
+                    this->sort_keys.resize(_size39);
+                    uint32_t _i43;
+                    for (_i43 = 0; _i43 < _size39; ++_i43) {
+                        xfer += this->sort_keys[_i43].read(iprot);
                     }
                     xfer += iprot->readListEnd();
                 }
@@ -1289,9 +1413,9 @@ uint32_t multi_remove_request::write(::apache::thrift::protocol::TProtocol *opro
     {
         xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                       static_cast<uint32_t>(this->sort_keys.size()));
-        std::vector<::dsn::blob>::const_iterator _iter39;
-        for (_iter39 = this->sort_keys.begin(); _iter39 != this->sort_keys.end(); ++_iter39) {
-            xfer += (*_iter39).write(oprot);
+        std::vector<::dsn::blob>::const_iterator _iter44;
+        for (_iter44 = this->sort_keys.begin(); _iter44 != this->sort_keys.end(); ++_iter44) {
+            xfer += (*_iter44).write(oprot);
         }
         xfer += oprot->writeListEnd();
     }
@@ -1315,34 +1439,34 @@ void swap(multi_remove_request &a, multi_remove_request &b)
     swap(a.__isset, b.__isset);
 }
 
-multi_remove_request::multi_remove_request(const multi_remove_request &other40)
+multi_remove_request::multi_remove_request(const multi_remove_request &other45)
 {
-    hash_key = other40.hash_key;
-    sort_keys = other40.sort_keys;
-    max_count = other40.max_count;
-    __isset = other40.__isset;
+    hash_key = other45.hash_key;
+    sort_keys = other45.sort_keys;
+    max_count = other45.max_count;
+    __isset = other45.__isset;
 }
-multi_remove_request::multi_remove_request(multi_remove_request &&other41)
+multi_remove_request::multi_remove_request(multi_remove_request &&other46)
 {
-    hash_key = std::move(other41.hash_key);
-    sort_keys = std::move(other41.sort_keys);
-    max_count = std::move(other41.max_count);
-    __isset = std::move(other41.__isset);
+    hash_key = std::move(other46.hash_key);
+    sort_keys = std::move(other46.sort_keys);
+    max_count = std::move(other46.max_count);
+    __isset = std::move(other46.__isset);
 }
-multi_remove_request &multi_remove_request::operator=(const multi_remove_request &other42)
+multi_remove_request &multi_remove_request::operator=(const multi_remove_request &other47)
 {
-    hash_key = other42.hash_key;
-    sort_keys = other42.sort_keys;
-    max_count = other42.max_count;
-    __isset = other42.__isset;
+    hash_key = other47.hash_key;
+    sort_keys = other47.sort_keys;
+    max_count = other47.max_count;
+    __isset = other47.__isset;
     return *this;
 }
-multi_remove_request &multi_remove_request::operator=(multi_remove_request &&other43)
+multi_remove_request &multi_remove_request::operator=(multi_remove_request &&other48)
 {
-    hash_key = std::move(other43.hash_key);
-    sort_keys = std::move(other43.sort_keys);
-    max_count = std::move(other43.max_count);
-    __isset = std::move(other43.__isset);
+    hash_key = std::move(other48.hash_key);
+    sort_keys = std::move(other48.sort_keys);
+    max_count = std::move(other48.max_count);
+    __isset = std::move(other48.__isset);
     return *this;
 }
 void multi_remove_request::printTo(std::ostream &out) const
@@ -1500,46 +1624,46 @@ void swap(multi_remove_response &a, multi_remove_response &b)
     swap(a.__isset, b.__isset);
 }
 
-multi_remove_response::multi_remove_response(const multi_remove_response &other44)
+multi_remove_response::multi_remove_response(const multi_remove_response &other49)
 {
-    error = other44.error;
-    count = other44.count;
-    app_id = other44.app_id;
-    partition_index = other44.partition_index;
-    decree = other44.decree;
-    server = other44.server;
-    __isset = other44.__isset;
+    error = other49.error;
+    count = other49.count;
+    app_id = other49.app_id;
+    partition_index = other49.partition_index;
+    decree = other49.decree;
+    server = other49.server;
+    __isset = other49.__isset;
 }
-multi_remove_response::multi_remove_response(multi_remove_response &&other45)
+multi_remove_response::multi_remove_response(multi_remove_response &&other50)
 {
-    error = std::move(other45.error);
-    count = std::move(other45.count);
-    app_id = std::move(other45.app_id);
-    partition_index = std::move(other45.partition_index);
-    decree = std::move(other45.decree);
-    server = std::move(other45.server);
-    __isset = std::move(other45.__isset);
+    error = std::move(other50.error);
+    count = std::move(other50.count);
+    app_id = std::move(other50.app_id);
+    partition_index = std::move(other50.partition_index);
+    decree = std::move(other50.decree);
+    server = std::move(other50.server);
+    __isset = std::move(other50.__isset);
 }
-multi_remove_response &multi_remove_response::operator=(const multi_remove_response &other46)
+multi_remove_response &multi_remove_response::operator=(const multi_remove_response &other51)
 {
-    error = other46.error;
-    count = other46.count;
-    app_id = other46.app_id;
-    partition_index = other46.partition_index;
-    decree = other46.decree;
-    server = other46.server;
-    __isset = other46.__isset;
+    error = other51.error;
+    count = other51.count;
+    app_id = other51.app_id;
+    partition_index = other51.partition_index;
+    decree = other51.decree;
+    server = other51.server;
+    __isset = other51.__isset;
     return *this;
 }
-multi_remove_response &multi_remove_response::operator=(multi_remove_response &&other47)
+multi_remove_response &multi_remove_response::operator=(multi_remove_response &&other52)
 {
-    error = std::move(other47.error);
-    count = std::move(other47.count);
-    app_id = std::move(other47.app_id);
-    partition_index = std::move(other47.partition_index);
-    decree = std::move(other47.decree);
-    server = std::move(other47.server);
-    __isset = std::move(other47.__isset);
+    error = std::move(other52.error);
+    count = std::move(other52.count);
+    app_id = std::move(other52.app_id);
+    partition_index = std::move(other52.partition_index);
+    decree = std::move(other52.decree);
+    server = std::move(other52.server);
+    __isset = std::move(other52.__isset);
     return *this;
 }
 void multi_remove_response::printTo(std::ostream &out) const
@@ -1560,42 +1684,29 @@ void multi_remove_response::printTo(std::ostream &out) const
     out << ")";
 }
 
-multi_get_request::~multi_get_request() throw() {}
+delete_range_request::~delete_range_request() throw() {}
 
-void multi_get_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+void delete_range_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
 
-void multi_get_request::__set_sort_keys(const std::vector<::dsn::blob> &val)
+void delete_range_request::__set_start_sort_key(const ::dsn::blob &val)
 {
-    this->sort_keys = val;
+    this->start_sort_key = val;
 }
 
-void multi_get_request::__set_max_kv_count(const int32_t val) { this->max_kv_count = val; }
-
-void multi_get_request::__set_max_kv_size(const int32_t val) { this->max_kv_size = val; }
-
-void multi_get_request::__set_no_value(const bool val) { this->no_value = val; }
-
-void multi_get_request::__set_start_sortkey(const ::dsn::blob &val) { this->start_sortkey = val; }
-
-void multi_get_request::__set_stop_sortkey(const ::dsn::blob &val) { this->stop_sortkey = val; }
-
-void multi_get_request::__set_start_inclusive(const bool val) { this->start_inclusive = val; }
-
-void multi_get_request::__set_stop_inclusive(const bool val) { this->stop_inclusive = val; }
+void delete_range_request::__set_start_inclusive(const bool val) { this->start_inclusive = val; }
 
-void multi_get_request::__set_sort_key_filter_type(const filter_type::type val)
+void delete_range_request::__set_stop_sort_key(const ::dsn::blob &val)
 {
-    this->sort_key_filter_type = val;
+    this->stop_sort_key = val;
 }
 
-void multi_get_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
-{
-    this->sort_key_filter_pattern = val;
-}
+void delete_range_request::__set_stop_inclusive(const bool val) { this->stop_inclusive = val; }
 
-void multi_get_request::__set_reverse(const bool val) { this->reverse = val; }
+void delete_range_request::__set_clear_partition(const bool val) { this->clear_partition = val; }
 
-uint32_t multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
+void delete_range_request::__set_partition_index(const int32_t val) { this->partition_index = val; }
+
+uint32_t delete_range_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -1623,102 +1734,49 @@ uint32_t multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_LIST) {
-                {
-                    this->sort_keys.clear();
-                    uint32_t _size48;
-                    ::apache::thrift::protocol::TType _etype51;
-                    xfer += iprot->readListBegin(_etype51, _size48);
-                    this->sort_keys.resize(_size48);
-                    uint32_t _i52;
-                    for (_i52 = 0; _i52 < _size48; ++_i52) {
-                        xfer += this->sort_keys[_i52].read(iprot);
-                    }
-                    xfer += iprot->readListEnd();
-                }
-                this->__isset.sort_keys = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->start_sort_key.read(iprot);
+                this->__isset.start_sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->max_kv_count);
-                this->__isset.max_kv_count = true;
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->start_inclusive);
+                this->__isset.start_inclusive = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 4:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->max_kv_size);
-                this->__isset.max_kv_size = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->stop_sort_key.read(iprot);
+                this->__isset.stop_sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 5:
             if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->no_value);
-                this->__isset.no_value = true;
+                xfer += iprot->readBool(this->stop_inclusive);
+                this->__isset.stop_inclusive = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 6:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->start_sortkey.read(iprot);
-                this->__isset.start_sortkey = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 7:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->stop_sortkey.read(iprot);
-                this->__isset.stop_sortkey = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 8:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->start_inclusive);
-                this->__isset.start_inclusive = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 9:
             if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->stop_inclusive);
-                this->__isset.stop_inclusive = true;
+                xfer += iprot->readBool(this->clear_partition);
+                this->__isset.clear_partition = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 10:
+        case 7:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast53;
-                xfer += iprot->readI32(ecast53);
-                this->sort_key_filter_type = (filter_type::type)ecast53;
-                this->__isset.sort_key_filter_type = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 11:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->sort_key_filter_pattern.read(iprot);
-                this->__isset.sort_key_filter_pattern = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 12:
-            if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->reverse);
-                this->__isset.reverse = true;
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -1735,67 +1793,38 @@ uint32_t multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t multi_get_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t delete_range_request::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("multi_get_request");
+    xfer += oprot->writeStructBegin("delete_range_request");
 
     xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->hash_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("sort_keys", ::apache::thrift::protocol::T_LIST, 2);
-    {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
-                                      static_cast<uint32_t>(this->sort_keys.size()));
-        std::vector<::dsn::blob>::const_iterator _iter54;
-        for (_iter54 = this->sort_keys.begin(); _iter54 != this->sort_keys.end(); ++_iter54) {
-            xfer += (*_iter54).write(oprot);
-        }
-        xfer += oprot->writeListEnd();
-    }
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("max_kv_count", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32(this->max_kv_count);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("max_kv_size", ::apache::thrift::protocol::T_I32, 4);
-    xfer += oprot->writeI32(this->max_kv_size);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("no_value", ::apache::thrift::protocol::T_BOOL, 5);
-    xfer += oprot->writeBool(this->no_value);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("start_sortkey", ::apache::thrift::protocol::T_STRUCT, 6);
-    xfer += this->start_sortkey.write(oprot);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("stop_sortkey", ::apache::thrift::protocol::T_STRUCT, 7);
-    xfer += this->stop_sortkey.write(oprot);
+    xfer += oprot->writeFieldBegin("start_sort_key", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->start_sort_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("start_inclusive", ::apache::thrift::protocol::T_BOOL, 8);
+    xfer += oprot->writeFieldBegin("start_inclusive", ::apache::thrift::protocol::T_BOOL, 3);
     xfer += oprot->writeBool(this->start_inclusive);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("stop_inclusive", ::apache::thrift::protocol::T_BOOL, 9);
-    xfer += oprot->writeBool(this->stop_inclusive);
+    xfer += oprot->writeFieldBegin("stop_sort_key", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->stop_sort_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("sort_key_filter_type", ::apache::thrift::protocol::T_I32, 10);
-    xfer += oprot->writeI32((int32_t)this->sort_key_filter_type);
+    xfer += oprot->writeFieldBegin("stop_inclusive", ::apache::thrift::protocol::T_BOOL, 5);
+    xfer += oprot->writeBool(this->stop_inclusive);
     xfer += oprot->writeFieldEnd();
 
-    xfer +=
-        oprot->writeFieldBegin("sort_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 11);
-    xfer += this->sort_key_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldBegin("clear_partition", ::apache::thrift::protocol::T_BOOL, 6);
+    xfer += oprot->writeBool(this->clear_partition);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("reverse", ::apache::thrift::protocol::T_BOOL, 12);
-    xfer += oprot->writeBool(this->reverse);
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 7);
+    xfer += oprot->writeI32(this->partition_index);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -1803,133 +1832,1323 @@ uint32_t multi_get_request::write(::apache::thrift::protocol::TProtocol *oprot)
     return xfer;
 }
 
-void swap(multi_get_request &a, multi_get_request &b)
+void swap(delete_range_request &a, delete_range_request &b)
 {
     using ::std::swap;
     swap(a.hash_key, b.hash_key);
-    swap(a.sort_keys, b.sort_keys);
-    swap(a.max_kv_count, b.max_kv_count);
-    swap(a.max_kv_size, b.max_kv_size);
-    swap(a.no_value, b.no_value);
-    swap(a.start_sortkey, b.start_sortkey);
-    swap(a.stop_sortkey, b.stop_sortkey);
+    swap(a.start_sort_key, b.start_sort_key);
     swap(a.start_inclusive, b.start_inclusive);
+    swap(a.stop_sort_key, b.stop_sort_key);
     swap(a.stop_inclusive, b.stop_inclusive);
-    swap(a.sort_key_filter_type, b.sort_key_filter_type);
-    swap(a.sort_key_filter_pattern, b.sort_key_filter_pattern);
-    swap(a.reverse, b.reverse);
+    swap(a.clear_partition, b.clear_partition);
+    swap(a.partition_index, b.partition_index);
     swap(a.__isset, b.__isset);
 }
 
-multi_get_request::multi_get_request(const multi_get_request &other55)
+delete_range_request::delete_range_request(const delete_range_request &other53)
+{
+    hash_key = other53.hash_key;
+    start_sort_key = other53.start_sort_key;
+    start_inclusive = other53.start_inclusive;
+    stop_sort_key = other53.stop_sort_key;
+    stop_inclusive = other53.stop_inclusive;
+    clear_partition = other53.clear_partition;
+    partition_index = other53.partition_index;
+    __isset = other53.__isset;
+}
+delete_range_request::delete_range_request(delete_range_request &&other54)
+{
+    hash_key = std::move(other54.hash_key);
+    start_sort_key = std::move(other54.start_sort_key);
+    start_inclusive = std::move(other54.start_inclusive);
+    stop_sort_key = std::move(other54.stop_sort_key);
+    stop_inclusive = std::move(other54.stop_inclusive);
+    clear_partition = std::move(other54.clear_partition);
+    partition_index = std::move(other54.partition_index);
+    __isset = std::move(other54.__isset);
+}
+delete_range_request &delete_range_request::operator=(const delete_range_request &other55)
 {
     hash_key = other55.hash_key;
-    sort_keys = other55.sort_keys;
-    max_kv_count = other55.max_kv_count;
-    max_kv_size = other55.max_kv_size;
-    no_value = other55.no_value;
-    start_sortkey = other55.start_sortkey;
-    stop_sortkey = other55.stop_sortkey;
+    start_sort_key = other55.start_sort_key;
     start_inclusive = other55.start_inclusive;
+    stop_sort_key = other55.stop_sort_key;
     stop_inclusive = other55.stop_inclusive;
-    sort_key_filter_type = other55.sort_key_filter_type;
-    sort_key_filter_pattern = other55.sort_key_filter_pattern;
-    reverse = other55.reverse;
+    clear_partition = other55.clear_partition;
+    partition_index = other55.partition_index;
     __isset = other55.__isset;
+    return *this;
 }
-multi_get_request::multi_get_request(multi_get_request &&other56)
+delete_range_request &delete_range_request::operator=(delete_range_request &&other56)
 {
     hash_key = std::move(other56.hash_key);
-    sort_keys = std::move(other56.sort_keys);
-    max_kv_count = std::move(other56.max_kv_count);
-    max_kv_size = std::move(other56.max_kv_size);
-    no_value = std::move(other56.no_value);
-    start_sortkey = std::move(other56.start_sortkey);
-    stop_sortkey = std::move(other56.stop_sortkey);
+    start_sort_key = std::move(other56.start_sort_key);
     start_inclusive = std::move(other56.start_inclusive);
+    stop_sort_key = std::move(other56.stop_sort_key);
     stop_inclusive = std::move(other56.stop_inclusive);
-    sort_key_filter_type = std::move(other56.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other56.sort_key_filter_pattern);
-    reverse = std::move(other56.reverse);
+    clear_partition = std::move(other56.clear_partition);
+    partition_index = std::move(other56.partition_index);
     __isset = std::move(other56.__isset);
-}
-multi_get_request &multi_get_request::operator=(const multi_get_request &other57)
-{
-    hash_key = other57.hash_key;
-    sort_keys = other57.sort_keys;
-    max_kv_count = other57.max_kv_count;
-    max_kv_size = other57.max_kv_size;
-    no_value = other57.no_value;
-    start_sortkey = other57.start_sortkey;
-    stop_sortkey = other57.stop_sortkey;
-    start_inclusive = other57.start_inclusive;
-    stop_inclusive = other57.stop_inclusive;
-    sort_key_filter_type = other57.sort_key_filter_type;
-    sort_key_filter_pattern = other57.sort_key_filter_pattern;
-    reverse = other57.reverse;
-    __isset = other57.__isset;
-    return *this;
-}
-multi_get_request &multi_get_request::operator=(multi_get_request &&other58)
-{
-    hash_key = std::move(other58.hash_key);
-    sort_keys = std::move(other58.sort_keys);
-    max_kv_count = std::move(other58.max_kv_count);
-    max_kv_size = std::move(other58.max_kv_size);
-    no_value = std::move(other58.no_value);
-    start_sortkey = std::move(other58.start_sortkey);
-    stop_sortkey = std::move(other58.stop_sortkey);
-    start_inclusive = std::move(other58.start_inclusive);
-    stop_inclusive = std::move(other58.stop_inclusive);
-    sort_key_filter_type = std::move(other58.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other58.sort_key_filter_pattern);
-    reverse = std::move(other58.reverse);
-    __isset = std::move(other58.__isset);
     return *this;
 }
-void multi_get_request::printTo(std::ostream &out) const
+void delete_range_request::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "multi_get_request(";
+    out << "delete_range_request(";
     out << "hash_key=" << to_string(hash_key);
     out << ", "
-        << "sort_keys=" << to_string(sort_keys);
-    out << ", "
-        << "max_kv_count=" << to_string(max_kv_count);
+        << "start_sort_key=" << to_string(start_sort_key);
     out << ", "
-        << "max_kv_size=" << to_string(max_kv_size);
+        << "start_inclusive=" << to_string(start_inclusive);
     out << ", "
-        << "no_value=" << to_string(no_value);
+        << "stop_sort_key=" << to_string(stop_sort_key);
     out << ", "
-        << "start_sortkey=" << to_string(start_sortkey);
+        << "stop_inclusive=" << to_string(stop_inclusive);
     out << ", "
-        << "stop_sortkey=" << to_string(stop_sortkey);
+        << "clear_partition=" << to_string(clear_partition);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ")";
+}
+
+ingest_request::~ingest_request() throw() {}
+
+void ingest_request::__set_dir(const std::string &val) { this->dir = val; }
+
+void ingest_request::__set_partition_index(const int32_t val) { this->partition_index = val; }
+
+uint32_t ingest_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->dir);
+                this->__isset.dir = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t ingest_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("ingest_request");
+
+    xfer += oprot->writeFieldBegin("dir", ::apache::thrift::protocol::T_STRING, 1);
+    xfer += oprot->writeString(this->dir);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 2);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(ingest_request &a, ingest_request &b)
+{
+    using ::std::swap;
+    swap(a.dir, b.dir);
+    swap(a.partition_index, b.partition_index);
+    swap(a.__isset, b.__isset);
+}
+
+ingest_request::ingest_request(const ingest_request &other57)
+{
+    dir = other57.dir;
+    partition_index = other57.partition_index;
+    __isset = other57.__isset;
+}
+ingest_request::ingest_request(ingest_request &&other58)
+{
+    dir = std::move(other58.dir);
+    partition_index = std::move(other58.partition_index);
+    __isset = std::move(other58.__isset);
+}
+ingest_request &ingest_request::operator=(const ingest_request &other59)
+{
+    dir = other59.dir;
+    partition_index = other59.partition_index;
+    __isset = other59.__isset;
+    return *this;
+}
+ingest_request &ingest_request::operator=(ingest_request &&other60)
+{
+    dir = std::move(other60.dir);
+    partition_index = std::move(other60.partition_index);
+    __isset = std::move(other60.__isset);
+    return *this;
+}
+void ingest_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "ingest_request(";
+    out << "dir=" << to_string(dir);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ")";
+}
+
+multi_get_request::~multi_get_request() throw() {}
+
+void multi_get_request::__set_hash_key(const ::dsn::blob &val) { this->hash_key = val; }
+
+void multi_get_request::__set_sort_keys(const std::vector<::dsn::blob> &val)
+{
+    this->sort_keys = val;
+}
+
+void multi_get_request::__set_max_kv_count(const int32_t val) { this->max_kv_count = val; }
+
+void multi_get_request::__set_max_kv_size(const int32_t val) { this->max_kv_size = val; }
+
+void multi_get_request::__set_no_value(const bool val) { this->no_value = val; }
+
+void multi_get_request::__set_start_sortkey(const ::dsn::blob &val) { this->start_sortkey = val; }
+
+void multi_get_request::__set_stop_sortkey(const ::dsn::blob &val) { this->stop_sortkey = val; }
+
+void multi_get_request::__set_start_inclusive(const bool val) { this->start_inclusive = val; }
+
+void multi_get_request::__set_stop_inclusive(const bool val) { this->stop_inclusive = val; }
+
+void multi_get_request::__set_sort_key_filter_type(const filter_type::type val)
+{
+    this->sort_key_filter_type = val;
+}
+
+void multi_get_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
+{
+    this->sort_key_filter_pattern = val;
+}
+
+void multi_get_request::__set_reverse(const bool val) { this->reverse = val; }
+
+void multi_get_request::__set_value_filter_type(const cas_check_type::type val)
+{
+    this->value_filter_type = val;
+}
+
+void multi_get_request::__set_value_filter_operand(const ::dsn::blob &val)
+{
+    this->value_filter_operand = val;
+}
+
+void multi_get_request::__set_value_offset(const int32_t val) { this->value_offset = val; }
+
+void multi_get_request::__set_value_length(const int32_t val) { this->value_length = val; }
+
+uint32_t multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key.read(iprot);
+                this->__isset.hash_key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->sort_keys.clear();
+                    uint32_t _size61;
+                    ::apache::thrift::protocol::TType _etype64;
+                    xfer += iprot->readListBegin(_etype64, _size61);
+                    this->sort_keys.resize(_size61);
+                    uint32_t _i65;
+                    for (_i65 = 0; _i65 < _size61; ++_i65) {
+                        xfer += this->sort_keys[_i65].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.sort_keys = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->max_kv_count);
+                this->__isset.max_kv_count = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->max_kv_size);
+                this->__isset.max_kv_size = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->no_value);
+                this->__isset.no_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->start_sortkey.read(iprot);
+                this->__isset.start_sortkey = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->stop_sortkey.read(iprot);
+                this->__isset.stop_sortkey = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->start_inclusive);
+                this->__isset.start_inclusive = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 9:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->stop_inclusive);
+                this->__isset.stop_inclusive = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 10:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast66;
+                xfer += iprot->readI32(ecast66);
+                this->sort_key_filter_type = (filter_type::type)ecast66;
+                this->__isset.sort_key_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 11:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key_filter_pattern.read(iprot);
+                this->__isset.sort_key_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 12:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->reverse);
+                this->__isset.reverse = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 13:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast67;
+                xfer += iprot->readI32(ecast67);
+                this->value_filter_type = (cas_check_type::type)ecast67;
+                this->__isset.value_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 14:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value_filter_operand.read(iprot);
+                this->__isset.value_filter_operand = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 15:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->value_offset);
+                this->__isset.value_offset = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 16:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->value_length);
+                this->__isset.value_length = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t multi_get_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("multi_get_request");
+
+    xfer += oprot->writeFieldBegin("hash_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->hash_key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("sort_keys", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->sort_keys.size()));
+        std::vector<::dsn::blob>::const_iterator _iter68;
+        for (_iter68 = this->sort_keys.begin(); _iter68 != this->sort_keys.end(); ++_iter68) {
+            xfer += (*_iter68).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("max_kv_count", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->max_kv_count);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("max_kv_size", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->max_kv_size);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("no_value", ::apache::thrift::protocol::T_BOOL, 5);
+    xfer += oprot->writeBool(this->no_value);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("start_sortkey", ::apache::thrift::protocol::T_STRUCT, 6);
+    xfer += this->start_sortkey.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("stop_sortkey", ::apache::thrift::protocol::T_STRUCT, 7);
+    xfer += this->stop_sortkey.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("start_inclusive", ::apache::thrift::protocol::T_BOOL, 8);
+    xfer += oprot->writeBool(this->start_inclusive);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("stop_inclusive", ::apache::thrift::protocol::T_BOOL, 9);
+    xfer += oprot->writeBool(this->stop_inclusive);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("sort_key_filter_type", ::apache::thrift::protocol::T_I32, 10);
+    xfer += oprot->writeI32((int32_t)this->sort_key_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("sort_key_filter_pattern", ::apache::thrift::protocol::T_STRUCT, 11);
+    xfer += this->sort_key_filter_pattern.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("reverse", ::apache::thrift::protocol::T_BOOL, 12);
+    xfer += oprot->writeBool(this->reverse);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_filter_type", ::apache::thrift::protocol::T_I32, 13);
+    xfer += oprot->writeI32((int32_t)this->value_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("value_filter_operand", ::apache::thrift::protocol::T_STRUCT, 14);
+    xfer += this->value_filter_operand.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_offset", ::apache::thrift::protocol::T_I32, 15);
+    xfer += oprot->writeI32(this->value_offset);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_length", ::apache::thrift::protocol::T_I32, 16);
+    xfer += oprot->writeI32(this->value_length);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(multi_get_request &a, multi_get_request &b)
+{
+    using ::std::swap;
+    swap(a.hash_key, b.hash_key);
+    swap(a.sort_keys, b.sort_keys);
+    swap(a.max_kv_count, b.max_kv_count);
+    swap(a.max_kv_size, b.max_kv_size);
+    swap(a.no_value, b.no_value);
+    swap(a.start_sortkey, b.start_sortkey);
+    swap(a.stop_sortkey, b.stop_sortkey);
+    swap(a.start_inclusive, b.start_inclusive);
+    swap(a.stop_inclusive, b.stop_inclusive);
+    swap(a.sort_key_filter_type, b.sort_key_filter_type);
+    swap(a.sort_key_filter_pattern, b.sort_key_filter_pattern);
+    swap(a.reverse, b.reverse);
+    swap(a.value_filter_type, b.value_filter_type);
+    swap(a.value_filter_operand, b.value_filter_operand);
+    swap(a.value_offset, b.value_offset);
+    swap(a.value_length, b.value_length);
+    swap(a.__isset, b.__isset);
+}
+
+multi_get_request::multi_get_request(const multi_get_request &other69)
+{
+    hash_key = other69.hash_key;
+    sort_keys = other69.sort_keys;
+    max_kv_count = other69.max_kv_count;
+    max_kv_size = other69.max_kv_size;
+    no_value = other69.no_value;
+    start_sortkey = other69.start_sortkey;
+    stop_sortkey = other69.stop_sortkey;
+    start_inclusive = other69.start_inclusive;
+    stop_inclusive = other69.stop_inclusive;
+    sort_key_filter_type = other69.sort_key_filter_type;
+    sort_key_filter_pattern = other69.sort_key_filter_pattern;
+    reverse = other69.reverse;
+    value_filter_type = other69.value_filter_type;
+    value_filter_operand = other69.value_filter_operand;
+    value_offset = other69.value_offset;
+    value_length = other69.value_length;
+    __isset = other69.__isset;
+}
+multi_get_request::multi_get_request(multi_get_request &&other70)
+{
+    hash_key = std::move(other70.hash_key);
+    sort_keys = std::move(other70.sort_keys);
+    max_kv_count = std::move(other70.max_kv_count);
+    max_kv_size = std::move(other70.max_kv_size);
+    no_value = std::move(other70.no_value);
+    start_sortkey = std::move(other70.start_sortkey);
+    stop_sortkey = std::move(other70.stop_sortkey);
+    start_inclusive = std::move(other70.start_inclusive);
+    stop_inclusive = std::move(other70.stop_inclusive);
+    sort_key_filter_type = std::move(other70.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other70.sort_key_filter_pattern);
+    reverse = std::move(other70.reverse);
+    value_filter_type = std::move(other70.value_filter_type);
+    value_filter_operand = std::move(other70.value_filter_operand);
+    value_offset = std::move(other70.value_offset);
+    value_length = std::move(other70.value_length);
+    __isset = std::move(other70.__isset);
+}
+multi_get_request &multi_get_request::operator=(const multi_get_request &other71)
+{
+    hash_key = other71.hash_key;
+    sort_keys = other71.sort_keys;
+    max_kv_count = other71.max_kv_count;
+    max_kv_size = other71.max_kv_size;
+    no_value = other71.no_value;
+    start_sortkey = other71.start_sortkey;
+    stop_sortkey = other71.stop_sortkey;
+    start_inclusive = other71.start_inclusive;
+    stop_inclusive = other71.stop_inclusive;
+    sort_key_filter_type = other71.sort_key_filter_type;
+    sort_key_filter_pattern = other71.sort_key_filter_pattern;
+    reverse = other71.reverse;
+    value_filter_type = other71.value_filter_type;
+    value_filter_operand = other71.value_filter_operand;
+    value_offset = other71.value_offset;
+    value_length = other71.value_length;
+    __isset = other71.__isset;
+    return *this;
+}
+multi_get_request &multi_get_request::operator=(multi_get_request &&other72)
+{
+    hash_key = std::move(other72.hash_key);
+    sort_keys = std::move(other72.sort_keys);
+    max_kv_count = std::move(other72.max_kv_count);
+    max_kv_size = std::move(other72.max_kv_size);
+    no_value = std::move(other72.no_value);
+    start_sortkey = std::move(other72.start_sortkey);
+    stop_sortkey = std::move(other72.stop_sortkey);
+    start_inclusive = std::move(other72.start_inclusive);
+    stop_inclusive = std::move(other72.stop_inclusive);
+    sort_key_filter_type = std::move(other72.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other72.sort_key_filter_pattern);
+    reverse = std::move(other72.reverse);
+    value_filter_type = std::move(other72.value_filter_type);
+    value_filter_operand = std::move(other72.value_filter_operand);
+    value_offset = std::move(other72.value_offset);
+    value_length = std::move(other72.value_length);
+    __isset = std::move(other72.__isset);
+    return *this;
+}
+void multi_get_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "multi_get_request(";
+    out << "hash_key=" << to_string(hash_key);
+    out << ", "
+        << "sort_keys=" << to_string(sort_keys);
+    out << ", "
+        << "max_kv_count=" << to_string(max_kv_count);
+    out << ", "
+        << "max_kv_size=" << to_string(max_kv_size);
+    out << ", "
+        << "no_value=" << to_string(no_value);
+    out << ", "
+        << "start_sortkey=" << to_string(start_sortkey);
+    out << ", "
+        << "stop_sortkey=" << to_string(stop_sortkey);
     out << ", "
         << "start_inclusive=" << to_string(start_inclusive);
     out << ", "
-        << "stop_inclusive=" << to_string(stop_inclusive);
+        << "stop_inclusive=" << to_string(stop_inclusive);
+    out << ", "
+        << "sort_key_filter_type=" << to_string(sort_key_filter_type);
+    out << ", "
+        << "sort_key_filter_pattern=" << to_string(sort_key_filter_pattern);
+    out << ", "
+        << "reverse=" << to_string(reverse);
+    out << ", "
+        << "value_filter_type=" << to_string(value_filter_type);
+    out << ", "
+        << "value_filter_operand=" << to_string(value_filter_operand);
+    out << ", "
+        << "value_offset=" << to_string(value_offset);
+    out << ", "
+        << "value_length=" << to_string(value_length);
+    out << ")";
+}
+
+multi_get_response::~multi_get_response() throw() {}
+
+void multi_get_response::__set_error(const int32_t val) { this->error = val; }
+
+void multi_get_response::__set_kvs(const std::vector<key_value> &val) { this->kvs = val; }
+
+void multi_get_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void multi_get_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+
+void multi_get_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->kvs.clear();
+                    uint32_t _size73;
+                    ::apache::thrift::protocol::TType _etype76;
+                    xfer += iprot->readListBegin(_etype76, _size73);
+                    this->kvs.resize(_size73);
+                    uint32_t _i77;
+                    for (_i77 = 0; _i77 < _size73; ++_i77) {
+                        xfer += this->kvs[_i77].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.kvs = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("multi_get_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("kvs", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->kvs.size()));
+        std::vector<key_value>::const_iterator _iter78;
+        for (_iter78 = this->kvs.begin(); _iter78 != this->kvs.end(); ++_iter78) {
+            xfer += (*_iter78).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(multi_get_response &a, multi_get_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.kvs, b.kvs);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.server, b.server);
+    swap(a.__isset, b.__isset);
+}
+
+multi_get_response::multi_get_response(const multi_get_response &other79)
+{
+    error = other79.error;
+    kvs = other79.kvs;
+    app_id = other79.app_id;
+    partition_index = other79.partition_index;
+    server = other79.server;
+    __isset = other79.__isset;
+}
+multi_get_response::multi_get_response(multi_get_response &&other80)
+{
+    error = std::move(other80.error);
+    kvs = std::move(other80.kvs);
+    app_id = std::move(other80.app_id);
+    partition_index = std::move(other80.partition_index);
+    server = std::move(other80.server);
+    __isset = std::move(other80.__isset);
+}
+multi_get_response &multi_get_response::operator=(const multi_get_response &other81)
+{
+    error = other81.error;
+    kvs = other81.kvs;
+    app_id = other81.app_id;
+    partition_index = other81.partition_index;
+    server = other81.server;
+    __isset = other81.__isset;
+    return *this;
+}
+multi_get_response &multi_get_response::operator=(multi_get_response &&other82)
+{
+    error = std::move(other82.error);
+    kvs = std::move(other82.kvs);
+    app_id = std::move(other82.app_id);
+    partition_index = std::move(other82.partition_index);
+    server = std::move(other82.server);
+    __isset = std::move(other82.__isset);
+    return *this;
+}
+void multi_get_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "multi_get_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "kvs=" << to_string(kvs);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "server=" << to_string(server);
+    out << ")";
+}
+
+batch_multi_get_request::~batch_multi_get_request() throw() {}
+
+void batch_multi_get_request::__set_requests(const std::vector<multi_get_request> &val)
+{
+    this->requests = val;
+}
+
+uint32_t batch_multi_get_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->requests.clear();
+                    uint32_t _size83;
+                    ::apache::thrift::protocol::TType _etype86;
+                    xfer += iprot->readListBegin(_etype86, _size83);
+                    this->requests.resize(_size83);
+                    uint32_t _i87;
+                    for (_i87 = 0; _i87 < _size83; ++_i87) {
+                        xfer += this->requests[_i87].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.requests = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t batch_multi_get_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("batch_multi_get_request");
+
+    xfer += oprot->writeFieldBegin("requests", ::apache::thrift::protocol::T_LIST, 1);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->requests.size()));
+        std::vector<multi_get_request>::const_iterator _iter88;
+        for (_iter88 = this->requests.begin(); _iter88 != this->requests.end(); ++_iter88) {
+            xfer += (*_iter88).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(batch_multi_get_request &a, batch_multi_get_request &b)
+{
+    using ::std::swap;
+    swap(a.requests, b.requests);
+    swap(a.__isset, b.__isset);
+}
+
+batch_multi_get_request::batch_multi_get_request(const batch_multi_get_request &other89)
+{
+    requests = other89.requests;
+    __isset = other89.__isset;
+}
+batch_multi_get_request::batch_multi_get_request(batch_multi_get_request &&other90)
+{
+    requests = std::move(other90.requests);
+    __isset = std::move(other90.__isset);
+}
+batch_multi_get_request &batch_multi_get_request::operator=(const batch_multi_get_request &other91)
+{
+    requests = other91.requests;
+    __isset = other91.__isset;
+    return *this;
+}
+batch_multi_get_request &batch_multi_get_request::operator=(batch_multi_get_request &&other92)
+{
+    requests = std::move(other92.requests);
+    __isset = std::move(other92.__isset);
+    return *this;
+}
+void batch_multi_get_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "batch_multi_get_request(";
+    out << "requests=" << to_string(requests);
+    out << ")";
+}
+
+batch_multi_get_response::~batch_multi_get_response() throw() {}
+
+void batch_multi_get_response::__set_error(const int32_t val) { this->error = val; }
+
+void batch_multi_get_response::__set_responses(const std::vector<multi_get_response> &val)
+{
+    this->responses = val;
+}
+
+void batch_multi_get_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void batch_multi_get_response::__set_partition_index(const int32_t val)
+{
+    this->partition_index = val;
+}
+
+void batch_multi_get_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t batch_multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->responses.clear();
+                    uint32_t _size93;
+                    ::apache::thrift::protocol::TType _etype96;
+                    xfer += iprot->readListBegin(_etype96, _size93);
+                    this->responses.resize(_size93);
+                    uint32_t _i97;
+                    for (_i97 = 0; _i97 < _size93; ++_i97) {
+                        xfer += this->responses[_i97].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.responses = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t batch_multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("batch_multi_get_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("responses", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->responses.size()));
+        std::vector<multi_get_response>::const_iterator _iter98;
+        for (_iter98 = this->responses.begin(); _iter98 != this->responses.end(); ++_iter98) {
+            xfer += (*_iter98).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(batch_multi_get_response &a, batch_multi_get_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.responses, b.responses);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.server, b.server);
+    swap(a.__isset, b.__isset);
+}
+
+batch_multi_get_response::batch_multi_get_response(const batch_multi_get_response &other99)
+{
+    error = other99.error;
+    responses = other99.responses;
+    app_id = other99.app_id;
+    partition_index = other99.partition_index;
+    server = other99.server;
+    __isset = other99.__isset;
+}
+batch_multi_get_response::batch_multi_get_response(batch_multi_get_response &&other100)
+{
+    error = std::move(other100.error);
+    responses = std::move(other100.responses);
+    app_id = std::move(other100.app_id);
+    partition_index = std::move(other100.partition_index);
+    server = std::move(other100.server);
+    __isset = std::move(other100.__isset);
+}
+batch_multi_get_response &batch_multi_get_response::
+operator=(const batch_multi_get_response &other101)
+{
+    error = other101.error;
+    responses = other101.responses;
+    app_id = other101.app_id;
+    partition_index = other101.partition_index;
+    server = other101.server;
+    __isset = other101.__isset;
+    return *this;
+}
+batch_multi_get_response &batch_multi_get_response::operator=(batch_multi_get_response &&other102)
+{
+    error = std::move(other102.error);
+    responses = std::move(other102.responses);
+    app_id = std::move(other102.app_id);
+    partition_index = std::move(other102.partition_index);
+    server = std::move(other102.server);
+    __isset = std::move(other102.__isset);
+    return *this;
+}
+void batch_multi_get_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "batch_multi_get_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "responses=" << to_string(responses);
     out << ", "
-        << "sort_key_filter_type=" << to_string(sort_key_filter_type);
+        << "app_id=" << to_string(app_id);
     out << ", "
-        << "sort_key_filter_pattern=" << to_string(sort_key_filter_pattern);
+        << "partition_index=" << to_string(partition_index);
     out << ", "
-        << "reverse=" << to_string(reverse);
+        << "server=" << to_string(server);
     out << ")";
 }
 
-multi_get_response::~multi_get_response() throw() {}
+incr_request::~incr_request() throw() {}
 
-void multi_get_response::__set_error(const int32_t val) { this->error = val; }
+void incr_request::__set_key(const ::dsn::blob &val) { this->key = val; }
 
-void multi_get_response::__set_kvs(const std::vector<key_value> &val) { this->kvs = val; }
+void incr_request::__set_increment(const int64_t val) { this->increment = val; }
 
-void multi_get_response::__set_app_id(const int32_t val) { this->app_id = val; }
+void incr_request::__set_expire_ts_seconds(const int32_t val) { this->expire_ts_seconds = val; }
 
-void multi_get_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
 
-void multi_get_response::__set_server(const std::string &val) { this->server = val; }
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
 
-uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->key.read(iprot);
+                this->__isset.key = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->increment);
+                this->__isset.increment = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->expire_ts_seconds);
+                this->__isset.expire_ts_seconds = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("incr_request");
+
+    xfer += oprot->writeFieldBegin("key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->key.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("increment", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->increment);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("expire_ts_seconds", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->expire_ts_seconds);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(incr_request &a, incr_request &b)
+{
+    using ::std::swap;
+    swap(a.key, b.key);
+    swap(a.increment, b.increment);
+    swap(a.expire_ts_seconds, b.expire_ts_seconds);
+    swap(a.__isset, b.__isset);
+}
+
+incr_request::incr_request(const incr_request &other103)
+{
+    key = other103.key;
+    increment = other103.increment;
+    expire_ts_seconds = other103.expire_ts_seconds;
+    __isset = other103.__isset;
+}
+incr_request::incr_request(incr_request &&other104)
+{
+    key = std::move(other104.key);
+    increment = std::move(other104.increment);
+    expire_ts_seconds = std::move(other104.expire_ts_seconds);
+    __isset = std::move(other104.__isset);
+}
+incr_request &incr_request::operator=(const incr_request &other105)
+{
+    key = other105.key;
+    increment = other105.increment;
+    expire_ts_seconds = other105.expire_ts_seconds;
+    __isset = other105.__isset;
+    return *this;
+}
+incr_request &incr_request::operator=(incr_request &&other106)
+{
+    key = std::move(other106.key);
+    increment = std::move(other106.increment);
+    expire_ts_seconds = std::move(other106.expire_ts_seconds);
+    __isset = std::move(other106.__isset);
+    return *this;
+}
+void incr_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "incr_request(";
+    out << "key=" << to_string(key);
+    out << ", "
+        << "increment=" << to_string(increment);
+    out << ", "
+        << "expire_ts_seconds=" << to_string(expire_ts_seconds);
+    out << ")";
+}
+
+incr_response::~incr_response() throw() {}
+
+void incr_response::__set_error(const int32_t val) { this->error = val; }
+
+void incr_response::__set_new_value(const int64_t val) { this->new_value = val; }
+
+void incr_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void incr_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+
+void incr_response::__set_decree(const int64_t val) { this->decree = val; }
+
+void incr_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -1957,20 +3176,9 @@ uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_LIST) {
-                {
-                    this->kvs.clear();
-                    uint32_t _size59;
-                    ::apache::thrift::protocol::TType _etype62;
-                    xfer += iprot->readListBegin(_etype62, _size59);
-                    this->kvs.resize(_size59);
-                    uint32_t _i63;
-                    for (_i63 = 0; _i63 < _size59; ++_i63) {
-                        xfer += this->kvs[_i63].read(iprot);
-                    }
-                    xfer += iprot->readListEnd();
-                }
-                this->__isset.kvs = true;
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->new_value);
+                this->__isset.new_value = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -1991,6 +3199,14 @@ uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 5:
+            if (ftype == ::apache::thrift::protocol::T_I64) {
+                xfer += iprot->readI64(this->decree);
+                this->__isset.decree = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         case 6:
             if (ftype == ::apache::thrift::protocol::T_STRING) {
                 xfer += iprot->readString(this->server);
@@ -2011,26 +3227,18 @@ uint32_t multi_get_response::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t incr_response::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("multi_get_response");
+    xfer += oprot->writeStructBegin("incr_response");
 
     xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
     xfer += oprot->writeI32(this->error);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("kvs", ::apache::thrift::protocol::T_LIST, 2);
-    {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
-                                      static_cast<uint32_t>(this->kvs.size()));
-        std::vector<key_value>::const_iterator _iter64;
-        for (_iter64 = this->kvs.begin(); _iter64 != this->kvs.end(); ++_iter64) {
-            xfer += (*_iter64).write(oprot);
-        }
-        xfer += oprot->writeListEnd();
-    }
+    xfer += oprot->writeFieldBegin("new_value", ::apache::thrift::protocol::T_I64, 2);
+    xfer += oprot->writeI64(this->new_value);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
@@ -2041,6 +3249,10 @@ uint32_t multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot)
     xfer += oprot->writeI32(this->partition_index);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 5);
+    xfer += oprot->writeI64(this->decree);
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
     xfer += oprot->writeString(this->server);
     xfer += oprot->writeFieldEnd();
@@ -2050,80 +3262,87 @@ uint32_t multi_get_response::write(::apache::thrift::protocol::TProtocol *oprot)
     return xfer;
 }
 
-void swap(multi_get_response &a, multi_get_response &b)
+void swap(incr_response &a, incr_response &b)
 {
     using ::std::swap;
     swap(a.error, b.error);
-    swap(a.kvs, b.kvs);
+    swap(a.new_value, b.new_value);
     swap(a.app_id, b.app_id);
     swap(a.partition_index, b.partition_index);
+    swap(a.decree, b.decree);
     swap(a.server, b.server);
     swap(a.__isset, b.__isset);
 }
 
-multi_get_response::multi_get_response(const multi_get_response &other65)
+incr_response::incr_response(const incr_response &other107)
 {
-    error = other65.error;
-    kvs = other65.kvs;
-    app_id = other65.app_id;
-    partition_index = other65.partition_index;
-    server = other65.server;
-    __isset = other65.__isset;
+    error = other107.error;
+    new_value = other107.new_value;
+    app_id = other107.app_id;
+    partition_index = other107.partition_index;
+    decree = other107.decree;
+    server = other107.server;
+    __isset = other107.__isset;
 }
-multi_get_response::multi_get_response(multi_get_response &&other66)
+incr_response::incr_response(incr_response &&other108)
 {
-    error = std::move(other66.error);
-    kvs = std::move(other66.kvs);
-    app_id = std::move(other66.app_id);
-    partition_index = std::move(other66.partition_index);
-    server = std::move(other66.server);
-    __isset = std::move(other66.__isset);
+    error = std::move(other108.error);
+    new_value = std::move(other108.new_value);
+    app_id = std::move(other108.app_id);
+    partition_index = std::move(other108.partition_index);
+    decree = std::move(other108.decree);
+    server = std::move(other108.server);
+    __isset = std::move(other108.__isset);
 }
-multi_get_response &multi_get_response::operator=(const multi_get_response &other67)
+incr_response &incr_response::operator=(const incr_response &other109)
 {
-    error = other67.error;
-    kvs = other67.kvs;
-    app_id = other67.app_id;
-    partition_index = other67.partition_index;
-    server = other67.server;
-    __isset = other67.__isset;
+    error = other109.error;
+    new_value = other109.new_value;
+    app_id = other109.app_id;
+    partition_index = other109.partition_index;
+    decree = other109.decree;
+    server = other109.server;
+    __isset = other109.__isset;
     return *this;
 }
-multi_get_response &multi_get_response::operator=(multi_get_response &&other68)
+incr_response &incr_response::operator=(incr_response &&other110)
 {
-    error = std::move(other68.error);
-    kvs = std::move(other68.kvs);
-    app_id = std::move(other68.app_id);
-    partition_index = std::move(other68.partition_index);
-    server = std::move(other68.server);
-    __isset = std::move(other68.__isset);
+    error = std::move(other110.error);
+    new_value = std::move(other110.new_value);
+    app_id = std::move(other110.app_id);
+    partition_index = std::move(other110.partition_index);
+    decree = std::move(other110.decree);
+    server = std::move(other110.server);
+    __isset = std::move(other110.__isset);
     return *this;
 }
-void multi_get_response::printTo(std::ostream &out) const
+void incr_response::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "multi_get_response(";
+    out << "incr_response(";
     out << "error=" << to_string(error);
     out << ", "
-        << "kvs=" << to_string(kvs);
+        << "new_value=" << to_string(new_value);
     out << ", "
         << "app_id=" << to_string(app_id);
     out << ", "
         << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "decree=" << to_string(decree);
     out << ", "
         << "server=" << to_string(server);
     out << ")";
 }
 
-incr_request::~incr_request() throw() {}
+cas_condition::~cas_condition() throw() {}
 
-void incr_request::__set_key(const ::dsn::blob &val) { this->key = val; }
+void cas_condition::__set_check_sort_key(const ::dsn::blob &val) { this->check_sort_key = val; }
 
-void incr_request::__set_increment(const int64_t val) { this->increment = val; }
+void cas_condition::__set_check_type(const cas_check_type::type val) { this->check_type = val; }
 
-void incr_request::__set_expire_ts_seconds(const int32_t val) { this->expire_ts_seconds = val; }
+void cas_condition::__set_check_operand(const ::dsn::blob &val) { this->check_operand = val; }
 
-uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t cas_condition::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -2144,24 +3363,26 @@ uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
         switch (fid) {
         case 1:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->key.read(iprot);
-                this->__isset.key = true;
+                xfer += this->check_sort_key.read(iprot);
+                this->__isset.check_sort_key = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->increment);
-                this->__isset.increment = true;
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast111;
+                xfer += iprot->readI32(ecast111);
+                this->check_type = (cas_check_type::type)ecast111;
+                this->__isset.check_type = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 3:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->expire_ts_seconds);
-                this->__isset.expire_ts_seconds = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->check_operand.read(iprot);
+                this->__isset.check_operand = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -2178,22 +3399,22 @@ uint32_t incr_request::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t cas_condition::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("incr_request");
+    xfer += oprot->writeStructBegin("cas_condition");
 
-    xfer += oprot->writeFieldBegin("key", ::apache::thrift::protocol::T_STRUCT, 1);
-    xfer += this->key.write(oprot);
+    xfer += oprot->writeFieldBegin("check_sort_key", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->check_sort_key.write(oprot);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("increment", ::apache::thrift::protocol::T_I64, 2);
-    xfer += oprot->writeI64(this->increment);
+    xfer += oprot->writeFieldBegin("check_type", ::apache::thrift::protocol::T_I32, 2);
+    xfer += oprot->writeI32((int32_t)this->check_type);
     xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("expire_ts_seconds", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32(this->expire_ts_seconds);
+
+    xfer += oprot->writeFieldBegin("check_operand", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->check_operand.write(oprot);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -2201,72 +3422,64 @@ uint32_t incr_request::write(::apache::thrift::protocol::TProtocol *oprot) const
     return xfer;
 }
 
-void swap(incr_request &a, incr_request &b)
+void swap(cas_condition &a, cas_condition &b)
 {
     using ::std::swap;
-    swap(a.key, b.key);
-    swap(a.increment, b.increment);
-    swap(a.expire_ts_seconds, b.expire_ts_seconds);
+    swap(a.check_sort_key, b.check_sort_key);
+    swap(a.check_type, b.check_type);
+    swap(a.check_operand, b.check_operand);
     swap(a.__isset, b.__isset);
 }
 
-incr_request::incr_request(const incr_request &other69)
+cas_condition::cas_condition(const cas_condition &other112)
 {
-    key = other69.key;
-    increment = other69.increment;
-    expire_ts_seconds = other69.expire_ts_seconds;
-    __isset = other69.__isset;
+    check_sort_key = other112.check_sort_key;
+    check_type = other112.check_type;
+    check_operand = other112.check_operand;
+    __isset = other112.__isset;
 }
-incr_request::incr_request(incr_request &&other70)
+cas_condition::cas_condition(cas_condition &&other113)
 {
-    key = std::move(other70.key);
-    increment = std::move(other70.increment);
-    expire_ts_seconds = std::move(other70.expire_ts_seconds);
-    __isset = std::move(other70.__isset);
+    check_sort_key = std::move(other113.check_sort_key);
+    check_type = std::move(other113.check_type);
+    check_operand = std::move(other113.check_operand);
+    __isset = std::move(other113.__isset);
 }
-incr_request &incr_request::operator=(const incr_request &other71)
+cas_condition &cas_condition::operator=(const cas_condition &other114)
 {
-    key = other71.key;
-    increment = other71.increment;
-    expire_ts_seconds = other71.expire_ts_seconds;
-    __isset = other71.__isset;
+    check_sort_key = other114.check_sort_key;
+    check_type = other114.check_type;
+    check_operand = other114.check_operand;
+    __isset = other114.__isset;
     return *this;
 }
-incr_request &incr_request::operator=(incr_request &&other72)
+cas_condition &cas_condition::operator=(cas_condition &&other115)
 {
-    key = std::move(other72.key);
-    increment = std::move(other72.increment);
-    expire_ts_seconds = std::move(other72.expire_ts_seconds);
-    __isset = std::move(other72.__isset);
+    check_sort_key = std::move(other115.check_sort_key);
+    check_type = std::move(other115.check_type);
+    check_operand = std::move(other115.check_operand);
+    __isset = std::move(other115.__isset);
     return *this;
 }
-void incr_request::printTo(std::ostream &out) const
+void cas_condition::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "incr_request(";
-    out << "key=" << to_string(key);
+    out << "cas_condition(";
+    out << "check_sort_key=" << to_string(check_sort_key);
     out << ", "
-        << "increment=" << to_string(increment);
+        << "check_type=" << to_string(check_type);
     out << ", "
-        << "expire_ts_seconds=" << to_string(expire_ts_seconds);
+        << "check_operand=" << to_string(check_operand);
     out << ")";
 }
 
-incr_response::~incr_response() throw() {}
-
-void incr_response::__set_error(const int32_t val) { this->error = val; }
-
-void incr_response::__set_new_value(const int64_t val) { this->new_value = val; }
-
-void incr_response::__set_app_id(const int32_t val) { this->app_id = val; }
-
-void incr_response::__set_partition_index(const int32_t val) { this->partition_index = val; }
+cas_check_value::~cas_check_value() throw() {}
 
-void incr_response::__set_decree(const int64_t val) { this->decree = val; }
+void cas_check_value::__set_exist(const bool val) { this->exist = val; }
 
-void incr_response::__set_server(const std::string &val) { this->server = val; }
+void cas_check_value::__set_value(const ::dsn::blob &val) { this->value = val; }
 
-uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
+uint32_t cas_check_value::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
     apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
@@ -2286,49 +3499,17 @@ uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
         }
         switch (fid) {
         case 1:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->error);
-                this->__isset.error = true;
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->exist);
+                this->__isset.exist = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
         case 2:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->new_value);
-                this->__isset.new_value = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 3:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->app_id);
-                this->__isset.app_id = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 4:
-            if (ftype == ::apache::thrift::protocol::T_I32) {
-                xfer += iprot->readI32(this->partition_index);
-                this->__isset.partition_index = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 5:
-            if (ftype == ::apache::thrift::protocol::T_I64) {
-                xfer += iprot->readI64(this->decree);
-                this->__isset.decree = true;
-            } else {
-                xfer += iprot->skip(ftype);
-            }
-            break;
-        case 6:
-            if (ftype == ::apache::thrift::protocol::T_STRING) {
-                xfer += iprot->readString(this->server);
-                this->__isset.server = true;
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->value.read(iprot);
+                this->__isset.value = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -2345,34 +3526,18 @@ uint32_t incr_response::read(::apache::thrift::protocol::TProtocol *iprot)
     return xfer;
 }
 
-uint32_t incr_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+uint32_t cas_check_value::write(::apache::thrift::protocol::TProtocol *oprot) const
 {
     uint32_t xfer = 0;
     apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-    xfer += oprot->writeStructBegin("incr_response");
-
-    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
-    xfer += oprot->writeI32(this->error);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("new_value", ::apache::thrift::protocol::T_I64, 2);
-    xfer += oprot->writeI64(this->new_value);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32(this->app_id);
-    xfer += oprot->writeFieldEnd();
-
-    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
-    xfer += oprot->writeI32(this->partition_index);
-    xfer += oprot->writeFieldEnd();
+    xfer += oprot->writeStructBegin("cas_check_value");
 
-    xfer += oprot->writeFieldBegin("decree", ::apache::thrift::protocol::T_I64, 5);
-    xfer += oprot->writeI64(this->decree);
+    xfer += oprot->writeFieldBegin("exist", ::apache::thrift::protocol::T_BOOL, 1);
+    xfer += oprot->writeBool(this->exist);
     xfer += oprot->writeFieldEnd();
 
-    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
-    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldBegin("value", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->value.write(oprot);
     xfer += oprot->writeFieldEnd();
 
     xfer += oprot->writeFieldStop();
@@ -2380,75 +3545,47 @@ uint32_t incr_response::write(::apache::thrift::protocol::TProtocol *oprot) cons
     return xfer;
 }
 
-void swap(incr_response &a, incr_response &b)
+void swap(cas_check_value &a, cas_check_value &b)
 {
     using ::std::swap;
-    swap(a.error, b.error);
-    swap(a.new_value, b.new_value);
-    swap(a.app_id, b.app_id);
-    swap(a.partition_index, b.partition_index);
-    swap(a.decree, b.decree);
-    swap(a.server, b.server);
+    swap(a.exist, b.exist);
+    swap(a.value, b.value);
     swap(a.__isset, b.__isset);
 }
 
-incr_response::incr_response(const incr_response &other73)
+cas_check_value::cas_check_value(const cas_check_value &other116)
 {
-    error = other73.error;
-    new_value = other73.new_value;
-    app_id = other73.app_id;
-    partition_index = other73.partition_index;
-    decree = other73.decree;
-    server = other73.server;
-    __isset = other73.__isset;
+    exist = other116.exist;
+    value = other116.value;
+    __isset = other116.__isset;
 }
-incr_response::incr_response(incr_response &&other74)
+cas_check_value::cas_check_value(cas_check_value &&other117)
 {
-    error = std::move(other74.error);
-    new_value = std::move(other74.new_value);
-    app_id = std::move(other74.app_id);
-    partition_index = std::move(other74.partition_index);
-    decree = std::move(other74.decree);
-    server = std::move(other74.server);
-    __isset = std::move(other74.__isset);
+    exist = std::move(other117.exist);
+    value = std::move(other117.value);
+    __isset = std::move(other117.__isset);
 }
-incr_response &incr_response::operator=(const incr_response &other75)
+cas_check_value &cas_check_value::operator=(const cas_check_value &other118)
 {
-    error = other75.error;
-    new_value = other75.new_value;
-    app_id = other75.app_id;
-    partition_index = other75.partition_index;
-    decree = other75.decree;
-    server = other75.server;
-    __isset = other75.__isset;
+    exist = other118.exist;
+    value = other118.value;
+    __isset = other118.__isset;
     return *this;
 }
-incr_response &incr_response::operator=(incr_response &&other76)
+cas_check_value &cas_check_value::operator=(cas_check_value &&other119)
 {
-    error = std::move(other76.error);
-    new_value = std::move(other76.new_value);
-    app_id = std::move(other76.app_id);
-    partition_index = std::move(other76.partition_index);
-    decree = std::move(other76.decree);
-    server = std::move(other76.server);
-    __isset = std::move(other76.__isset);
+    exist = std::move(other119.exist);
+    value = std::move(other119.value);
+    __isset = std::move(other119.__isset);
     return *this;
 }
-void incr_response::printTo(std::ostream &out) const
+void cas_check_value::printTo(std::ostream &out) const
 {
     using ::apache::thrift::to_string;
-    out << "incr_response(";
-    out << "error=" << to_string(error);
-    out << ", "
-        << "new_value=" << to_string(new_value);
-    out << ", "
-        << "app_id=" << to_string(app_id);
-    out << ", "
-        << "partition_index=" << to_string(partition_index);
-    out << ", "
-        << "decree=" << to_string(decree);
+    out << "cas_check_value(";
+    out << "exist=" << to_string(exist);
     out << ", "
-        << "server=" << to_string(server);
+        << "value=" << to_string(value);
     out << ")";
 }
 
@@ -2490,6 +3627,11 @@ void check_and_set_request::__set_return_check_value(const bool val)
     this->return_check_value = val;
 }
 
+void check_and_set_request::__set_extra_conditions(const std::vector<cas_condition> &val)
+{
+    this->extra_conditions = val;
+}
+
 uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -2527,9 +3669,9 @@ uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *ipro
             break;
         case 3:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast77;
-                xfer += iprot->readI32(ecast77);
-                this->check_type = (cas_check_type::type)ecast77;
+                int32_t ecast120;
+                xfer += iprot->readI32(ecast120);
+                this->check_type = (cas_check_type::type)ecast120;
                 this->__isset.check_type = true;
             } else {
                 xfer += iprot->skip(ftype);
@@ -2583,6 +3725,25 @@ uint32_t check_and_set_request::read(::apache::thrift::protocol::TProtocol *ipro
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 10:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->extra_conditions.clear();
+                    uint32_t _size121;
+                    ::apache::thrift::protocol::TType _etype124;
+                    xfer += iprot->readListBegin(_etype124, _size121);
+                    this->extra_conditions.resize(_size121);
+                    uint32_t _i125;
+                    for (_i125 = 0; _i125 < _size121; ++_i125) {
+                        xfer += this->extra_conditions[_i125].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.extra_conditions = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -2637,6 +3798,19 @@ uint32_t check_and_set_request::write(::apache::thrift::protocol::TProtocol *opr
     xfer += oprot->writeBool(this->return_check_value);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("extra_conditions", ::apache::thrift::protocol::T_LIST, 10);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->extra_conditions.size()));
+        std::vector<cas_condition>::const_iterator _iter126;
+        for (_iter126 = this->extra_conditions.begin(); _iter126 != this->extra_conditions.end();
+             ++_iter126) {
+            xfer += (*_iter126).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -2654,61 +3828,66 @@ void swap(check_and_set_request &a, check_and_set_request &b)
     swap(a.set_value, b.set_value);
     swap(a.set_expire_ts_seconds, b.set_expire_ts_seconds);
     swap(a.return_check_value, b.return_check_value);
+    swap(a.extra_conditions, b.extra_conditions);
     swap(a.__isset, b.__isset);
 }
 
-check_and_set_request::check_and_set_request(const check_and_set_request &other78)
-{
-    hash_key = other78.hash_key;
-    check_sort_key = other78.check_sort_key;
-    check_type = other78.check_type;
-    check_operand = other78.check_operand;
-    set_diff_sort_key = other78.set_diff_sort_key;
-    set_sort_key = other78.set_sort_key;
-    set_value = other78.set_value;
-    set_expire_ts_seconds = other78.set_expire_ts_seconds;
-    return_check_value = other78.return_check_value;
-    __isset = other78.__isset;
-}
-check_and_set_request::check_and_set_request(check_and_set_request &&other79)
-{
-    hash_key = std::move(other79.hash_key);
-    check_sort_key = std::move(other79.check_sort_key);
-    check_type = std::move(other79.check_type);
-    check_operand = std::move(other79.check_operand);
-    set_diff_sort_key = std::move(other79.set_diff_sort_key);
-    set_sort_key = std::move(other79.set_sort_key);
-    set_value = std::move(other79.set_value);
-    set_expire_ts_seconds = std::move(other79.set_expire_ts_seconds);
-    return_check_value = std::move(other79.return_check_value);
-    __isset = std::move(other79.__isset);
-}
-check_and_set_request &check_and_set_request::operator=(const check_and_set_request &other80)
-{
-    hash_key = other80.hash_key;
-    check_sort_key = other80.check_sort_key;
-    check_type = other80.check_type;
-    check_operand = other80.check_operand;
-    set_diff_sort_key = other80.set_diff_sort_key;
-    set_sort_key = other80.set_sort_key;
-    set_value = other80.set_value;
-    set_expire_ts_seconds = other80.set_expire_ts_seconds;
-    return_check_value = other80.return_check_value;
-    __isset = other80.__isset;
+check_and_set_request::check_and_set_request(const check_and_set_request &other127)
+{
+    hash_key = other127.hash_key;
+    check_sort_key = other127.check_sort_key;
+    check_type = other127.check_type;
+    check_operand = other127.check_operand;
+    set_diff_sort_key = other127.set_diff_sort_key;
+    set_sort_key = other127.set_sort_key;
+    set_value = other127.set_value;
+    set_expire_ts_seconds = other127.set_expire_ts_seconds;
+    return_check_value = other127.return_check_value;
+    extra_conditions = other127.extra_conditions;
+    __isset = other127.__isset;
+}
+check_and_set_request::check_and_set_request(check_and_set_request &&other128)
+{
+    hash_key = std::move(other128.hash_key);
+    check_sort_key = std::move(other128.check_sort_key);
+    check_type = std::move(other128.check_type);
+    check_operand = std::move(other128.check_operand);
+    set_diff_sort_key = std::move(other128.set_diff_sort_key);
+    set_sort_key = std::move(other128.set_sort_key);
+    set_value = std::move(other128.set_value);
+    set_expire_ts_seconds = std::move(other128.set_expire_ts_seconds);
+    return_check_value = std::move(other128.return_check_value);
+    extra_conditions = std::move(other128.extra_conditions);
+    __isset = std::move(other128.__isset);
+}
+check_and_set_request &check_and_set_request::operator=(const check_and_set_request &other129)
+{
+    hash_key = other129.hash_key;
+    check_sort_key = other129.check_sort_key;
+    check_type = other129.check_type;
+    check_operand = other129.check_operand;
+    set_diff_sort_key = other129.set_diff_sort_key;
+    set_sort_key = other129.set_sort_key;
+    set_value = other129.set_value;
+    set_expire_ts_seconds = other129.set_expire_ts_seconds;
+    return_check_value = other129.return_check_value;
+    extra_conditions = other129.extra_conditions;
+    __isset = other129.__isset;
     return *this;
 }
-check_and_set_request &check_and_set_request::operator=(check_and_set_request &&other81)
-{
-    hash_key = std::move(other81.hash_key);
-    check_sort_key = std::move(other81.check_sort_key);
-    check_type = std::move(other81.check_type);
-    check_operand = std::move(other81.check_operand);
-    set_diff_sort_key = std::move(other81.set_diff_sort_key);
-    set_sort_key = std::move(other81.set_sort_key);
-    set_value = std::move(other81.set_value);
-    set_expire_ts_seconds = std::move(other81.set_expire_ts_seconds);
-    return_check_value = std::move(other81.return_check_value);
-    __isset = std::move(other81.__isset);
+check_and_set_request &check_and_set_request::operator=(check_and_set_request &&other130)
+{
+    hash_key = std::move(other130.hash_key);
+    check_sort_key = std::move(other130.check_sort_key);
+    check_type = std::move(other130.check_type);
+    check_operand = std::move(other130.check_operand);
+    set_diff_sort_key = std::move(other130.set_diff_sort_key);
+    set_sort_key = std::move(other130.set_sort_key);
+    set_value = std::move(other130.set_value);
+    set_expire_ts_seconds = std::move(other130.set_expire_ts_seconds);
+    return_check_value = std::move(other130.return_check_value);
+    extra_conditions = std::move(other130.extra_conditions);
+    __isset = std::move(other130.__isset);
     return *this;
 }
 void check_and_set_request::printTo(std::ostream &out) const
@@ -2732,6 +3911,8 @@ void check_and_set_request::printTo(std::ostream &out) const
         << "set_expire_ts_seconds=" << to_string(set_expire_ts_seconds);
     out << ", "
         << "return_check_value=" << to_string(return_check_value);
+    out << ", "
+        << "extra_conditions=" << to_string(extra_conditions);
     out << ")";
 }
 
@@ -2762,6 +3943,11 @@ void check_and_set_response::__set_decree(const int64_t val) { this->decree = va
 
 void check_and_set_response::__set_server(const std::string &val) { this->server = val; }
 
+void check_and_set_response::__set_extra_check_values(const std::vector<cas_check_value> &val)
+{
+    this->extra_check_values = val;
+}
+
 uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -2845,6 +4031,25 @@ uint32_t check_and_set_response::read(::apache::thrift::protocol::TProtocol *ipr
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 9:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->extra_check_values.clear();
+                    uint32_t _size131;
+                    ::apache::thrift::protocol::TType _etype134;
+                    xfer += iprot->readListBegin(_etype134, _size131);
+                    this->extra_check_values.resize(_size131);
+                    uint32_t _i135;
+                    for (_i135 = 0; _i135 < _size131; ++_i135) {
+                        xfer += this->extra_check_values[_i135].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.extra_check_values = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -2895,6 +4100,19 @@ uint32_t check_and_set_response::write(::apache::thrift::protocol::TProtocol *op
     xfer += oprot->writeString(this->server);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("extra_check_values", ::apache::thrift::protocol::T_LIST, 9);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->extra_check_values.size()));
+        std::vector<cas_check_value>::const_iterator _iter136;
+        for (_iter136 = this->extra_check_values.begin(); _iter136 != this->extra_check_values.end();
+             ++_iter136) {
+            xfer += (*_iter136).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -2911,57 +4129,62 @@ void swap(check_and_set_response &a, check_and_set_response &b)
     swap(a.partition_index, b.partition_index);
     swap(a.decree, b.decree);
     swap(a.server, b.server);
+    swap(a.extra_check_values, b.extra_check_values);
     swap(a.__isset, b.__isset);
 }
 
-check_and_set_response::check_and_set_response(const check_and_set_response &other82)
-{
-    error = other82.error;
-    check_value_returned = other82.check_value_returned;
-    check_value_exist = other82.check_value_exist;
-    check_value = other82.check_value;
-    app_id = other82.app_id;
-    partition_index = other82.partition_index;
-    decree = other82.decree;
-    server = other82.server;
-    __isset = other82.__isset;
-}
-check_and_set_response::check_and_set_response(check_and_set_response &&other83)
-{
-    error = std::move(other83.error);
-    check_value_returned = std::move(other83.check_value_returned);
-    check_value_exist = std::move(other83.check_value_exist);
-    check_value = std::move(other83.check_value);
-    app_id = std::move(other83.app_id);
-    partition_index = std::move(other83.partition_index);
-    decree = std::move(other83.decree);
-    server = std::move(other83.server);
-    __isset = std::move(other83.__isset);
-}
-check_and_set_response &check_and_set_response::operator=(const check_and_set_response &other84)
-{
-    error = other84.error;
-    check_value_returned = other84.check_value_returned;
-    check_value_exist = other84.check_value_exist;
-    check_value = other84.check_value;
-    app_id = other84.app_id;
-    partition_index = other84.partition_index;
-    decree = other84.decree;
-    server = other84.server;
-    __isset = other84.__isset;
+check_and_set_response::check_and_set_response(const check_and_set_response &other137)
+{
+    error = other137.error;
+    check_value_returned = other137.check_value_returned;
+    check_value_exist = other137.check_value_exist;
+    check_value = other137.check_value;
+    app_id = other137.app_id;
+    partition_index = other137.partition_index;
+    decree = other137.decree;
+    server = other137.server;
+    extra_check_values = other137.extra_check_values;
+    __isset = other137.__isset;
+}
+check_and_set_response::check_and_set_response(check_and_set_response &&other138)
+{
+    error = std::move(other138.error);
+    check_value_returned = std::move(other138.check_value_returned);
+    check_value_exist = std::move(other138.check_value_exist);
+    check_value = std::move(other138.check_value);
+    app_id = std::move(other138.app_id);
+    partition_index = std::move(other138.partition_index);
+    decree = std::move(other138.decree);
+    server = std::move(other138.server);
+    extra_check_values = std::move(other138.extra_check_values);
+    __isset = std::move(other138.__isset);
+}
+check_and_set_response &check_and_set_response::operator=(const check_and_set_response &other139)
+{
+    error = other139.error;
+    check_value_returned = other139.check_value_returned;
+    check_value_exist = other139.check_value_exist;
+    check_value = other139.check_value;
+    app_id = other139.app_id;
+    partition_index = other139.partition_index;
+    decree = other139.decree;
+    server = other139.server;
+    extra_check_values = other139.extra_check_values;
+    __isset = other139.__isset;
     return *this;
 }
-check_and_set_response &check_and_set_response::operator=(check_and_set_response &&other85)
-{
-    error = std::move(other85.error);
-    check_value_returned = std::move(other85.check_value_returned);
-    check_value_exist = std::move(other85.check_value_exist);
-    check_value = std::move(other85.check_value);
-    app_id = std::move(other85.app_id);
-    partition_index = std::move(other85.partition_index);
-    decree = std::move(other85.decree);
-    server = std::move(other85.server);
-    __isset = std::move(other85.__isset);
+check_and_set_response &check_and_set_response::operator=(check_and_set_response &&other140)
+{
+    error = std::move(other140.error);
+    check_value_returned = std::move(other140.check_value_returned);
+    check_value_exist = std::move(other140.check_value_exist);
+    check_value = std::move(other140.check_value);
+    app_id = std::move(other140.app_id);
+    partition_index = std::move(other140.partition_index);
+    decree = std::move(other140.decree);
+    server = std::move(other140.server);
+    extra_check_values = std::move(other140.extra_check_values);
+    __isset = std::move(other140.__isset);
     return *this;
 }
 void check_and_set_response::printTo(std::ostream &out) const
@@ -2983,6 +4206,8 @@ void check_and_set_response::printTo(std::ostream &out) const
         << "decree=" << to_string(decree);
     out << ", "
         << "server=" << to_string(server);
+    out << ", "
+        << "extra_check_values=" << to_string(extra_check_values);
     out << ")";
 }
 
@@ -3017,9 +4242,9 @@ uint32_t mutate::read(::apache::thrift::protocol::TProtocol *iprot)
         switch (fid) {
         case 1:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast86;
-                xfer += iprot->readI32(ecast86);
-                this->operation = (mutate_operation::type)ecast86;
+                int32_t ecast141;
+                xfer += iprot->readI32(ecast141);
+                this->operation = (mutate_operation::type)ecast141;
                 this->__isset.operation = true;
             } else {
                 xfer += iprot->skip(ftype);
@@ -3098,38 +4323,38 @@ void swap(mutate &a, mutate &b)
     swap(a.__isset, b.__isset);
 }
 
-mutate::mutate(const mutate &other87)
+mutate::mutate(const mutate &other142)
 {
-    operation = other87.operation;
-    sort_key = other87.sort_key;
-    value = other87.value;
-    set_expire_ts_seconds = other87.set_expire_ts_seconds;
-    __isset = other87.__isset;
+    operation = other142.operation;
+    sort_key = other142.sort_key;
+    value = other142.value;
+    set_expire_ts_seconds = other142.set_expire_ts_seconds;
+    __isset = other142.__isset;
 }
-mutate::mutate(mutate &&other88)
+mutate::mutate(mutate &&other143)
 {
-    operation = std::move(other88.operation);
-    sort_key = std::move(other88.sort_key);
-    value = std::move(other88.value);
-    set_expire_ts_seconds = std::move(other88.set_expire_ts_seconds);
-    __isset = std::move(other88.__isset);
+    operation = std::move(other143.operation);
+    sort_key = std::move(other143.sort_key);
+    value = std::move(other143.value);
+    set_expire_ts_seconds = std::move(other143.set_expire_ts_seconds);
+    __isset = std::move(other143.__isset);
 }
-mutate &mutate::operator=(const mutate &other89)
+mutate &mutate::operator=(const mutate &other144)
 {
-    operation = other89.operation;
-    sort_key = other89.sort_key;
-    value = other89.value;
-    set_expire_ts_seconds = other89.set_expire_ts_seconds;
-    __isset = other89.__isset;
+    operation = other144.operation;
+    sort_key = other144.sort_key;
+    value = other144.value;
+    set_expire_ts_seconds = other144.set_expire_ts_seconds;
+    __isset = other144.__isset;
     return *this;
 }
-mutate &mutate::operator=(mutate &&other90)
+mutate &mutate::operator=(mutate &&other145)
 {
-    operation = std::move(other90.operation);
-    sort_key = std::move(other90.sort_key);
-    value = std::move(other90.value);
-    set_expire_ts_seconds = std::move(other90.set_expire_ts_seconds);
-    __isset = std::move(other90.__isset);
+    operation = std::move(other145.operation);
+    sort_key = std::move(other145.sort_key);
+    value = std::move(other145.value);
+    set_expire_ts_seconds = std::move(other145.set_expire_ts_seconds);
+    __isset = std::move(other145.__isset);
     return *this;
 }
 void mutate::printTo(std::ostream &out) const
@@ -3175,6 +4400,11 @@ void check_and_mutate_request::__set_return_check_value(const bool val)
     this->return_check_value = val;
 }
 
+void check_and_mutate_request::__set_extra_conditions(const std::vector<cas_condition> &val)
+{
+    this->extra_conditions = val;
+}
+
 uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -3212,9 +4442,9 @@ uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *i
             break;
         case 3:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast91;
-                xfer += iprot->readI32(ecast91);
-                this->check_type = (cas_check_type::type)ecast91;
+                int32_t ecast146;
+                xfer += iprot->readI32(ecast146);
+                this->check_type = (cas_check_type::type)ecast146;
                 this->__isset.check_type = true;
             } else {
                 xfer += iprot->skip(ftype);
@@ -3232,13 +4462,13 @@ uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *i
             if (ftype == ::apache::thrift::protocol::T_LIST) {
                 {
                     this->mutate_list.clear();
-                    uint32_t _size92;
-                    ::apache::thrift::protocol::TType _etype95;
-                    xfer += iprot->readListBegin(_etype95, _size92);
-                    this->mutate_list.resize(_size92);
-                    uint32_t _i96;
-                    for (_i96 = 0; _i96 < _size92; ++_i96) {
-                        xfer += this->mutate_list[_i96].read(iprot);
+                    uint32_t _size147;
+                    ::apache::thrift::protocol::TType _etype150;
+                    xfer += iprot->readListBegin(_etype150, _size147);
+                    this->mutate_list.resize(_size147);
+                    uint32_t _i151;
+                    for (_i151 = 0; _i151 < _size147; ++_i151) {
+                        xfer += this->mutate_list[_i151].read(iprot);
                     }
                     xfer += iprot->readListEnd();
                 }
@@ -3255,6 +4485,25 @@ uint32_t check_and_mutate_request::read(::apache::thrift::protocol::TProtocol *i
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->extra_conditions.clear();
+                    uint32_t _size152;
+                    ::apache::thrift::protocol::TType _etype155;
+                    xfer += iprot->readListBegin(_etype155, _size152);
+                    this->extra_conditions.resize(_size152);
+                    uint32_t _i156;
+                    for (_i156 = 0; _i156 < _size152; ++_i156) {
+                        xfer += this->extra_conditions[_i156].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.extra_conditions = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -3293,9 +4542,10 @@ uint32_t check_and_mutate_request::write(::apache::thrift::protocol::TProtocol *
     {
         xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                       static_cast<uint32_t>(this->mutate_list.size()));
-        std::vector<mutate>::const_iterator _iter97;
-        for (_iter97 = this->mutate_list.begin(); _iter97 != this->mutate_list.end(); ++_iter97) {
-            xfer += (*_iter97).write(oprot);
+        std::vector<mutate>::const_iterator _iter157;
+        for (_iter157 = this->mutate_list.begin(); _iter157 != this->mutate_list.end();
+             ++_iter157) {
+            xfer += (*_iter157).write(oprot);
         }
         xfer += oprot->writeListEnd();
     }
@@ -3305,6 +4555,19 @@ uint32_t check_and_mutate_request::write(::apache::thrift::protocol::TProtocol *
     xfer += oprot->writeBool(this->return_check_value);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("extra_conditions", ::apache::thrift::protocol::T_LIST, 7);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->extra_conditions.size()));
+        std::vector<cas_condition>::const_iterator _iter158;
+        for (_iter158 = this->extra_conditions.begin(); _iter158 != this->extra_conditions.end();
+             ++_iter158) {
+            xfer += (*_iter158).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -3319,50 +4582,55 @@ void swap(check_and_mutate_request &a, check_and_mutate_request &b)
     swap(a.check_operand, b.check_operand);
     swap(a.mutate_list, b.mutate_list);
     swap(a.return_check_value, b.return_check_value);
+    swap(a.extra_conditions, b.extra_conditions);
     swap(a.__isset, b.__isset);
 }
 
-check_and_mutate_request::check_and_mutate_request(const check_and_mutate_request &other98)
+check_and_mutate_request::check_and_mutate_request(const check_and_mutate_request &other159)
 {
-    hash_key = other98.hash_key;
-    check_sort_key = other98.check_sort_key;
-    check_type = other98.check_type;
-    check_operand = other98.check_operand;
-    mutate_list = other98.mutate_list;
-    return_check_value = other98.return_check_value;
-    __isset = other98.__isset;
+    hash_key = other159.hash_key;
+    check_sort_key = other159.check_sort_key;
+    check_type = other159.check_type;
+    check_operand = other159.check_operand;
+    mutate_list = other159.mutate_list;
+    return_check_value = other159.return_check_value;
+    extra_conditions = other159.extra_conditions;
+    __isset = other159.__isset;
 }
-check_and_mutate_request::check_and_mutate_request(check_and_mutate_request &&other99)
+check_and_mutate_request::check_and_mutate_request(check_and_mutate_request &&other160)
 {
-    hash_key = std::move(other99.hash_key);
-    check_sort_key = std::move(other99.check_sort_key);
-    check_type = std::move(other99.check_type);
-    check_operand = std::move(other99.check_operand);
-    mutate_list = std::move(other99.mutate_list);
-    return_check_value = std::move(other99.return_check_value);
-    __isset = std::move(other99.__isset);
+    hash_key = std::move(other160.hash_key);
+    check_sort_key = std::move(other160.check_sort_key);
+    check_type = std::move(other160.check_type);
+    check_operand = std::move(other160.check_operand);
+    mutate_list = std::move(other160.mutate_list);
+    return_check_value = std::move(other160.return_check_value);
+    extra_conditions = std::move(other160.extra_conditions);
+    __isset = std::move(other160.__isset);
 }
 check_and_mutate_request &check_and_mutate_request::
-operator=(const check_and_mutate_request &other100)
-{
-    hash_key = other100.hash_key;
-    check_sort_key = other100.check_sort_key;
-    check_type = other100.check_type;
-    check_operand = other100.check_operand;
-    mutate_list = other100.mutate_list;
-    return_check_value = other100.return_check_value;
-    __isset = other100.__isset;
+operator=(const check_and_mutate_request &other161)
+{
+    hash_key = other161.hash_key;
+    check_sort_key = other161.check_sort_key;
+    check_type = other161.check_type;
+    check_operand = other161.check_operand;
+    mutate_list = other161.mutate_list;
+    return_check_value = other161.return_check_value;
+    extra_conditions = other161.extra_conditions;
+    __isset = other161.__isset;
     return *this;
 }
-check_and_mutate_request &check_and_mutate_request::operator=(check_and_mutate_request &&other101)
+check_and_mutate_request &check_and_mutate_request::operator=(check_and_mutate_request &&other162)
 {
-    hash_key = std::move(other101.hash_key);
-    check_sort_key = std::move(other101.check_sort_key);
-    check_type = std::move(other101.check_type);
-    check_operand = std::move(other101.check_operand);
-    mutate_list = std::move(other101.mutate_list);
-    return_check_value = std::move(other101.return_check_value);
-    __isset = std::move(other101.__isset);
+    hash_key = std::move(other162.hash_key);
+    check_sort_key = std::move(other162.check_sort_key);
+    check_type = std::move(other162.check_type);
+    check_operand = std::move(other162.check_operand);
+    mutate_list = std::move(other162.mutate_list);
+    return_check_value = std::move(other162.return_check_value);
+    extra_conditions = std::move(other162.extra_conditions);
+    __isset = std::move(other162.__isset);
     return *this;
 }
 void check_and_mutate_request::printTo(std::ostream &out) const
@@ -3380,6 +4648,8 @@ void check_and_mutate_request::printTo(std::ostream &out) const
         << "mutate_list=" << to_string(mutate_list);
     out << ", "
         << "return_check_value=" << to_string(return_check_value);
+    out << ", "
+        << "extra_conditions=" << to_string(extra_conditions);
     out << ")";
 }
 
@@ -3413,6 +4683,11 @@ void check_and_mutate_response::__set_decree(const int64_t val) { this->decree =
 
 void check_and_mutate_response::__set_server(const std::string &val) { this->server = val; }
 
+void check_and_mutate_response::__set_extra_check_values(const std::vector<cas_check_value> &val)
+{
+    this->extra_check_values = val;
+}
+
 uint32_t check_and_mutate_response::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -3496,6 +4771,25 @@ uint32_t check_and_mutate_response::read(::apache::thrift::protocol::TProtocol *
                 xfer += iprot->skip(ftype);
             }
             break;
+        case 9:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->extra_check_values.clear();
+                    uint32_t _size163;
+                    ::apache::thrift::protocol::TType _etype166;
+                    xfer += iprot->readListBegin(_etype166, _size163);
+                    this->extra_check_values.resize(_size163);
+                    uint32_t _i167;
+                    for (_i167 = 0; _i167 < _size163; ++_i167) {
+                        xfer += this->extra_check_values[_i167].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.extra_check_values = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
         default:
             xfer += iprot->skip(ftype);
             break;
@@ -3546,6 +4840,19 @@ uint32_t check_and_mutate_response::write(::apache::thrift::protocol::TProtocol
     xfer += oprot->writeString(this->server);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("extra_check_values", ::apache::thrift::protocol::T_LIST, 9);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->extra_check_values.size()));
+        std::vector<cas_check_value>::const_iterator _iter168;
+        for (_iter168 = this->extra_check_values.begin(); _iter168 != this->extra_check_values.end();
+             ++_iter168) {
+            xfer += (*_iter168).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -3562,59 +4869,64 @@ void swap(check_and_mutate_response &a, check_and_mutate_response &b)
     swap(a.partition_index, b.partition_index);
     swap(a.decree, b.decree);
     swap(a.server, b.server);
+    swap(a.extra_check_values, b.extra_check_values);
     swap(a.__isset, b.__isset);
 }
 
-check_and_mutate_response::check_and_mutate_response(const check_and_mutate_response &other102)
-{
-    error = other102.error;
-    check_value_returned = other102.check_value_returned;
-    check_value_exist = other102.check_value_exist;
-    check_value = other102.check_value;
-    app_id = other102.app_id;
-    partition_index = other102.partition_index;
-    decree = other102.decree;
-    server = other102.server;
-    __isset = other102.__isset;
-}
-check_and_mutate_response::check_and_mutate_response(check_and_mutate_response &&other103)
-{
-    error = std::move(other103.error);
-    check_value_returned = std::move(other103.check_value_returned);
-    check_value_exist = std::move(other103.check_value_exist);
-    check_value = std::move(other103.check_value);
-    app_id = std::move(other103.app_id);
-    partition_index = std::move(other103.partition_index);
-    decree = std::move(other103.decree);
-    server = std::move(other103.server);
-    __isset = std::move(other103.__isset);
+check_and_mutate_response::check_and_mutate_response(const check_and_mutate_response &other169)
+{
+    error = other169.error;
+    check_value_returned = other169.check_value_returned;
+    check_value_exist = other169.check_value_exist;
+    check_value = other169.check_value;
+    app_id = other169.app_id;
+    partition_index = other169.partition_index;
+    decree = other169.decree;
+    server = other169.server;
+    extra_check_values = other169.extra_check_values;
+    __isset = other169.__isset;
+}
+check_and_mutate_response::check_and_mutate_response(check_and_mutate_response &&other170)
+{
+    error = std::move(other170.error);
+    check_value_returned = std::move(other170.check_value_returned);
+    check_value_exist = std::move(other170.check_value_exist);
+    check_value = std::move(other170.check_value);
+    app_id = std::move(other170.app_id);
+    partition_index = std::move(other170.partition_index);
+    decree = std::move(other170.decree);
+    server = std::move(other170.server);
+    extra_check_values = std::move(other170.extra_check_values);
+    __isset = std::move(other170.__isset);
 }
 check_and_mutate_response &check_and_mutate_response::
-operator=(const check_and_mutate_response &other104)
-{
-    error = other104.error;
-    check_value_returned = other104.check_value_returned;
-    check_value_exist = other104.check_value_exist;
-    check_value = other104.check_value;
-    app_id = other104.app_id;
-    partition_index = other104.partition_index;
-    decree = other104.decree;
-    server = other104.server;
-    __isset = other104.__isset;
+operator=(const check_and_mutate_response &other171)
+{
+    error = other171.error;
+    check_value_returned = other171.check_value_returned;
+    check_value_exist = other171.check_value_exist;
+    check_value = other171.check_value;
+    app_id = other171.app_id;
+    partition_index = other171.partition_index;
+    decree = other171.decree;
+    server = other171.server;
+    extra_check_values = other171.extra_check_values;
+    __isset = other171.__isset;
     return *this;
 }
 check_and_mutate_response &check_and_mutate_response::
-operator=(check_and_mutate_response &&other105)
-{
-    error = std::move(other105.error);
-    check_value_returned = std::move(other105.check_value_returned);
-    check_value_exist = std::move(other105.check_value_exist);
-    check_value = std::move(other105.check_value);
-    app_id = std::move(other105.app_id);
-    partition_index = std::move(other105.partition_index);
-    decree = std::move(other105.decree);
-    server = std::move(other105.server);
-    __isset = std::move(other105.__isset);
+operator=(check_and_mutate_response &&other172)
+{
+    error = std::move(other172.error);
+    check_value_returned = std::move(other172.check_value_returned);
+    check_value_exist = std::move(other172.check_value_exist);
+    check_value = std::move(other172.check_value);
+    app_id = std::move(other172.app_id);
+    partition_index = std::move(other172.partition_index);
+    decree = std::move(other172.decree);
+    server = std::move(other172.server);
+    extra_check_values = std::move(other172.extra_check_values);
+    __isset = std::move(other172.__isset);
     return *this;
 }
 void check_and_mutate_response::printTo(std::ostream &out) const
@@ -3636,6 +4948,8 @@ void check_and_mutate_response::printTo(std::ostream &out) const
         << "decree=" << to_string(decree);
     out << ", "
         << "server=" << to_string(server);
+    out << ", "
+        << "extra_check_values=" << to_string(extra_check_values);
     out << ")";
 }
 
@@ -3673,6 +4987,22 @@ void get_scanner_request::__set_sort_key_filter_pattern(const ::dsn::blob &val)
     this->sort_key_filter_pattern = val;
 }
 
+void get_scanner_request::__set_bulk_scan(const bool val) { this->bulk_scan = val; }
+
+void get_scanner_request::__set_value_filter_type(const cas_check_type::type val)
+{
+    this->value_filter_type = val;
+}
+
+void get_scanner_request::__set_value_filter_operand(const ::dsn::blob &val)
+{
+    this->value_filter_operand = val;
+}
+
+void get_scanner_request::__set_value_offset(const int32_t val) { this->value_offset = val; }
+
+void get_scanner_request::__set_value_length(const int32_t val) { this->value_length = val; }
+
 uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
 {
 
@@ -3732,46 +5062,88 @@ uint32_t get_scanner_request::read(::apache::thrift::protocol::TProtocol *iprot)
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 6:
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_BOOL) {
+                xfer += iprot->readBool(this->no_value);
+                this->__isset.no_value = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 7:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast173;
+                xfer += iprot->readI32(ecast173);
+                this->hash_key_filter_type = (filter_type::type)ecast173;
+                this->__isset.hash_key_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 8:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->hash_key_filter_pattern.read(iprot);
+                this->__isset.hash_key_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 9:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                int32_t ecast174;
+                xfer += iprot->readI32(ecast174);
+                this->sort_key_filter_type = (filter_type::type)ecast174;
+                this->__isset.sort_key_filter_type = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 10:
+            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+                xfer += this->sort_key_filter_pattern.read(iprot);
+                this->__isset.sort_key_filter_pattern = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 11:
             if (ftype == ::apache::thrift::protocol::T_BOOL) {
-                xfer += iprot->readBool(this->no_value);
-                this->__isset.no_value = true;
+                xfer += iprot->readBool(this->bulk_scan);
+                this->__isset.bulk_scan = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 7:
+        case 12:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast106;
-                xfer += iprot->readI32(ecast106);
-                this->hash_key_filter_type = (filter_type::type)ecast106;
-                this->__isset.hash_key_filter_type = true;
+                int32_t ecast175;
+                xfer += iprot->readI32(ecast175);
+                this->value_filter_type = (cas_check_type::type)ecast175;
+                this->__isset.value_filter_type = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 8:
+        case 13:
             if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->hash_key_filter_pattern.read(iprot);
-                this->__isset.hash_key_filter_pattern = true;
+                xfer += this->value_filter_operand.read(iprot);
+                this->__isset.value_filter_operand = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 9:
+        case 14:
             if (ftype == ::apache::thrift::protocol::T_I32) {
-                int32_t ecast107;
-                xfer += iprot->readI32(ecast107);
-                this->sort_key_filter_type = (filter_type::type)ecast107;
-                this->__isset.sort_key_filter_type = true;
+                xfer += iprot->readI32(this->value_offset);
+                this->__isset.value_offset = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
             break;
-        case 10:
-            if (ftype == ::apache::thrift::protocol::T_STRUCT) {
-                xfer += this->sort_key_filter_pattern.read(iprot);
-                this->__isset.sort_key_filter_pattern = true;
+        case 15:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->value_length);
+                this->__isset.value_length = true;
             } else {
                 xfer += iprot->skip(ftype);
             }
@@ -3836,6 +5208,27 @@ uint32_t get_scanner_request::write(::apache::thrift::protocol::TProtocol *oprot
     xfer += this->sort_key_filter_pattern.write(oprot);
     xfer += oprot->writeFieldEnd();
 
+    xfer += oprot->writeFieldBegin("bulk_scan", ::apache::thrift::protocol::T_BOOL, 11);
+    xfer += oprot->writeBool(this->bulk_scan);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_filter_type", ::apache::thrift::protocol::T_I32, 12);
+    xfer += oprot->writeI32((int32_t)this->value_filter_type);
+    xfer += oprot->writeFieldEnd();
+
+    xfer +=
+        oprot->writeFieldBegin("value_filter_operand", ::apache::thrift::protocol::T_STRUCT, 13);
+    xfer += this->value_filter_operand.write(oprot);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_offset", ::apache::thrift::protocol::T_I32, 14);
+    xfer += oprot->writeI32(this->value_offset);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("value_length", ::apache::thrift::protocol::T_I32, 15);
+    xfer += oprot->writeI32(this->value_length);
+    xfer += oprot->writeFieldEnd();
+
     xfer += oprot->writeFieldStop();
     xfer += oprot->writeStructEnd();
     return xfer;
@@ -3854,65 +5247,90 @@ void swap(get_scanner_request &a, get_scanner_request &b)
     swap(a.hash_key_filter_pattern, b.hash_key_filter_pattern);
     swap(a.sort_key_filter_type, b.sort_key_filter_type);
     swap(a.sort_key_filter_pattern, b.sort_key_filter_pattern);
+    swap(a.bulk_scan, b.bulk_scan);
+    swap(a.value_filter_type, b.value_filter_type);
+    swap(a.value_filter_operand, b.value_filter_operand);
+    swap(a.value_offset, b.value_offset);
+    swap(a.value_length, b.value_length);
     swap(a.__isset, b.__isset);
 }
 
-get_scanner_request::get_scanner_request(const get_scanner_request &other108)
-{
-    start_key = other108.start_key;
-    stop_key = other108.stop_key;
-    start_inclusive = other108.start_inclusive;
-    stop_inclusive = other108.stop_inclusive;
-    batch_size = other108.batch_size;
-    no_value = other108.no_value;
-    hash_key_filter_type = other108.hash_key_filter_type;
-    hash_key_filter_pattern = other108.hash_key_filter_pattern;
-    sort_key_filter_type = other108.sort_key_filter_type;
-    sort_key_filter_pattern = other108.sort_key_filter_pattern;
-    __isset = other108.__isset;
-}
-get_scanner_request::get_scanner_request(get_scanner_request &&other109)
-{
-    start_key = std::move(other109.start_key);
-    stop_key = std::move(other109.stop_key);
-    start_inclusive = std::move(other109.start_inclusive);
-    stop_inclusive = std::move(other109.stop_inclusive);
-    batch_size = std::move(other109.batch_size);
-    no_value = std::move(other109.no_value);
-    hash_key_filter_type = std::move(other109.hash_key_filter_type);
-    hash_key_filter_pattern = std::move(other109.hash_key_filter_pattern);
-    sort_key_filter_type = std::move(other109.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other109.sort_key_filter_pattern);
-    __isset = std::move(other109.__isset);
-}
-get_scanner_request &get_scanner_request::operator=(const get_scanner_request &other110)
-{
-    start_key = other110.start_key;
-    stop_key = other110.stop_key;
-    start_inclusive = other110.start_inclusive;
-    stop_inclusive = other110.stop_inclusive;
-    batch_size = other110.batch_size;
-    no_value = other110.no_value;
-    hash_key_filter_type = other110.hash_key_filter_type;
-    hash_key_filter_pattern = other110.hash_key_filter_pattern;
-    sort_key_filter_type = other110.sort_key_filter_type;
-    sort_key_filter_pattern = other110.sort_key_filter_pattern;
-    __isset = other110.__isset;
+get_scanner_request::get_scanner_request(const get_scanner_request &other176)
+{
+    start_key = other176.start_key;
+    stop_key = other176.stop_key;
+    start_inclusive = other176.start_inclusive;
+    stop_inclusive = other176.stop_inclusive;
+    batch_size = other176.batch_size;
+    no_value = other176.no_value;
+    hash_key_filter_type = other176.hash_key_filter_type;
+    hash_key_filter_pattern = other176.hash_key_filter_pattern;
+    sort_key_filter_type = other176.sort_key_filter_type;
+    sort_key_filter_pattern = other176.sort_key_filter_pattern;
+    bulk_scan = other176.bulk_scan;
+    value_filter_type = other176.value_filter_type;
+    value_filter_operand = other176.value_filter_operand;
+    value_offset = other176.value_offset;
+    value_length = other176.value_length;
+    __isset = other176.__isset;
+}
+get_scanner_request::get_scanner_request(get_scanner_request &&other177)
+{
+    start_key = std::move(other177.start_key);
+    stop_key = std::move(other177.stop_key);
+    start_inclusive = std::move(other177.start_inclusive);
+    stop_inclusive = std::move(other177.stop_inclusive);
+    batch_size = std::move(other177.batch_size);
+    no_value = std::move(other177.no_value);
+    hash_key_filter_type = std::move(other177.hash_key_filter_type);
+    hash_key_filter_pattern = std::move(other177.hash_key_filter_pattern);
+    sort_key_filter_type = std::move(other177.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other177.sort_key_filter_pattern);
+    bulk_scan = std::move(other177.bulk_scan);
+    value_filter_type = std::move(other177.value_filter_type);
+    value_filter_operand = std::move(other177.value_filter_operand);
+    value_offset = std::move(other177.value_offset);
+    value_length = std::move(other177.value_length);
+    __isset = std::move(other177.__isset);
+}
+get_scanner_request &get_scanner_request::operator=(const get_scanner_request &other178)
+{
+    start_key = other178.start_key;
+    stop_key = other178.stop_key;
+    start_inclusive = other178.start_inclusive;
+    stop_inclusive = other178.stop_inclusive;
+    batch_size = other178.batch_size;
+    no_value = other178.no_value;
+    hash_key_filter_type = other178.hash_key_filter_type;
+    hash_key_filter_pattern = other178.hash_key_filter_pattern;
+    sort_key_filter_type = other178.sort_key_filter_type;
+    sort_key_filter_pattern = other178.sort_key_filter_pattern;
+    bulk_scan = other178.bulk_scan;
+    value_filter_type = other178.value_filter_type;
+    value_filter_operand = other178.value_filter_operand;
+    value_offset = other178.value_offset;
+    value_length = other178.value_length;
+    __isset = other178.__isset;
     return *this;
 }
-get_scanner_request &get_scanner_request::operator=(get_scanner_request &&other111)
-{
-    start_key = std::move(other111.start_key);
-    stop_key = std::move(other111.stop_key);
-    start_inclusive = std::move(other111.start_inclusive);
-    stop_inclusive = std::move(other111.stop_inclusive);
-    batch_size = std::move(other111.batch_size);
-    no_value = std::move(other111.no_value);
-    hash_key_filter_type = std::move(other111.hash_key_filter_type);
-    hash_key_filter_pattern = std::move(other111.hash_key_filter_pattern);
-    sort_key_filter_type = std::move(other111.sort_key_filter_type);
-    sort_key_filter_pattern = std::move(other111.sort_key_filter_pattern);
-    __isset = std::move(other111.__isset);
+get_scanner_request &get_scanner_request::operator=(get_scanner_request &&other179)
+{
+    start_key = std::move(other179.start_key);
+    stop_key = std::move(other179.stop_key);
+    start_inclusive = std::move(other179.start_inclusive);
+    stop_inclusive = std::move(other179.stop_inclusive);
+    batch_size = std::move(other179.batch_size);
+    no_value = std::move(other179.no_value);
+    hash_key_filter_type = std::move(other179.hash_key_filter_type);
+    hash_key_filter_pattern = std::move(other179.hash_key_filter_pattern);
+    sort_key_filter_type = std::move(other179.sort_key_filter_type);
+    sort_key_filter_pattern = std::move(other179.sort_key_filter_pattern);
+    bulk_scan = std::move(other179.bulk_scan);
+    value_filter_type = std::move(other179.value_filter_type);
+    value_filter_operand = std::move(other179.value_filter_operand);
+    value_offset = std::move(other179.value_offset);
+    value_length = std::move(other179.value_length);
+    __isset = std::move(other179.__isset);
     return *this;
 }
 void get_scanner_request::printTo(std::ostream &out) const
@@ -3938,6 +5356,16 @@ void get_scanner_request::printTo(std::ostream &out) const
         << "sort_key_filter_type=" << to_string(sort_key_filter_type);
     out << ", "
         << "sort_key_filter_pattern=" << to_string(sort_key_filter_pattern);
+    out << ", "
+        << "bulk_scan=" << to_string(bulk_scan);
+    out << ", "
+        << "value_filter_type=" << to_string(value_filter_type);
+    out << ", "
+        << "value_filter_operand=" << to_string(value_filter_operand);
+    out << ", "
+        << "value_offset=" << to_string(value_offset);
+    out << ", "
+        << "value_length=" << to_string(value_length);
     out << ")";
 }
 
@@ -4006,26 +5434,26 @@ void swap(scan_request &a, scan_request &b)
     swap(a.__isset, b.__isset);
 }
 
-scan_request::scan_request(const scan_request &other112)
+scan_request::scan_request(const scan_request &other180)
 {
-    context_id = other112.context_id;
-    __isset = other112.__isset;
+    context_id = other180.context_id;
+    __isset = other180.__isset;
 }
-scan_request::scan_request(scan_request &&other113)
+scan_request::scan_request(scan_request &&other181)
 {
-    context_id = std::move(other113.context_id);
-    __isset = std::move(other113.__isset);
+    context_id = std::move(other181.context_id);
+    __isset = std::move(other181.__isset);
 }
-scan_request &scan_request::operator=(const scan_request &other114)
+scan_request &scan_request::operator=(const scan_request &other182)
 {
-    context_id = other114.context_id;
-    __isset = other114.__isset;
+    context_id = other182.context_id;
+    __isset = other182.__isset;
     return *this;
 }
-scan_request &scan_request::operator=(scan_request &&other115)
+scan_request &scan_request::operator=(scan_request &&other183)
 {
-    context_id = std::move(other115.context_id);
-    __isset = std::move(other115.__isset);
+    context_id = std::move(other183.context_id);
+    __isset = std::move(other183.__isset);
     return *this;
 }
 void scan_request::printTo(std::ostream &out) const
@@ -4081,13 +5509,13 @@ uint32_t scan_response::read(::apache::thrift::protocol::TProtocol *iprot)
             if (ftype == ::apache::thrift::protocol::T_LIST) {
                 {
                     this->kvs.clear();
-                    uint32_t _size116;
-                    ::apache::thrift::protocol::TType _etype119;
-                    xfer += iprot->readListBegin(_etype119, _size116);
-                    this->kvs.resize(_size116);
-                    uint32_t _i120;
-                    for (_i120 = 0; _i120 < _size116; ++_i120) {
-                        xfer += this->kvs[_i120].read(iprot);
+                    uint32_t _size184;
+                    ::apache::thrift::protocol::TType _etype187;
+                    xfer += iprot->readListBegin(_etype187, _size184);
+                    this->kvs.resize(_size184);
+                    uint32_t _i188;
+                    for (_i188 = 0; _i188 < _size184; ++_i188) {
+                        xfer += this->kvs[_i188].read(iprot);
                     }
                     xfer += iprot->readListEnd();
                 }
@@ -4154,9 +5582,9 @@ uint32_t scan_response::write(::apache::thrift::protocol::TProtocol *oprot) cons
     {
         xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
                                       static_cast<uint32_t>(this->kvs.size()));
-        std::vector<key_value>::const_iterator _iter121;
-        for (_iter121 = this->kvs.begin(); _iter121 != this->kvs.end(); ++_iter121) {
-            xfer += (*_iter121).write(oprot);
+        std::vector<key_value>::const_iterator _iter189;
+        for (_iter189 = this->kvs.begin(); _iter189 != this->kvs.end(); ++_iter189) {
+            xfer += (*_iter189).write(oprot);
         }
         xfer += oprot->writeListEnd();
     }
@@ -4195,46 +5623,46 @@ void swap(scan_response &a, scan_response &b)
     swap(a.__isset, b.__isset);
 }
 
-scan_response::scan_response(const scan_response &other122)
+scan_response::scan_response(const scan_response &other190)
 {
-    error = other122.error;
-    kvs = other122.kvs;
-    context_id = other122.context_id;
-    app_id = other122.app_id;
-    partition_index = other122.partition_index;
-    server = other122.server;
-    __isset = other122.__isset;
+    error = other190.error;
+    kvs = other190.kvs;
+    context_id = other190.context_id;
+    app_id = other190.app_id;
+    partition_index = other190.partition_index;
+    server = other190.server;
+    __isset = other190.__isset;
 }
-scan_response::scan_response(scan_response &&other123)
+scan_response::scan_response(scan_response &&other191)
 {
-    error = std::move(other123.error);
-    kvs = std::move(other123.kvs);
-    context_id = std::move(other123.context_id);
-    app_id = std::move(other123.app_id);
-    partition_index = std::move(other123.partition_index);
-    server = std::move(other123.server);
-    __isset = std::move(other123.__isset);
+    error = std::move(other191.error);
+    kvs = std::move(other191.kvs);
+    context_id = std::move(other191.context_id);
+    app_id = std::move(other191.app_id);
+    partition_index = std::move(other191.partition_index);
+    server = std::move(other191.server);
+    __isset = std::move(other191.__isset);
 }
-scan_response &scan_response::operator=(const scan_response &other124)
+scan_response &scan_response::operator=(const scan_response &other192)
 {
-    error = other124.error;
-    kvs = other124.kvs;
-    context_id = other124.context_id;
-    app_id = other124.app_id;
-    partition_index = other124.partition_index;
-    server = other124.server;
-    __isset = other124.__isset;
+    error = other192.error;
+    kvs = other192.kvs;
+    context_id = other192.context_id;
+    app_id = other192.app_id;
+    partition_index = other192.partition_index;
+    server = other192.server;
+    __isset = other192.__isset;
     return *this;
 }
-scan_response &scan_response::operator=(scan_response &&other125)
+scan_response &scan_response::operator=(scan_response &&other193)
 {
-    error = std::move(other125.error);
-    kvs = std::move(other125.kvs);
-    context_id = std::move(other125.context_id);
-    app_id = std::move(other125.app_id);
-    partition_index = std::move(other125.partition_index);
-    server = std::move(other125.server);
-    __isset = std::move(other125.__isset);
+    error = std::move(other193.error);
+    kvs = std::move(other193.kvs);
+    context_id = std::move(other193.context_id);
+    app_id = std::move(other193.app_id);
+    partition_index = std::move(other193.partition_index);
+    server = std::move(other193.server);
+    __isset = std::move(other193.__isset);
     return *this;
 }
 void scan_response::printTo(std::ostream &out) const
@@ -4255,6 +5683,305 @@ void scan_response::printTo(std::ostream &out) const
     out << ")";
 }
 
+get_split_keys_request::~get_split_keys_request() throw() {}
+
+void get_split_keys_request::__set_split_count(const int32_t val) { this->split_count = val; }
+
+uint32_t get_split_keys_request::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->split_count);
+                this->__isset.split_count = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t get_split_keys_request::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("get_split_keys_request");
+
+    xfer += oprot->writeFieldBegin("split_count", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->split_count);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(get_split_keys_request &a, get_split_keys_request &b)
+{
+    using ::std::swap;
+    swap(a.split_count, b.split_count);
+    swap(a.__isset, b.__isset);
+}
+
+get_split_keys_request::get_split_keys_request(const get_split_keys_request &other194)
+{
+    split_count = other194.split_count;
+    __isset = other194.__isset;
+}
+get_split_keys_request::get_split_keys_request(get_split_keys_request &&other195)
+{
+    split_count = std::move(other195.split_count);
+    __isset = std::move(other195.__isset);
+}
+get_split_keys_request &get_split_keys_request::operator=(const get_split_keys_request &other196)
+{
+    split_count = other196.split_count;
+    __isset = other196.__isset;
+    return *this;
+}
+get_split_keys_request &get_split_keys_request::operator=(get_split_keys_request &&other197)
+{
+    split_count = std::move(other197.split_count);
+    __isset = std::move(other197.__isset);
+    return *this;
+}
+void get_split_keys_request::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "get_split_keys_request(";
+    out << "split_count=" << to_string(split_count);
+    out << ")";
+}
+
+get_split_keys_response::~get_split_keys_response() throw() {}
+
+void get_split_keys_response::__set_error(const int32_t val) { this->error = val; }
+
+void get_split_keys_response::__set_split_keys(const std::vector<::dsn::blob> &val)
+{
+    this->split_keys = val;
+}
+
+void get_split_keys_response::__set_app_id(const int32_t val) { this->app_id = val; }
+
+void get_split_keys_response::__set_partition_index(const int32_t val)
+{
+    this->partition_index = val;
+}
+
+void get_split_keys_response::__set_server(const std::string &val) { this->server = val; }
+
+uint32_t get_split_keys_response::read(::apache::thrift::protocol::TProtocol *iprot)
+{
+
+    apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+    uint32_t xfer = 0;
+    std::string fname;
+    ::apache::thrift::protocol::TType ftype;
+    int16_t fid;
+
+    xfer += iprot->readStructBegin(fname);
+
+    using ::apache::thrift::protocol::TProtocolException;
+
+    while (true) {
+        xfer += iprot->readFieldBegin(fname, ftype, fid);
+        if (ftype == ::apache::thrift::protocol::T_STOP) {
+            break;
+        }
+        switch (fid) {
+        case 1:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->error);
+                this->__isset.error = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 2:
+            if (ftype == ::apache::thrift::protocol::T_LIST) {
+                {
+                    this->split_keys.clear();
+                    uint32_t _size198;
+                    ::apache::thrift::protocol::TType _etype201;
+                    xfer += iprot->readListBegin(_etype201, _size198);
+                    this->split_keys.resize(_size198);
+                    uint32_t _i202;
+                    for (_i202 = 0; _i202 < _size198; ++_i202) {
+                        xfer += this->split_keys[_i202].read(iprot);
+                    }
+                    xfer += iprot->readListEnd();
+                }
+                this->__isset.split_keys = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 3:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->app_id);
+                this->__isset.app_id = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 4:
+            if (ftype == ::apache::thrift::protocol::T_I32) {
+                xfer += iprot->readI32(this->partition_index);
+                this->__isset.partition_index = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        case 6:
+            if (ftype == ::apache::thrift::protocol::T_STRING) {
+                xfer += iprot->readString(this->server);
+                this->__isset.server = true;
+            } else {
+                xfer += iprot->skip(ftype);
+            }
+            break;
+        default:
+            xfer += iprot->skip(ftype);
+            break;
+        }
+        xfer += iprot->readFieldEnd();
+    }
+
+    xfer += iprot->readStructEnd();
+
+    return xfer;
+}
+
+uint32_t get_split_keys_response::write(::apache::thrift::protocol::TProtocol *oprot) const
+{
+    uint32_t xfer = 0;
+    apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+    xfer += oprot->writeStructBegin("get_split_keys_response");
+
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("split_keys", ::apache::thrift::protocol::T_LIST, 2);
+    {
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT,
+                                      static_cast<uint32_t>(this->split_keys.size()));
+        std::vector<::dsn::blob>::const_iterator _iter203;
+        for (_iter203 = this->split_keys.begin(); _iter203 != this->split_keys.end(); ++_iter203) {
+            xfer += (*_iter203).write(oprot);
+        }
+        xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("app_id", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->app_id);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("partition_index", ::apache::thrift::protocol::T_I32, 4);
+    xfer += oprot->writeI32(this->partition_index);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldBegin("server", ::apache::thrift::protocol::T_STRING, 6);
+    xfer += oprot->writeString(this->server);
+    xfer += oprot->writeFieldEnd();
+
+    xfer += oprot->writeFieldStop();
+    xfer += oprot->writeStructEnd();
+    return xfer;
+}
+
+void swap(get_split_keys_response &a, get_split_keys_response &b)
+{
+    using ::std::swap;
+    swap(a.error, b.error);
+    swap(a.split_keys, b.split_keys);
+    swap(a.app_id, b.app_id);
+    swap(a.partition_index, b.partition_index);
+    swap(a.server, b.server);
+    swap(a.__isset, b.__isset);
+}
+
+get_split_keys_response::get_split_keys_response(const get_split_keys_response &other204)
+{
+    error = other204.error;
+    split_keys = other204.split_keys;
+    app_id = other204.app_id;
+    partition_index = other204.partition_index;
+    server = other204.server;
+    __isset = other204.__isset;
+}
+get_split_keys_response::get_split_keys_response(get_split_keys_response &&other205)
+{
+    error = std::move(other205.error);
+    split_keys = std::move(other205.split_keys);
+    app_id = std::move(other205.app_id);
+    partition_index = std::move(other205.partition_index);
+    server = std::move(other205.server);
+    __isset = std::move(other205.__isset);
+}
+get_split_keys_response &get_split_keys_response::operator=(const get_split_keys_response &other206)
+{
+    error = other206.error;
+    split_keys = other206.split_keys;
+    app_id = other206.app_id;
+    partition_index = other206.partition_index;
+    server = other206.server;
+    __isset = other206.__isset;
+    return *this;
+}
+get_split_keys_response &get_split_keys_response::operator=(get_split_keys_response &&other207)
+{
+    error = std::move(other207.error);
+    split_keys = std::move(other207.split_keys);
+    app_id = std::move(other207.app_id);
+    partition_index = std::move(other207.partition_index);
+    server = std::move(other207.server);
+    __isset = std::move(other207.__isset);
+    return *this;
+}
+void get_split_keys_response::printTo(std::ostream &out) const
+{
+    using ::apache::thrift::to_string;
+    out << "get_split_keys_response(";
+    out << "error=" << to_string(error);
+    out << ", "
+        << "split_keys=" << to_string(split_keys);
+    out << ", "
+        << "app_id=" << to_string(app_id);
+    out << ", "
+        << "partition_index=" << to_string(partition_index);
+    out << ", "
+        << "server=" << to_string(server);
+    out << ")";
+}
+
 duplicate_request::~duplicate_request() throw() {}
 
 void duplicate_request::__set_timestamp(const int64_t val)
@@ -4405,42 +6132,42 @@ void swap(duplicate_request &a, duplicate_request &b)
     swap(a.__isset, b.__isset);
 }
 
-duplicate_request::duplicate_request(const duplicate_request &other126)
+duplicate_request::duplicate_request(const duplicate_request &other208)
 {
-    timestamp = other126.timestamp;
-    task_code = other126.task_code;
-    raw_message = other126.raw_message;
-    cluster_id = other126.cluster_id;
-    verify_timetag = other126.verify_timetag;
-    __isset = other126.__isset;
+    timestamp = other208.timestamp;
+    task_code = other208.task_code;
+    raw_message = other208.raw_message;
+    cluster_id = other208.cluster_id;
+    verify_timetag = other208.verify_timetag;
+    __isset = other208.__isset;
 }
-duplicate_request::duplicate_request(duplicate_request &&other127)
+duplicate_request::duplicate_request(duplicate_request &&other209)
 {
-    timestamp = std::move(other127.timestamp);
-    task_code = std::move(other127.task_code);
-    raw_message = std::move(other127.raw_message);
-    cluster_id = std::move(other127.cluster_id);
-    verify_timetag = std::move(other127.verify_timetag);
-    __isset = std::move(other127.__isset);
+    timestamp = std::move(other209.timestamp);
+    task_code = std::move(other209.task_code);
+    raw_message = std::move(other209.raw_message);
+    cluster_id = std::move(other209.cluster_id);
+    verify_timetag = std::move(other209.verify_timetag);
+    __isset = std::move(other209.__isset);
 }
-duplicate_request &duplicate_request::operator=(const duplicate_request &other128)
+duplicate_request &duplicate_request::operator=(const duplicate_request &other210)
 {
-    timestamp = other128.timestamp;
-    task_code = other128.task_code;
-    raw_message = other128.raw_message;
-    cluster_id = other128.cluster_id;
-    verify_timetag = other128.verify_timetag;
-    __isset = other128.__isset;
+    timestamp = other210.timestamp;
+    task_code = other210.task_code;
+    raw_message = other210.raw_message;
+    cluster_id = other210.cluster_id;
+    verify_timetag = other210.verify_timetag;
+    __isset = other210.__isset;
     return *this;
 }
-duplicate_request &duplicate_request::operator=(duplicate_request &&other129)
+duplicate_request &duplicate_request::operator=(duplicate_request &&other211)
 {
-    timestamp = std::move(other129.timestamp);
-    task_code = std::move(other129.task_code);
-    raw_message = std::move(other129.raw_message);
-    cluster_id = std::move(other129.cluster_id);
-    verify_timetag = std::move(other129.verify_timetag);
-    __isset = std::move(other129.__isset);
+    timestamp = std::move(other211.timestamp);
+    task_code = std::move(other211.task_code);
+    raw_message = std::move(other211.raw_message);
+    cluster_id = std::move(other211.cluster_id);
+    verify_timetag = std::move(other211.verify_timetag);
+    __isset = std::move(other211.__isset);
     return *this;
 }
 void duplicate_request::printTo(std::ostream &out) const
@@ -4554,30 +6281,30 @@ void swap(duplicate_response &a, duplicate_response &b)
     swap(a.__isset, b.__isset);
 }
 
-duplicate_response::duplicate_response(const duplicate_response &other130)
+duplicate_response::duplicate_response(const duplicate_response &other212)
 {
-    error = other130.error;
-    error_hint = other130.error_hint;
-    __isset = other130.__isset;
+    error = other212.error;
+    error_hint = other212.error_hint;
+    __isset = other212.__isset;
 }
-duplicate_response::duplicate_response(duplicate_response &&other131)
+duplicate_response::duplicate_response(duplicate_response &&other213)
 {
-    error = std::move(other131.error);
-    error_hint = std::move(other131.error_hint);
-    __isset = std::move(other131.__isset);
+    error = std::move(other213.error);
+    error_hint = std::move(other213.error_hint);
+    __isset = std::move(other213.__isset);
 }
-duplicate_response &duplicate_response::operator=(const duplicate_response &other132)
+duplicate_response &duplicate_response::operator=(const duplicate_response &other214)
 {
-    error = other132.error;
-    error_hint = other132.error_hint;
-    __isset = other132.__isset;
+    error = other214.error;
+    error_hint = other214.error_hint;
+    __isset = other214.__isset;
     return *this;
 }
-duplicate_response &duplicate_response::operator=(duplicate_response &&other133)
+duplicate_response &duplicate_response::operator=(duplicate_response &&other215)
 {
-    error = std::move(other133.error);
-    error_hint = std::move(other133.error_hint);
-    __isset = std::move(other133.__isset);
+    error = std::move(other215.error);
+    error_hint = std::move(other215.error_hint);
+    __isset = std::move(other215.__isset);
     return *this;
 }
 void duplicate_response::printTo(std::ostream &out) const
@@ -4,6 +4,9 @@
 
 #include <cctype>
 #include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
 #include <string>
 #include <stdint.h>
 
@@ -27,7 +30,7 @@ std::unordered_map<int, std::string> pegasus_client_impl::_client_error_to_strin
 std::unordered_map<int, int> pegasus_client_impl::_server_error_to_client;
 
 pegasus_client_impl::pegasus_client_impl(const char *cluster_name, const char *app_name)
-    : _cluster_name(cluster_name), _app_name(app_name)
+    : _cluster_name(cluster_name), _app_name(app_name), _partition_config(0)
 {
     std::vector<dsn::rpc_address> meta_servers;
     dsn::replication::replica_helper::load_meta_servers(
@@ -427,6 +430,11 @@ void pegasus_client_impl::async_multi_get(const std::string &hash_key,
     req.sort_key_filter_type = (dsn::apps::filter_type::type)options.sort_key_filter_type;
     req.sort_key_filter_pattern = ::dsn::blob(
         options.sort_key_filter_pattern.data(), 0, options.sort_key_filter_pattern.size());
+    req.value_filter_type = (dsn::apps::cas_check_type::type)options.value_filter_type;
+    req.value_filter_operand = ::dsn::blob(
+        options.value_filter_operand.data(), 0, options.value_filter_operand.size());
+    req.value_offset = options.value_offset;
+    req.value_length = options.value_length;
     ::dsn::blob tmp_key;
     pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
     auto partition_hash = pegasus_key_hash(tmp_key);
@@ -536,6 +544,688 @@ void pegasus_client_impl::async_multi_get_sortkeys(const std::string &hash_key,
                        partition_hash);
 }
 
+int pegasus_client_impl::batch_multi_get(const std::vector<batch_multi_get_item> &items,
+                                         std::vector<batch_multi_get_result> &results,
+                                         int max_fetch_count,
+                                         int max_fetch_size,
+                                         int timeout_milliseconds)
+{
+    results.clear();
+    results.resize(items.size());
+
+    // check params
+    for (const auto &item : items) {
+        if (item.hashkey.size() == 0) {
+            derror("invalid hash key: hash key should not be empty");
+            return PERR_INVALID_HASH_KEY;
+        }
+        if (item.hashkey.size() >= UINT16_MAX) {
+            derror("invalid hash key: hash key length should be less than UINT16_MAX, but %d",
+                   (int)item.hashkey.size());
+            return PERR_INVALID_HASH_KEY;
+        }
+    }
+    if (items.empty()) {
+        return PERR_OK;
+    }
+
+    // the items routed by a stale partition count or app id are retried once with the
+    // refreshed ones
+    std::vector<size_t> pending_items(items.size());
+    std::iota(pending_items.begin(), pending_items.end(), 0);
+    int ret = PERR_OK;
+    for (int round = 0; round < 2 && !pending_items.empty(); round++) {
+        int32_t app_id = 0;
+        int partition_count = 0;
+        int err = get_partition_count(app_id, partition_count, timeout_milliseconds);
+        if (err != PERR_OK) {
+            return err;
+        }
+
+        // group the items by partition, and route each group by the hash of one of its keys
+        // instead of the partition index, so that a split partition rejects the group
+        std::map<int, std::vector<size_t>> partition_items;
+        std::map<int, uint64_t> partition_hashes;
+        for (size_t i : pending_items) {
+            ::dsn::blob tmp_key;
+            pegasus_generate_key(tmp_key, items[i].hashkey, std::string());
+            uint64_t partition_hash = pegasus_key_hash(tmp_key);
+            int partition_index = partition_hash % partition_count;
+            partition_items[partition_index].push_back(i);
+            partition_hashes.emplace(partition_index, partition_hash);
+        }
+
+        bool retry_if_stale = (round == 0);
+        std::vector<int> errors(partition_items.size(), PERR_OK);
+        std::vector<char> stale(partition_items.size(), false);
+        std::vector<::dsn::task_ptr> tasks;
+        tasks.reserve(partition_items.size());
+        for (const auto &kv : partition_items) {
+            const std::vector<size_t> &indexes = kv.second;
+            ::dsn::apps::batch_multi_get_request req;
+            req.requests.resize(indexes.size());
+            for (size_t i = 0; i < indexes.size(); i++) {
+                const batch_multi_get_item &item = items[indexes[i]];
+                ::dsn::apps::multi_get_request &sub_req = req.requests[i];
+                sub_req.hash_key = ::dsn::blob(item.hashkey.data(), 0, item.hashkey.size());
+                sub_req.max_kv_count = max_fetch_count;
+                sub_req.max_kv_size = max_fetch_size;
+                sub_req.start_inclusive = true;
+                sub_req.stop_inclusive = false;
+                for (auto &sort_key : item.sortkeys) {
+                    sub_req.sort_keys.emplace_back(sort_key.data(), 0, sort_key.size());
+                }
+            }
+
+            int &error = errors[tasks.size()];
+            char &is_stale = stale[tasks.size()];
+            int partition_index = kv.first;
+            auto callback = [&results, &indexes, &error, &is_stale, app_id, partition_index,
+                             retry_if_stale](
+                ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+            {
+                ::dsn::apps::batch_multi_get_response response;
+                if (err == ::dsn::ERR_OK) {
+                    ::unmarshall(resp, response);
+                    if (response.app_id != app_id ||
+                        response.partition_index != partition_index) {
+                        // the app is recreated or the partitions are split, the keys of the
+                        // group may be not in the responding partition
+                        err = ::dsn::ERR_OBJECT_NOT_FOUND;
+                    } else if (response.responses.size() != indexes.size()) {
+                        err = ::dsn::ERR_INVALID_DATA;
+                    }
+                }
+                if (retry_if_stale && is_partition_count_stale(err)) {
+                    is_stale = true;
+                    return;
+                }
+                if (err != ::dsn::ERR_OK) {
+                    error = get_client_error(int(err));
+                    for (size_t index : indexes) {
+                        results[index].error = error;
+                    }
+                    return;
+                }
+                for (size_t i = 0; i < indexes.size(); i++) {
+                    ::dsn::apps::multi_get_response &sub_resp = response.responses[i];
+                    batch_multi_get_result &result = results[indexes[i]];
+                    result.error = get_client_error(get_rocksdb_server_error(sub_resp.error));
+                    for (auto &kv : sub_resp.kvs) {
+                        result.values.emplace(std::string(kv.key.data(), kv.key.length()),
+                                              std::string(kv.value.data(), kv.value.length()));
+                    }
+                }
+            };
+            tasks.emplace_back(
+                _client->batch_multi_get(req,
+                                         std::move(callback),
+                                         std::chrono::milliseconds(timeout_milliseconds),
+                                         partition_hashes[kv.first]));
+        }
+
+        std::vector<size_t> stale_items;
+        size_t i = 0;
+        for (const auto &kv : partition_items) {
+            tasks[i]->wait();
+            if (stale[i]) {
+                stale_items.insert(stale_items.end(), kv.second.begin(), kv.second.end());
+            } else if (ret == PERR_OK) {
+                ret = errors[i];
+            }
+            i++;
+        }
+        if (!stale_items.empty()) {
+            invalidate_partition_count(app_id, partition_count);
+        }
+        pending_items.swap(stale_items);
+    }
+    return ret;
+}
+
+template <typename TKey>
+int pegasus_client_impl::check_batch_hash_keys(const std::vector<TKey> &keys)
+{
+    for (const auto &key : keys) {
+        if (key.hashkey.size() == 0) {
+            derror("invalid hash key: hash key should not be empty");
+            return PERR_INVALID_HASH_KEY;
+        }
+        if (key.hashkey.size() >= UINT16_MAX) {
+            derror("invalid hash key: hash key length should be less than UINT16_MAX, but %d",
+                   (int)key.hashkey.size());
+            return PERR_INVALID_HASH_KEY;
+        }
+    }
+    return PERR_OK;
+}
+
+int pegasus_client_impl::batch_get(const std::vector<batch_key> &keys,
+                                   std::vector<batch_get_result> &results,
+                                   int timeout_milliseconds)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err, std::vector<batch_get_result> &&_results) {
+        ret = err;
+        results = std::move(_results);
+        op_completed.notify();
+    };
+    async_batch_get(keys, std::move(callback), timeout_milliseconds);
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::async_batch_get(const std::vector<batch_key> &keys,
+                                          async_batch_get_callback_t &&callback,
+                                          int timeout_milliseconds)
+{
+    auto ctx = std::make_shared<batch_context<batch_get_result>>();
+    ctx->results.resize(keys.size());
+    ctx->callback = std::move(callback);
+
+    int ret = check_batch_hash_keys(keys);
+    if (ret != PERR_OK || keys.empty()) {
+        finish_batch_get(ctx, ret);
+        return;
+    }
+
+    // group the keys by hash key and sort key, the indexes of the duplicate keys are under the
+    // same sort key
+    auto grouped_keys = std::make_shared<batch_get_keys>();
+    for (size_t i = 0; i < keys.size(); i++) {
+        (*grouped_keys)[keys[i].hashkey][keys[i].sortkey].push_back(i);
+    }
+    // the rpcs of all the rounds are counted as one, see send_batch_get
+    ctx->pending_count = 1;
+    send_batch_get(grouped_keys, ctx, timeout_milliseconds, true);
+}
+
+void pegasus_client_impl::finish_batch_get(
+    const std::shared_ptr<batch_context<batch_get_result>> &ctx, int error)
+{
+    for (auto &result : ctx->results) {
+        result.error = error;
+    }
+    ctx->set_error(error);
+    ctx->pending_count = 1;
+    ctx->finish_one();
+}
+
+void pegasus_client_impl::send_batch_get(
+    const std::shared_ptr<batch_get_keys> &keys,
+    const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+    int timeout_milliseconds,
+    bool retry_if_stale)
+{
+    async_get_partition_count(
+        [this, keys, ctx, timeout_milliseconds, retry_if_stale](
+            int err, int32_t app_id, int partition_count) {
+            if (err != PERR_OK) {
+                fail_batch_get(*keys, ctx, err);
+                ctx->finish_one();
+                return;
+            }
+            send_batch_get(
+                keys, app_id, partition_count, ctx, timeout_milliseconds, retry_if_stale);
+        },
+        timeout_milliseconds);
+}
+
+void pegasus_client_impl::send_batch_get(
+    const std::shared_ptr<batch_get_keys> &keys,
+    int32_t app_id,
+    int partition_count,
+    const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+    int timeout_milliseconds,
+    bool retry_if_stale)
+{
+    // group the keys by partition, and route each group by the hash of one of its keys
+    // instead of the partition index, so that a split partition rejects the group
+    struct partition_group
+    {
+        uint64_t partition_hash;
+        std::shared_ptr<batch_get_keys> keys;
+    };
+    std::map<int, partition_group> partition_groups;
+    for (auto &kv : *keys) {
+        ::dsn::blob tmp_key;
+        pegasus_generate_key(tmp_key, kv.first, std::string());
+        uint64_t partition_hash = pegasus_key_hash(tmp_key);
+        partition_group &group = partition_groups[partition_hash % partition_count];
+        if (group.keys == nullptr) {
+            group.partition_hash = partition_hash;
+            group.keys = std::make_shared<batch_get_keys>();
+        }
+        (*group.keys)[kv.first] = std::move(kv.second);
+    }
+
+    // the keys of the groups routed by a stale partition count or app id, which are sent
+    // again after all the rpcs of this round finish
+    struct round_context
+    {
+        std::atomic<size_t> pending_count{0};
+        std::mutex lock;
+        batch_get_keys stale_keys;
+    };
+    auto round = std::make_shared<round_context>();
+    // all the rpcs should be counted before any of them is sent
+    round->pending_count = partition_groups.size();
+    for (const auto &kv : partition_groups) {
+        const std::shared_ptr<batch_get_keys> &group = kv.second.keys;
+        ::dsn::apps::batch_multi_get_request req;
+        req.requests.reserve(group->size());
+        for (const auto &hash_key_kv : *group) {
+            ::dsn::apps::multi_get_request sub_req;
+            sub_req.hash_key = ::dsn::blob(hash_key_kv.first.data(), 0, hash_key_kv.first.size());
+            // no limit, all the sort keys should be fetched
+            sub_req.max_kv_count = -1;
+            sub_req.max_kv_size = -1;
+            sub_req.start_inclusive = true;
+            sub_req.stop_inclusive = false;
+            for (const auto &sort_key_kv : hash_key_kv.second) {
+                sub_req.sort_keys.emplace_back(
+                    sort_key_kv.first.data(), 0, sort_key_kv.first.size());
+            }
+            req.requests.emplace_back(std::move(sub_req));
+        }
+
+        int partition_index = kv.first;
+        auto new_callback = [
+            this,
+            ctx,
+            round,
+            group,
+            app_id,
+            partition_count,
+            partition_index,
+            timeout_milliseconds,
+            retry_if_stale
+        ](::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+        {
+            ::dsn::apps::batch_multi_get_response response;
+            if (err == ::dsn::ERR_OK) {
+                ::dsn::unmarshall(resp, response);
+                if (response.app_id != app_id || response.partition_index != partition_index) {
+                    // the app is recreated or the partitions are split, the keys of the group
+                    // may be not in the responding partition
+                    err = ::dsn::ERR_OBJECT_NOT_FOUND;
+                } else if (response.responses.size() != group->size()) {
+                    err = ::dsn::ERR_INVALID_DATA;
+                }
+            }
+
+            // no value of the group is kept until the response is validated, since the
+            // partial values of an incomplete response from a stale partition may be outdated
+            if (retry_if_stale && is_partition_count_stale(err)) {
+                std::lock_guard<std::mutex> l(round->lock);
+                for (auto &hash_key_kv : *group) {
+                    round->stale_keys[hash_key_kv.first] = std::move(hash_key_kv.second);
+                }
+            } else if (err != ::dsn::ERR_OK) {
+                fail_batch_get(*group, ctx, get_client_error(int(err)));
+            } else {
+                size_t i = 0;
+                for (const auto &hash_key_kv : *group) {
+                    ::dsn::apps::multi_get_response &sub_resp = response.responses[i++];
+                    int error = get_client_error(get_rocksdb_server_error(sub_resp.error));
+                    if (error != PERR_OK) {
+                        ctx->set_error(error);
+                    } else {
+                        // the keys not returned don't exist
+                        error = PERR_NOT_FOUND;
+                    }
+                    const auto &sort_keys = hash_key_kv.second;
+                    for (const auto &sort_key_kv : sort_keys) {
+                        for (size_t index : sort_key_kv.second) {
+                            ctx->results[index].error = error;
+                        }
+                    }
+                    // the values fetched before the server reaches its iteration limits are
+                    // still valid, only the keys not returned are incomplete
+                    if (error != PERR_NOT_FOUND && error != PERR_INCOMPLETE) {
+                        continue;
+                    }
+                    for (auto &kv : sub_resp.kvs) {
+                        auto iter = sort_keys.find(std::string(kv.key.data(), kv.key.length()));
+                        if (iter == sort_keys.end()) {
+                            continue;
+                        }
+                        for (size_t index : iter->second) {
+                            batch_get_result &result = ctx->results[index];
+                            result.error = PERR_OK;
+                            result.value.assign(kv.value.data(), kv.value.length());
+                        }
+                    }
+                }
+            }
+
+            if (round->pending_count.fetch_sub(1) != 1) {
+                return;
+            }
+            if (round->stale_keys.empty()) {
+                ctx->finish_one();
+                return;
+            }
+            // the stale keys are retried once with the refreshed partition count
+            invalidate_partition_count(app_id, partition_count);
+            auto stale_keys = std::make_shared<batch_get_keys>(std::move(round->stale_keys));
+            send_batch_get(stale_keys, ctx, timeout_milliseconds, false);
+        };
+        _client->batch_multi_get(req,
+                                 std::move(new_callback),
+                                 std::chrono::milliseconds(timeout_milliseconds),
+                                 kv.second.partition_hash);
+    }
+}
+
+/*static*/ void
+pegasus_client_impl::fail_batch_get(const batch_get_keys &keys,
+                                    const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+                                    int error)
+{
+    for (const auto &hash_key_kv : keys) {
+        for (const auto &sort_key_kv : hash_key_kv.second) {
+            for (size_t index : sort_key_kv.second) {
+                ctx->results[index].error = error;
+            }
+        }
+    }
+    ctx->set_error(error);
+}
+
+int pegasus_client_impl::batch_set(const std::vector<batch_set_item> &items,
+                                   std::vector<int> &errors,
+                                   int timeout_milliseconds)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err, std::vector<int> &&_errors) {
+        ret = err;
+        errors = std::move(_errors);
+        op_completed.notify();
+    };
+    async_batch_set(items, std::move(callback), timeout_milliseconds);
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::async_batch_set(const std::vector<batch_set_item> &items,
+                                          async_batch_set_callback_t &&callback,
+                                          int timeout_milliseconds)
+{
+    auto ctx = std::make_shared<batch_context<int>>();
+    ctx->results.resize(items.size(), PERR_OK);
+    ctx->callback = std::move(callback);
+
+    int ret = check_batch_hash_keys(items);
+    for (const auto &item : items) {
+        if (ret == PERR_OK && item.ttl_seconds < 0) {
+            derror("invalid ttl seconds: should be no less than 0, but %d", item.ttl_seconds);
+            ret = PERR_INVALID_ARGUMENT;
+        }
+    }
+    if (ret != PERR_OK || items.empty()) {
+        std::fill(ctx->results.begin(), ctx->results.end(), ret);
+        ctx->set_error(ret);
+        ctx->pending_count = 1;
+        ctx->finish_one();
+        return;
+    }
+
+    // group the items by hash key and ttl, each group is written by one multi_put rpc.
+    // the multi_put rpcs of the same partition are batched into one write by the replica.
+    std::map<std::pair<std::string, int>, std::vector<size_t>> groups;
+    for (size_t i = 0; i < items.size(); i++) {
+        groups[std::make_pair(items[i].hashkey, items[i].ttl_seconds)].push_back(i);
+    }
+
+    // all the rpcs should be counted before any of them is sent
+    ctx->pending_count = groups.size();
+    uint32_t epoch_now = utils::epoch_now();
+    for (auto &kv : groups) {
+        const std::string &hash_key = kv.first.first;
+        int ttl_seconds = kv.first.second;
+        auto indexes = std::make_shared<std::vector<size_t>>(std::move(kv.second));
+
+        ::dsn::apps::multi_put_request req;
+        req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+        req.kvs.reserve(indexes->size());
+        for (size_t index : *indexes) {
+            const batch_set_item &item = items[index];
+            ::dsn::apps::key_value kv_blob;
+            kv_blob.key = ::dsn::blob(item.sortkey.data(), 0, item.sortkey.size());
+            kv_blob.value = ::dsn::blob(item.value.data(), 0, item.value.size());
+            req.kvs.emplace_back(std::move(kv_blob));
+        }
+        req.expire_ts_seconds = (ttl_seconds == 0 ? 0 : ttl_seconds + epoch_now);
+
+        ::dsn::blob tmp_key;
+        pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
+        auto partition_hash = pegasus_key_hash(tmp_key);
+        auto new_callback = [ctx, indexes](
+            ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+        {
+            ::dsn::apps::update_response response;
+            if (err == ::dsn::ERR_OK) {
+                ::dsn::unmarshall(resp, response);
+            }
+            int error = get_client_error(
+                (err == ::dsn::ERR_OK) ? get_rocksdb_server_error(response.error) : int(err));
+            if (error != PERR_OK) {
+                for (size_t index : *indexes) {
+                    ctx->results[index] = error;
+                }
+                ctx->set_error(error);
+            }
+            ctx->finish_one();
+        };
+        _client->multi_put(req,
+                           std::move(new_callback),
+                           std::chrono::milliseconds(timeout_milliseconds),
+                           partition_hash);
+    }
+}
+
+int pegasus_client_impl::batch_del(const std::vector<batch_key> &keys,
+                                   std::vector<int> &errors,
+                                   int timeout_milliseconds)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err, std::vector<int> &&_errors) {
+        ret = err;
+        errors = std::move(_errors);
+        op_completed.notify();
+    };
+    async_batch_del(keys, std::move(callback), timeout_milliseconds);
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::async_batch_del(const std::vector<batch_key> &keys,
+                                          async_batch_del_callback_t &&callback,
+                                          int timeout_milliseconds)
+{
+    auto ctx = std::make_shared<batch_context<int>>();
+    ctx->results.resize(keys.size(), PERR_OK);
+    ctx->callback = std::move(callback);
+
+    int ret = check_batch_hash_keys(keys);
+    if (ret != PERR_OK || keys.empty()) {
+        std::fill(ctx->results.begin(), ctx->results.end(), ret);
+        ctx->set_error(ret);
+        ctx->pending_count = 1;
+        ctx->finish_one();
+        return;
+    }
+
+    // group the keys by hash key, each group is deleted by one multi_remove rpc.
+    // the multi_remove rpcs of the same partition are batched into one write by the replica.
+    std::map<std::string, std::vector<size_t>> groups;
+    for (size_t i = 0; i < keys.size(); i++) {
+        groups[keys[i].hashkey].push_back(i);
+    }
+
+    // all the rpcs should be counted before any of them is sent
+    ctx->pending_count = groups.size();
+    for (auto &kv : groups) {
+        const std::string &hash_key = kv.first;
+        auto indexes = std::make_shared<std::vector<size_t>>(std::move(kv.second));
+
+        ::dsn::apps::multi_remove_request req;
+        req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+        req.sort_keys.reserve(indexes->size());
+        for (size_t index : *indexes) {
+            const std::string &sort_key = keys[index].sortkey;
+            req.sort_keys.emplace_back(sort_key.data(), 0, sort_key.size());
+        }
+
+        ::dsn::blob tmp_key;
+        pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
+        auto partition_hash = pegasus_key_hash(tmp_key);
+        auto new_callback = [ctx, indexes](
+            ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+        {
+            ::dsn::apps::multi_remove_response response;
+            if (err == ::dsn::ERR_OK) {
+                ::dsn::unmarshall(resp, response);
+            }
+            int error = get_client_error(
+                (err == ::dsn::ERR_OK) ? get_rocksdb_server_error(response.error) : int(err));
+            if (error != PERR_OK) {
+                for (size_t index : *indexes) {
+                    ctx->results[index] = error;
+                }
+                ctx->set_error(error);
+            }
+            ctx->finish_one();
+        };
+        _client->multi_remove(req,
+                              std::move(new_callback),
+                              std::chrono::milliseconds(timeout_milliseconds),
+                              partition_hash);
+    }
+}
+
+int pegasus_client_impl::query_partition_config(configuration_query_by_index_response &response,
+                                                int timeout_milliseconds)
+{
+    auto callback = [&response](
+        ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+    {
+        if (err == ERR_OK) {
+            ::dsn::unmarshall(resp, response);
+        } else {
+            response.err = err;
+        }
+    };
+    configuration_query_by_index_request req;
+    req.app_name = _app_name;
+    ::dsn::rpc::call(_meta_server,
+                     RPC_CM_QUERY_PARTITION_CONFIG_BY_INDEX,
+                     req,
+                     nullptr,
+                     std::move(callback),
+                     std::chrono::milliseconds(timeout_milliseconds),
+                     0,
+                     0)
+        ->wait();
+    if (response.err != ERR_OK) {
+        derror("query partition config of app %s failed: %s",
+               _app_name.c_str(),
+               response.err.to_string());
+        return get_client_error(int(response.err));
+    }
+    return PERR_OK;
+}
+
+void pegasus_client_impl::async_get_partition_count(
+    std::function<void(int, int32_t, int)> &&callback, int timeout_milliseconds)
+{
+    int32_t app_id = 0;
+    int partition_count = 0;
+    if (unpack_partition_config(_partition_config.load(), app_id, partition_count)) {
+        callback(PERR_OK, app_id, partition_count);
+        return;
+    }
+
+    auto new_callback = [this, user_callback = std::move(callback)](
+        ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+    {
+        configuration_query_by_index_response response;
+        if (err == ERR_OK) {
+            ::dsn::unmarshall(resp, response);
+        } else {
+            response.err = err;
+        }
+        if (response.err != ERR_OK) {
+            derror("query partition config of app %s failed: %s",
+                   _app_name.c_str(),
+                   response.err.to_string());
+            user_callback(get_client_error(int(response.err)), 0, 0);
+            return;
+        }
+        _partition_config.store(
+            pack_partition_config(response.app_id, response.partition_count));
+        user_callback(PERR_OK, response.app_id, response.partition_count);
+    };
+    configuration_query_by_index_request req;
+    req.app_name = _app_name;
+    ::dsn::rpc::call(_meta_server,
+                     RPC_CM_QUERY_PARTITION_CONFIG_BY_INDEX,
+                     req,
+                     nullptr,
+                     std::move(new_callback),
+                     std::chrono::milliseconds(timeout_milliseconds),
+                     0,
+                     0);
+}
+
+int pegasus_client_impl::get_partition_count(int &partition_count, int timeout_milliseconds)
+{
+    int32_t app_id = 0;
+    return get_partition_count(app_id, partition_count, timeout_milliseconds);
+}
+
+int pegasus_client_impl::get_partition_count(int32_t &app_id,
+                                             int &partition_count,
+                                             int timeout_milliseconds)
+{
+    if (unpack_partition_config(_partition_config.load(), app_id, partition_count)) {
+        return PERR_OK;
+    }
+
+    configuration_query_by_index_response response;
+    int ret = query_partition_config(response, timeout_milliseconds);
+    if (ret != PERR_OK) {
+        return ret;
+    }
+
+    app_id = response.app_id;
+    partition_count = response.partition_count;
+    _partition_config.store(pack_partition_config(app_id, partition_count));
+    return PERR_OK;
+}
+
+void pegasus_client_impl::invalidate_partition_count(int32_t app_id, int partition_count)
+{
+    uint64_t config = pack_partition_config(app_id, partition_count);
+    if (_partition_config.compare_exchange_strong(config, 0)) {
+        dwarn("the partition count %d of app %s (%d) is stale, query it again",
+              partition_count,
+              _app_name.c_str(),
+              app_id);
+    }
+}
+
+bool pegasus_client_impl::is_partition_count_stale(::dsn::error_code err)
+{
+    // ERR_OBJECT_NOT_FOUND: the app is dropped or recreated, or the partition doesn't exist
+    // ERR_PARENT_PARTITION_MISUSED: the partitions are split
+    return err == ::dsn::ERR_OBJECT_NOT_FOUND || err == ::dsn::ERR_PARENT_PARTITION_MISUSED;
+}
+
 int pegasus_client_impl::exist(const std::string &hash_key,
                                const std::string &sort_key,
                                int timeout_milliseconds,
@@ -548,7 +1238,8 @@ int pegasus_client_impl::exist(const std::string &hash_key,
 int pegasus_client_impl::sortkey_count(const std::string &hash_key,
                                        int64_t &count,
                                        int timeout_milliseconds,
-                                       internal_info *info)
+                                       internal_info *info,
+                                       bool approximate)
 {
     // check params
     if (hash_key.size() == 0) {
@@ -564,9 +1255,19 @@ int pegasus_client_impl::sortkey_count(const std::string &hash_key,
     ::dsn::blob tmp_key;
     pegasus_generate_key(tmp_key, hash_key, std::string());
     auto partition_hash = pegasus_key_hash(tmp_key);
-    auto pr = _client->sortkey_count_sync(::dsn::blob(hash_key.data(), 0, hash_key.length()),
-                                          std::chrono::milliseconds(timeout_milliseconds),
-                                          partition_hash);
+    std::pair<::dsn::error_code, ::dsn::apps::count_response> pr;
+    if (approximate) {
+        ::dsn::apps::count_request req;
+        req.hash_key.assign(hash_key.c_str(), 0, hash_key.size());
+        req.mode = ::dsn::apps::count_mode::CM_APPROXIMATE;
+        pr = _client->sortkey_count_v2_sync(
+            req, std::chrono::milliseconds(timeout_milliseconds), partition_hash);
+    } else {
+        // use the original rpc for exact count to be compatible with old servers
+        pr = _client->sortkey_count_sync(::dsn::blob(hash_key.data(), 0, hash_key.length()),
+                                         std::chrono::milliseconds(timeout_milliseconds),
+                                         partition_hash);
+    }
     if (pr.first == ERR_OK && pr.second.error == 0) {
         count = pr.second.count;
     }
@@ -730,6 +1431,161 @@ void pegasus_client_impl::async_multi_del(const std::string &hash_key,
                           partition_hash);
 }
 
+int pegasus_client_impl::delete_range(const std::string &hash_key,
+                                      const std::string &start_sort_key,
+                                      const std::string &stop_sort_key,
+                                      bool start_inclusive,
+                                      bool stop_inclusive,
+                                      int timeout_milliseconds,
+                                      internal_info *info)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err, internal_info &&_info) {
+        ret = err;
+        if (info != nullptr)
+            (*info) = std::move(_info);
+        op_completed.notify();
+    };
+    async_delete_range(hash_key,
+                       start_sort_key,
+                       stop_sort_key,
+                       start_inclusive,
+                       stop_inclusive,
+                       std::move(callback),
+                       timeout_milliseconds);
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::async_delete_range(const std::string &hash_key,
+                                             const std::string &start_sort_key,
+                                             const std::string &stop_sort_key,
+                                             bool start_inclusive,
+                                             bool stop_inclusive,
+                                             async_del_callback_t &&callback,
+                                             int timeout_milliseconds)
+{
+    // check params
+    if (hash_key.size() == 0) {
+        derror("invalid hash key: hash key should not be empty for delete_range");
+        if (callback != nullptr)
+            callback(PERR_INVALID_HASH_KEY, internal_info());
+        return;
+    }
+    if (hash_key.size() >= UINT16_MAX) {
+        derror("invalid hash key: hash key length should be less than UINT16_MAX, but %d",
+               (int)hash_key.size());
+        if (callback != nullptr)
+            callback(PERR_INVALID_HASH_KEY, internal_info());
+        return;
+    }
+
+    ::dsn::apps::delete_range_request req;
+    req.hash_key = ::dsn::blob(hash_key.data(), 0, hash_key.size());
+    req.start_sort_key = ::dsn::blob(start_sort_key.data(), 0, start_sort_key.size());
+    req.start_inclusive = start_inclusive;
+    req.stop_sort_key = ::dsn::blob(stop_sort_key.data(), 0, stop_sort_key.size());
+    req.stop_inclusive = stop_inclusive;
+    req.clear_partition = false;
+    req.partition_index = 0;
+
+    ::dsn::blob tmp_key;
+    pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
+    auto partition_hash = pegasus_key_hash(tmp_key);
+
+    auto new_callback = [user_callback = std::move(callback)](
+        ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+    {
+        if (user_callback == nullptr) {
+            return;
+        }
+        ::dsn::apps::update_response response;
+        internal_info info;
+        if (err == ::dsn::ERR_OK) {
+            ::dsn::unmarshall(resp, response);
+            info.app_id = response.app_id;
+            info.partition_index = response.partition_index;
+            info.decree = response.decree;
+            info.server = response.server;
+        }
+        int ret =
+            get_client_error(err == ERR_OK ? get_rocksdb_server_error(response.error) : int(err));
+        user_callback(ret, std::move(info));
+    };
+    _client->delete_range(req,
+                          std::move(new_callback),
+                          std::chrono::milliseconds(timeout_milliseconds),
+                          partition_hash);
+}
+
+int pegasus_client_impl::clear_partition(int partition_index,
+                                         int timeout_milliseconds,
+                                         internal_info *info)
+{
+    int partition_count = 0;
+    int ret = get_partition_count(partition_count, timeout_milliseconds);
+    if (ret != PERR_OK) {
+        return ret;
+    }
+    if (partition_index < 0 || partition_index >= partition_count) {
+        derror("invalid partition index: %d, partition count is %d",
+               partition_index,
+               partition_count);
+        return PERR_INVALID_ARGUMENT;
+    }
+
+    ::dsn::apps::delete_range_request req;
+    req.clear_partition = true;
+    req.partition_index = partition_index;
+
+    // the request is routed to the partition of `partition_hash % partition_count`
+    auto pr = _client->delete_range_sync(
+        req, std::chrono::milliseconds(timeout_milliseconds), partition_index);
+    if (pr.first == ERR_OK && info != nullptr) {
+        info->app_id = pr.second.app_id;
+        info->partition_index = pr.second.partition_index;
+        info->decree = pr.second.decree;
+        info->server = pr.second.server;
+    }
+    return get_client_error(pr.first == ERR_OK ? get_rocksdb_server_error(pr.second.error)
+                                               : int(pr.first));
+}
+
+int pegasus_client_impl::ingest_partition(int partition_index,
+                                          const std::string &dir,
+                                          int timeout_milliseconds,
+                                          internal_info *info)
+{
+    int partition_count = 0;
+    int ret = get_partition_count(partition_count, timeout_milliseconds);
+    if (ret != PERR_OK) {
+        return ret;
+    }
+    if (partition_index < 0 || partition_index >= partition_count) {
+        derror("invalid partition index: %d, partition count is %d",
+               partition_index,
+               partition_count);
+        return PERR_INVALID_ARGUMENT;
+    }
+
+    ::dsn::apps::ingest_request req;
+    req.dir = dir;
+    req.partition_index = partition_index;
+
+    // the request is routed to the partition of `partition_hash % partition_count`
+    auto pr = _client->ingest_sync(
+        req, std::chrono::milliseconds(timeout_milliseconds), partition_index);
+    if (pr.first == ERR_OK && info != nullptr) {
+        info->app_id = pr.second.app_id;
+        info->partition_index = pr.second.partition_index;
+        info->decree = pr.second.decree;
+        info->server = pr.second.server;
+    }
+    return get_client_error(pr.first == ERR_OK ? get_rocksdb_server_error(pr.second.error)
+                                               : int(pr.first));
+}
+
 int pegasus_client_impl::incr(const std::string &hash_key,
                               const std::string &sort_key,
                               int64_t increment,
@@ -861,9 +1717,7 @@ void pegasus_client_impl::async_check_and_set(const std::string &hash_key,
         return;
     }
 
-    if (dsn::apps::_cas_check_type_VALUES_TO_NAMES.find(check_type) ==
-        dsn::apps::_cas_check_type_VALUES_TO_NAMES.end()) {
-        derror("invalid check type: %d", (int)check_type);
+    if (!is_check_type_valid(check_type, options.extra_conditions)) {
         if (callback != nullptr)
             callback(PERR_INVALID_ARGUMENT, check_and_set_results(), internal_info());
         return;
@@ -884,6 +1738,7 @@ void pegasus_client_impl::async_check_and_set(const std::string &hash_key,
     else
         req.set_expire_ts_seconds = options.set_value_ttl_seconds + utils::epoch_now();
     req.return_check_value = options.return_check_value;
+    fill_extra_conditions(options.extra_conditions, req.extra_conditions);
 
     ::dsn::blob tmp_key;
     pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
@@ -914,6 +1769,8 @@ void pegasus_client_impl::async_check_and_set(const std::string &hash_key,
                     results.check_value.assign(response.check_value.data(),
                                                response.check_value.length());
                 }
+                fill_extra_check_values(response.extra_check_values,
+                                        results.extra_check_values);
             }
             info.app_id = response.app_id;
             info.partition_index = response.partition_index;
@@ -924,10 +1781,19 @@ void pegasus_client_impl::async_check_and_set(const std::string &hash_key,
             get_client_error(err == ERR_OK ? get_rocksdb_server_error(response.error) : int(err));
         user_callback(ret, std::move(results), std::move(info));
     };
-    _client->check_and_set(req,
-                           std::move(new_callback),
-                           std::chrono::milliseconds(timeout_milliseconds),
-                           partition_hash);
+    if (req.extra_conditions.empty()) {
+        _client->check_and_set(req,
+                               std::move(new_callback),
+                               std::chrono::milliseconds(timeout_milliseconds),
+                               partition_hash);
+    } else {
+        // the old servers ignore extra_conditions, so the request is sent by the new rpc code,
+        // which they reject
+        _client->check_and_set_v2(req,
+                                  std::move(new_callback),
+                                  std::chrono::milliseconds(timeout_milliseconds),
+                                  partition_hash);
+    }
 }
 
 int pegasus_client_impl::check_and_mutate(const std::string &hash_key,
@@ -979,9 +1845,7 @@ void pegasus_client_impl::async_check_and_mutate(const std::string &hash_key,
         return;
     }
 
-    if (dsn::apps::_cas_check_type_VALUES_TO_NAMES.find(check_type) ==
-        dsn::apps::_cas_check_type_VALUES_TO_NAMES.end()) {
-        derror("invalid check type: %d", (int)check_type);
+    if (!is_check_type_valid(check_type, options.extra_conditions)) {
         if (callback != nullptr)
             callback(PERR_INVALID_ARGUMENT, check_and_mutate_results(), internal_info());
         return;
@@ -1014,6 +1878,7 @@ void pegasus_client_impl::async_check_and_mutate(const std::string &hash_key,
     }
 
     req.return_check_value = options.return_check_value;
+    fill_extra_conditions(options.extra_conditions, req.extra_conditions);
 
     ::dsn::blob tmp_key;
     pegasus_generate_key(tmp_key, req.hash_key, ::dsn::blob());
@@ -1044,6 +1909,8 @@ void pegasus_client_impl::async_check_and_mutate(const std::string &hash_key,
                     results.check_value.assign(response.check_value.data(),
                                                response.check_value.length());
                 }
+                fill_extra_check_values(response.extra_check_values,
+                                        results.extra_check_values);
             }
             info.app_id = response.app_id;
             info.partition_index = response.partition_index;
@@ -1054,10 +1921,19 @@ void pegasus_client_impl::async_check_and_mutate(const std::string &hash_key,
             get_client_error(err == ERR_OK ? get_rocksdb_server_error(response.error) : int(err));
         user_callback(ret, std::move(results), std::move(info));
     };
-    _client->check_and_mutate(req,
-                              std::move(new_callback),
-                              std::chrono::milliseconds(timeout_milliseconds),
-                              partition_hash);
+    if (req.extra_conditions.empty()) {
+        _client->check_and_mutate(req,
+                                  std::move(new_callback),
+                                  std::chrono::milliseconds(timeout_milliseconds),
+                                  partition_hash);
+    } else {
+        // the old servers ignore extra_conditions, so the request is sent by the new rpc code,
+        // which they reject
+        _client->check_and_mutate_v2(req,
+                                     std::move(new_callback),
+                                     std::chrono::milliseconds(timeout_milliseconds),
+                                     partition_hash);
+    }
 }
 
 int pegasus_client_impl::ttl(const std::string &hash_key,
@@ -1188,32 +2064,73 @@ void pegasus_client_impl::async_get_unordered_scanners(
         return;
     }
 
-    auto new_callback = [ user_callback = std::move(callback), max_split_count, options, this ](
+    auto user_callback =
+        std::make_shared<async_get_unordered_scanners_callback_t>(std::move(callback));
+    auto new_callback = [user_callback, max_split_count, options, this](
         ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
     {
-        std::vector<pegasus_scanner *> scanners;
         configuration_query_by_index_response response;
         if (err == ERR_OK) {
             ::dsn::unmarshall(resp, response);
-            if (response.err == ERR_OK) {
-                unsigned int count = response.partition_count;
-                int split = count < max_split_count ? count : max_split_count;
-                scanners.resize(split);
-
-                int size = count / split;
-                int more = count - size * split;
-
-                for (int i = 0; i < split; i++) {
-                    int s = size + (i < more);
-                    std::vector<uint64_t> hash(s);
-                    for (int j = 0; j < s; j++)
-                        hash[j] = --count;
-                    scanners[i] = new pegasus_scanner_impl(_client, std::move(hash), options);
-                }
-            }
         }
         int ret = get_client_error(err == ERR_OK ? int(response.err) : int(err));
-        user_callback(ret, std::move(scanners));
+        if (ret != PERR_OK) {
+            (*user_callback)(ret, std::vector<pegasus_scanner *>());
+            return;
+        }
+
+        int partition_count = response.partition_count;
+        if (options.split_count_per_partition <= 1) {
+            (*user_callback)(PERR_OK,
+                             create_unordered_scanners(
+                                 max_split_count,
+                                 options,
+                                 std::vector<std::vector<::dsn::blob>>(partition_count)));
+            return;
+        }
+
+        // query the split keys of all the partitions concurrently, the scanners are created
+        // after all the queries are finished
+        auto split_keys = std::make_shared<std::vector<std::vector<::dsn::blob>>>(partition_count);
+        auto pending_count = std::make_shared<std::atomic<int>>(partition_count);
+        ::dsn::apps::get_split_keys_request split_req;
+        split_req.split_count = options.split_count_per_partition;
+        for (int i = 0; i < partition_count; i++) {
+            auto split_callback = [user_callback,
+                                   max_split_count,
+                                   options,
+                                   this,
+                                   split_keys,
+                                   pending_count,
+                                   i](
+                ::dsn::error_code err, dsn::message_ex * req, dsn::message_ex * resp)
+            {
+                ::dsn::apps::get_split_keys_response response;
+                if (err == ERR_OK) {
+                    ::dsn::unmarshall(resp, response);
+                }
+                if (err == ERR_OK && response.error == 0) {
+                    (*split_keys)[i] = std::move(response.split_keys);
+                } else {
+                    // the partition is scanned as a whole, e.g. the server doesn't support
+                    // get_split_keys
+                    dwarn("get split keys of partition %d of app %s failed: %s",
+                          i,
+                          _app_name.c_str(),
+                          get_error_string(get_client_error(
+                              err == ERR_OK ? get_rocksdb_server_error(response.error)
+                                            : int(err))));
+                }
+                if (pending_count->fetch_sub(1) == 1) {
+                    (*user_callback)(
+                        PERR_OK, create_unordered_scanners(max_split_count, options, *split_keys));
+                }
+            };
+            _client->get_split_keys(split_req,
+                                    std::move(split_callback),
+                                    std::chrono::milliseconds(options.timeout_ms),
+                                    i);
+        }
     };
 
     configuration_query_by_index_request req;
@@ -1228,6 +2145,49 @@ void pegasus_client_impl::async_get_unordered_scanners(
                      0);
 }
 
+std::vector<pegasus_client::pegasus_scanner *> pegasus_client_impl::create_unordered_scanners(
+    int max_split_count,
+    const scan_options &options,
+    const std::vector<std::vector<::dsn::blob>> &split_keys)
+{
+    // the key ranges of the partitions are interleaved, so that the scanners working at the
+    // same time spread among the partitions
+    size_t max_range_count = 0;
+    for (const auto &keys : split_keys) {
+        max_range_count = std::max(max_range_count, keys.size() + 1);
+    }
+    std::vector<pegasus_scanner_impl::split_range> ranges;
+    for (size_t j = 0; j < max_range_count; j++) {
+        for (size_t i = 0; i < split_keys.size(); i++) {
+            // the partition i is split into keys.size() + 1 ranges
+            const std::vector<::dsn::blob> &keys = split_keys[i];
+            if (j > keys.size()) {
+                continue;
+            }
+            pegasus_scanner_impl::split_range range;
+            range.hash = i;
+            if (j > 0) {
+                range.start_key = keys[j - 1];
+            }
+            if (j < keys.size()) {
+                range.stop_key = keys[j];
+            }
+            ranges.emplace_back(std::move(range));
+        }
+    }
+    // the ranges are taken from the back
+    std::reverse(ranges.begin(), ranges.end());
+
+    size_t split = std::min(ranges.size(), static_cast<size_t>(max_split_count));
+    auto splits = std::make_shared<pegasus_scanner_impl::shared_splits>();
+    splits->ranges = std::move(ranges);
+    std::vector<pegasus_scanner *> scanners(split);
+    for (size_t i = 0; i < split; i++) {
+        scanners[i] = new pegasus_scanner_impl(_client, std::vector<uint64_t>(), options, splits);
+    }
+    return scanners;
+}
+
 int pegasus_client_impl::get_unordered_scanners(int max_split_count,
                                                 const scan_options &options,
                                                 std::vector<pegasus_scanner *> &scanners)
@@ -1244,6 +2204,139 @@ int pegasus_client_impl::get_unordered_scanners(int max_split_count,
     return ret;
 }
 
+int pegasus_client_impl::parallel_scan(const scan_options &options,
+                                       const parallel_scan_options &parallel_options,
+                                       parallel_scan_consumer_t &&consumer)
+{
+    // check params
+    if (parallel_options.worker_count <= 0) {
+        derror("invalid worker_count: which should be greater than 0, but %d",
+               parallel_options.worker_count);
+        return PERR_INVALID_ARGUMENT;
+    }
+    if (!consumer) {
+        derror("invalid consumer: which should not be empty");
+        return PERR_INVALID_ARGUMENT;
+    }
+
+    configuration_query_by_index_response config;
+    int ret = query_partition_config(config, options.timeout_ms);
+    if (ret != PERR_OK) {
+        return ret;
+    }
+
+    // the primary replica server of each partition, which is invalid if unknown
+    std::vector<rpc_address> partition_servers(config.partition_count);
+    for (const auto &pc : config.partitions) {
+        int partition_index = pc.pid.get_partition_index();
+        if (partition_index >= 0 && partition_index < config.partition_count) {
+            partition_servers[partition_index] = pc.primary;
+        }
+    }
+    // the partitions not scanned yet, grouped by the replica server
+    std::map<rpc_address, std::deque<int>> pending_partitions;
+    for (int i = 0; i < config.partition_count; i++) {
+        pending_partitions[partition_servers[i]].push_back(i);
+    }
+
+    // the batches fetched by the workers, which are consumed in the caller's thread
+    struct scan_batch
+    {
+        int partition_index;
+        int error;
+        std::vector<kv_view> kvs;
+    };
+    struct scan_state
+    {
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::deque<scan_batch> batches;
+    };
+    auto state = std::make_shared<scan_state>();
+    auto fetch_next_batch = [state](int partition_index, const pegasus_scanner_wrapper &scanner) {
+        scanner->async_next_batch(
+            [state, partition_index](int err, std::vector<kv_view> &&kvs, internal_info &&info) {
+                std::lock_guard<std::mutex> l(state->mutex);
+                state->batches.push_back({partition_index, err, std::move(kvs)});
+                state->cond.notify_one();
+            });
+    };
+
+    // the partitions being scanned, each of which is scanned by one worker
+    std::map<int, pegasus_scanner_wrapper> scanners;
+    std::map<rpc_address, int> server_scan_counts;
+    const size_t worker_count = parallel_options.worker_count;
+    const int max_scans_per_server = parallel_options.max_scans_per_server;
+    while (true) {
+        // assign the pending partitions to the idle workers, the servers take turns so that
+        // the scans are spread among the servers
+        bool assigned = true;
+        while (assigned && scanners.size() < worker_count) {
+            assigned = false;
+            for (auto iter = pending_partitions.begin();
+                 iter != pending_partitions.end() && scanners.size() < worker_count;) {
+                int &scan_count = server_scan_counts[iter->first];
+                if (max_scans_per_server > 0 && scan_count >= max_scans_per_server &&
+                    !iter->first.is_invalid()) {
+                    ++iter;
+                    continue;
+                }
+                int partition_index = iter->second.front();
+                iter->second.pop_front();
+                if (iter->second.empty()) {
+                    iter = pending_partitions.erase(iter);
+                } else {
+                    ++iter;
+                }
+                ++scan_count;
+                assigned = true;
+
+                std::vector<uint64_t> hash(1, partition_index);
+                pegasus_scanner_wrapper scanner =
+                    (new pegasus_scanner_impl(_client, std::move(hash), options))
+                        ->get_smart_wrapper();
+                scanners.emplace(partition_index, scanner);
+                fetch_next_batch(partition_index, scanner);
+            }
+        }
+        if (scanners.empty()) {
+            // all completed
+            return PERR_OK;
+        }
+
+        scan_batch batch;
+        {
+            std::unique_lock<std::mutex> l(state->mutex);
+            state->cond.wait(l, [&state]() { return !state->batches.empty(); });
+            batch = std::move(state->batches.front());
+            state->batches.pop_front();
+        }
+
+        auto iter = scanners.find(batch.partition_index);
+        dassert(iter != scanners.end(), "partition %d is not being scanned", batch.partition_index);
+        if (batch.error == PERR_SCAN_COMPLETE) {
+            // the worker becomes idle
+            scanners.erase(iter);
+            --server_scan_counts[partition_servers[batch.partition_index]];
+            continue;
+        }
+        if (batch.error != PERR_OK) {
+            derror("scan partition %d of app %s failed: %s",
+                   batch.partition_index,
+                   _app_name.c_str(),
+                   get_error_string(batch.error));
+            // the scanners with rpcs in flight are released after their rpcs are finished
+            return batch.error;
+        }
+
+        // fetch the next batch while the current one is being consumed
+        fetch_next_batch(batch.partition_index, iter->second);
+        if (!consumer(std::move(batch.kvs))) {
+            return PERR_OK;
+        }
+    }
+}
+
 void pegasus_client_impl::async_duplicate(dsn::apps::duplicate_rpc rpc,
                                           std::function<void(dsn::error_code)> &&callback,
                                           dsn::task_tracker *tracker)
@@ -1276,6 +2369,7 @@ const char *pegasus_client_impl::get_error_string(int error_code) const
     _server_error_to_client[::dsn::ERR_HANDLER_NOT_FOUND] = PERR_HANDLER_NOT_FOUND;
     _server_error_to_client[::dsn::ERR_OPERATION_DISABLED] = PERR_OPERATION_DISABLED;
     _server_error_to_client[::dsn::ERR_NOT_ENOUGH_MEMBER] = PERR_NOT_ENOUGH_MEMBER;
+    _server_error_to_client[::dsn::ERR_PARENT_PARTITION_MISUSED] = PERR_SERVER_CHANGED;
 
     _server_error_to_client[::dsn::ERR_APP_NOT_EXIST] = PERR_APP_NOT_EXIST;
     _server_error_to_client[::dsn::ERR_APP_EXIST] = PERR_APP_EXIST;
@@ -1302,5 +2396,53 @@ const char *pegasus_client_impl::get_error_string(int error_code) const
 {
     return (rocskdb_error == 0) ? 0 : ROCSKDB_ERROR_START - rocskdb_error;
 }
+
+/*static*/ bool
+pegasus_client_impl::is_check_type_valid(cas_check_type check_type,
+                                         const std::vector<check_condition> &extra_conditions)
+{
+    if (dsn::apps::_cas_check_type_VALUES_TO_NAMES.find(check_type) ==
+        dsn::apps::_cas_check_type_VALUES_TO_NAMES.end()) {
+        derror("invalid check type: %d", (int)check_type);
+        return false;
+    }
+    for (const check_condition &cond : extra_conditions) {
+        if (dsn::apps::_cas_check_type_VALUES_TO_NAMES.find(cond.check_type) ==
+            dsn::apps::_cas_check_type_VALUES_TO_NAMES.end()) {
+            derror("invalid check type of extra condition: %d", (int)cond.check_type);
+            return false;
+        }
+    }
+    return true;
+}
+
+/*static*/ void
+pegasus_client_impl::fill_extra_conditions(const std::vector<check_condition> &extra_conditions,
+                                           std::vector<::dsn::apps::cas_condition> &req_conditions)
+{
+    req_conditions.resize(extra_conditions.size());
+    for (size_t i = 0; i < extra_conditions.size(); ++i) {
+        const check_condition &cond = extra_conditions[i];
+        req_conditions[i].check_sort_key.assign(
+            cond.check_sort_key.c_str(), 0, cond.check_sort_key.size());
+        req_conditions[i].check_type = (dsn::apps::cas_check_type::type)cond.check_type;
+        req_conditions[i].check_operand.assign(
+            cond.check_operand.c_str(), 0, cond.check_operand.size());
+    }
+}
+
+/*static*/ void pegasus_client_impl::fill_extra_check_values(
+    const std::vector<::dsn::apps::cas_check_value> &resp_values,
+    std::vector<check_value_result> &extra_check_values)
+{
+    extra_check_values.resize(resp_values.size());
+    for (size_t i = 0; i < resp_values.size(); ++i) {
+        if (resp_values[i].exist) {
+            extra_check_values[i].exist = true;
+            extra_check_values[i].value.assign(resp_values[i].value.data(),
+                                               resp_values[i].value.length());
+        }
+    }
+}
 } // namespace client
 } // namespace pegasus
@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <string>
 #include <pegasus/client.h>
 #include <rrdb/rrdb.client.h>
 #include <dsn/tool-api/zlocks.h>
+#include <dsn/cpp/serialization_helper/dsn.layer2_types.h>
 #include "base/pegasus_key_schema.h"
 #include "base/pegasus_utils.h"
 
@@ -108,6 +111,36 @@ public:
                                           int max_fetch_size = 1000000,
                                           int timeout_milliseconds = 5000) override;
 
+    virtual int batch_multi_get(const std::vector<batch_multi_get_item> &items,
+                                std::vector<batch_multi_get_result> &results,
+                                int max_fetch_count = 100,
+                                int max_fetch_size = 1000000,
+                                int timeout_milliseconds = 5000) override;
+
+    virtual int batch_get(const std::vector<batch_key> &keys,
+                          std::vector<batch_get_result> &results,
+                          int timeout_milliseconds = 5000) override;
+
+    virtual void async_batch_get(const std::vector<batch_key> &keys,
+                                 async_batch_get_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) override;
+
+    virtual int batch_set(const std::vector<batch_set_item> &items,
+                          std::vector<int> &errors,
+                          int timeout_milliseconds = 5000) override;
+
+    virtual void async_batch_set(const std::vector<batch_set_item> &items,
+                                 async_batch_set_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) override;
+
+    virtual int batch_del(const std::vector<batch_key> &keys,
+                          std::vector<int> &errors,
+                          int timeout_milliseconds = 5000) override;
+
+    virtual void async_batch_del(const std::vector<batch_key> &keys,
+                                 async_batch_del_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) override;
+
     virtual int exist(const std::string &hashkey,
                       const std::string &sortkey,
                       int timeout_milliseconds = 5000,
@@ -116,7 +149,8 @@ public:
     virtual int sortkey_count(const std::string &hashkey,
                               int64_t &count,
                               int timeout_milliseconds = 5000,
-                              internal_info *info = nullptr) override;
+                              internal_info *info = nullptr,
+                              bool approximate = false) override;
 
     virtual int del(const std::string &hashkey,
                     const std::string &sortkey,
@@ -139,6 +173,31 @@ public:
                                  async_multi_del_callback_t &&callback = nullptr,
                                  int timeout_milliseconds = 5000) override;
 
+    virtual int delete_range(const std::string &hashkey,
+                             const std::string &start_sortkey,
+                             const std::string &stop_sortkey,
+                             bool start_inclusive = true,
+                             bool stop_inclusive = false,
+                             int timeout_milliseconds = 5000,
+                             internal_info *info = nullptr) override;
+
+    virtual void async_delete_range(const std::string &hashkey,
+                                    const std::string &start_sortkey,
+                                    const std::string &stop_sortkey,
+                                    bool start_inclusive = true,
+                                    bool stop_inclusive = false,
+                                    async_del_callback_t &&callback = nullptr,
+                                    int timeout_milliseconds = 5000) override;
+
+    virtual int clear_partition(int partition_index,
+                                int timeout_milliseconds = 5000,
+                                internal_info *info = nullptr) override;
+
+    virtual int ingest_partition(int partition_index,
+                                 const std::string &dir,
+                                 int timeout_milliseconds = 60000,
+                                 internal_info *info = nullptr) override;
+
     virtual int incr(const std::string &hashkey,
                      const std::string &sortkey,
                      int64_t increment,
@@ -221,6 +280,10 @@ public:
                                  const scan_options &options,
                                  async_get_unordered_scanners_callback_t &&callback) override;
 
+    virtual int parallel_scan(const scan_options &options,
+                              const parallel_scan_options &parallel_options,
+                              parallel_scan_consumer_t &&consumer) override;
+
     /// \internal
     /// This is an internal function for duplication.
     /// \see pegasus::server::pegasus_mutation_duplicator
@@ -242,15 +305,37 @@ public:
 
         void async_next(async_scan_next_callback_t &&) override;
 
+        int next_batch(std::vector<kv_view> &kvs, internal_info *info = nullptr) override;
+
+        void async_next_batch(async_scan_next_batch_callback_t &&) override;
+
         bool safe_destructible() const override;
 
         pegasus_scanner_wrapper get_smart_wrapper() override;
 
         ~pegasus_scanner_impl() override;
 
+        // a key range of a partition, the empty keys mean the boundaries of the partition
+        struct split_range
+        {
+            uint64_t hash;
+            ::dsn::blob start_key; // inclusive
+            ::dsn::blob stop_key;  // exclusive
+        };
+
+        // the key ranges shared by the unordered scanners got by one get_unordered_scanners()
+        // call, from which a scanner takes the next range after its own partitions are
+        // completed, so that the scanners of the small ranges help to scan the rest ones
+        struct shared_splits
+        {
+            ::dsn::zlock lock;
+            std::vector<split_range> ranges;
+        };
+
         pegasus_scanner_impl(::dsn::apps::rrdb_client *client,
                              std::vector<uint64_t> &&hash,
-                             const scan_options &options);
+                             const scan_options &options,
+                             std::shared_ptr<shared_splits> splits = nullptr);
         pegasus_scanner_impl(::dsn::apps::rrdb_client *client,
                              std::vector<uint64_t> &&hash,
                              const scan_options &options,
@@ -263,21 +348,48 @@ public:
         ::dsn::blob _stop_key;
         scan_options _options;
         std::vector<uint64_t> _splits_hash;
+        std::shared_ptr<shared_splits> _shared_splits;
+
+        // the callback of async_next() or async_next_batch(), only one of which is set
+        struct scan_callback
+        {
+            explicit scan_callback(async_scan_next_callback_t &&cb) : next(std::move(cb)) {}
+            explicit scan_callback(async_scan_next_batch_callback_t &&cb)
+                : next_batch(std::move(cb))
+            {
+            }
+            async_scan_next_callback_t next;
+            async_scan_next_batch_callback_t next_batch;
+        };
 
         uint64_t _hash;
-        std::vector<::dsn::apps::key_value> _kvs;
+        // the batch being consumed, which is shared with the kv_views got by next_batch()
+        std::shared_ptr<std::vector<::dsn::apps::key_value>> _kvs;
         internal_info _info;
         int32_t _p;
 
         int64_t _context;
         mutable ::dsn::zlock _lock;
-        std::list<async_scan_next_callback_t> _queue;
+        std::list<scan_callback> _queue;
         volatile bool _rpc_started;
-
+        // true if the callbacks in `_queue` are waiting for the response of the in-flight rpc
+        bool _waiting_for_rpc;
+        // the error of the last rpc, which is returned after the fetched batches are consumed
+        int _rpc_error;
+        // the batches fetched ahead of `_kvs`, see scan_options::prefetch_batch_count
+        std::deque<std::vector<::dsn::apps::key_value>> _prefetched_kvs;
+        ::dsn::task_ptr _prefetch_task;
+
+        void _async_next(scan_callback &&callback);
         void _async_next_internal();
-        void _start_scan();
-        void _next_batch();
+        void _take_batch(std::vector<kv_view> &kvs);
+        static void
+        _complete(scan_callback &callback, int error_code, const internal_info &info);
+        void _prefetch_next_batch();
+        ::dsn::task_ptr _start_scan();
+        ::dsn::task_ptr _next_batch();
         void _on_scan_response(::dsn::error_code, dsn::message_ex *, dsn::message_ex *);
+        bool _next_split();
         void _split_reset();
 
     private:
@@ -306,13 +418,133 @@ private:
         {
             return _p->next(hashkey, sortkey, value, info);
         }
+
+        void async_next_batch(async_scan_next_batch_callback_t &&callback) override;
+
+        int next_batch(std::vector<kv_view> &kvs, internal_info *info) override
+        {
+            return _p->next_batch(kvs, info);
+        }
     };
 
+private:
+    // The shared state of batch_get, batch_set and batch_del, whose rpcs are sent concurrently.
+    // The last finished rpc invokes the callback with the first error of the keys.
+    template <typename TResult>
+    struct batch_context
+    {
+        std::vector<TResult> results;
+        std::atomic<int> error{PERR_OK};
+        std::atomic<size_t> pending_count{0};
+        std::function<void(int, std::vector<TResult> &&)> callback;
+
+        void set_error(int err)
+        {
+            int expected = PERR_OK;
+            error.compare_exchange_strong(expected, err);
+        }
+
+        void finish_one()
+        {
+            if (pending_count.fetch_sub(1) == 1 && callback != nullptr) {
+                callback(error.load(), std::move(results));
+            }
+        }
+    };
+
+    // create at most `max_split_count` unordered scanners, which share the key ranges of all
+    // the partitions, the partition i is split by `split_keys[i]`
+    std::vector<pegasus_scanner *>
+    create_unordered_scanners(int max_split_count,
+                              const scan_options &options,
+                              const std::vector<std::vector<::dsn::blob>> &split_keys);
+
+    // get the partition configurations of the app from meta server
+    int query_partition_config(::dsn::configuration_query_by_index_response &response,
+                               int timeout_milliseconds);
+
+    // get the partition count and the app id of the app from meta server, which are cached after
+    // the first query until they are invalidated
+    int get_partition_count(int &partition_count, int timeout_milliseconds);
+    int get_partition_count(int32_t &app_id, int &partition_count, int timeout_milliseconds);
+
+    // forget the cached partition count and app id if they are still `partition_count` and
+    // `app_id`, which are found stale by a request routed with them
+    void invalidate_partition_count(int32_t app_id, int partition_count);
+
+    // returns true if the error of a request routed by the cached partition count means that
+    // the partition count or the app id may be stale
+    static bool is_partition_count_stale(::dsn::error_code err);
+
+    static uint64_t pack_partition_config(int32_t app_id, int partition_count)
+    {
+        return static_cast<uint64_t>(static_cast<uint32_t>(app_id)) << 32 |
+               static_cast<uint32_t>(partition_count);
+    }
+
+    // returns false if `config` is not cached
+    static bool unpack_partition_config(uint64_t config, int32_t &app_id, int &partition_count)
+    {
+        app_id = static_cast<int32_t>(config >> 32);
+        partition_count = static_cast<int>(config & 0xffffffff);
+        return partition_count > 0;
+    }
+
+    // the non-blocking version of get_partition_count, `callback` is invoked with the error,
+    // the app id and the partition count, in place if they are cached
+    void async_get_partition_count(std::function<void(int, int32_t, int)> &&callback,
+                                   int timeout_milliseconds);
+
+    // the indexes of the keys of a batch_get, by hash key and sort key
+    typedef std::map<std::string, std::map<std::string, std::vector<size_t>>> batch_get_keys;
+
+    // group `keys` by partition and send a batch_multi_get rpc for each partition, which counts
+    // as one pending rpc of `ctx` until all the rpcs finish. The keys routed by a stale partition
+    // count or app id are sent again after refreshing them if `retry_if_stale` is true.
+    void send_batch_get(const std::shared_ptr<batch_get_keys> &keys,
+                        const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+                        int timeout_milliseconds,
+                        bool retry_if_stale);
+    void send_batch_get(const std::shared_ptr<batch_get_keys> &keys,
+                        int32_t app_id,
+                        int partition_count,
+                        const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+                        int timeout_milliseconds,
+                        bool retry_if_stale);
+
+    // fail all the keys of a batch_get with `error`
+    static void finish_batch_get(const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+                                 int error);
+
+    // fail `keys` of a batch_get with `error`, without finishing the rpc
+    static void fail_batch_get(const batch_get_keys &keys,
+                               const std::shared_ptr<batch_context<batch_get_result>> &ctx,
+                               int error);
+
+    // returns the error of the first invalid hash key in `keys`, or PERR_OK if all are valid
+    template <typename TKey>
+    static int check_batch_hash_keys(const std::vector<TKey> &keys);
+
+    // returns false and logs the error if `check_type` or the check type of any extra
+    // condition is invalid
+    static bool is_check_type_valid(cas_check_type check_type,
+                                    const std::vector<check_condition> &extra_conditions);
+
+    static void fill_extra_conditions(const std::vector<check_condition> &extra_conditions,
+                                      std::vector<::dsn::apps::cas_condition> &req_conditions);
+
+    static void
+    fill_extra_check_values(const std::vector<::dsn::apps::cas_check_value> &resp_values,
+                            std::vector<check_value_result> &extra_check_values);
+
 private:
     std::string _cluster_name;
     std::string _app_name;
     ::dsn::rpc_address _meta_server;
     ::dsn::apps::rrdb_client *_client;
+    // the app id in the high 32 bits and the partition count in the low 32 bits, updated together
+    // so that they are always consistent, 0 if they are not cached
+    std::atomic<uint64_t> _partition_config;
 
     ///
     /// \brief _client_error_to_string
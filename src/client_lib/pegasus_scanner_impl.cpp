@@ -11,11 +11,14 @@ using namespace pegasus;
 namespace pegasus {
 namespace client {
 
-pegasus_client_impl::pegasus_scanner_impl::pegasus_scanner_impl(::dsn::apps::rrdb_client *client,
-                                                                std::vector<uint64_t> &&hash,
-                                                                const scan_options &options)
+pegasus_client_impl::pegasus_scanner_impl::pegasus_scanner_impl(
+    ::dsn::apps::rrdb_client *client,
+    std::vector<uint64_t> &&hash,
+    const scan_options &options,
+    std::shared_ptr<shared_splits> splits)
     : pegasus_scanner_impl(client, std::move(hash), options, _min, _max)
 {
+    _shared_splits = std::move(splits);
     _options.start_inclusive = true;
     _options.stop_inclusive = false;
 }
@@ -30,9 +33,12 @@ pegasus_client_impl::pegasus_scanner_impl::pegasus_scanner_impl(::dsn::apps::rrd
       _stop_key(stop_key),
       _options(options),
       _splits_hash(std::move(hash)),
+      _kvs(std::make_shared<std::vector<::dsn::apps::key_value>>()),
       _p(-1),
       _context(SCAN_CONTEXT_ID_COMPLETED),
-      _rpc_started(false)
+      _rpc_started(false),
+      _waiting_for_rpc(false),
+      _rpc_error(PERR_OK)
 {
 }
 
@@ -60,6 +66,35 @@ int pegasus_client_impl::pegasus_scanner_impl::next(std::string &hashkey,
 }
 
 void pegasus_client_impl::pegasus_scanner_impl::async_next(async_scan_next_callback_t &&callback)
+{
+    _async_next(scan_callback(std::move(callback)));
+}
+
+int pegasus_client_impl::pegasus_scanner_impl::next_batch(std::vector<kv_view> &kvs,
+                                                          internal_info *info)
+{
+    ::dsn::utils::notify_event op_completed;
+    int ret = -1;
+    auto callback = [&](int err, std::vector<kv_view> &&batch, internal_info &&ii) {
+        ret = err;
+        kvs = std::move(batch);
+        if (info) {
+            (*info) = std::move(ii);
+        }
+        op_completed.notify();
+    };
+    async_next_batch(std::move(callback));
+    op_completed.wait();
+    return ret;
+}
+
+void pegasus_client_impl::pegasus_scanner_impl::async_next_batch(
+    async_scan_next_batch_callback_t &&callback)
+{
+    _async_next(scan_callback(std::move(callback)));
+}
+
+void pegasus_client_impl::pegasus_scanner_impl::_async_next(scan_callback &&callback)
 {
     _lock.lock();
     if (_queue.empty()) {
@@ -92,98 +127,188 @@ void pegasus_client_impl::pegasus_scanner_impl::_async_next_internal()
     // _lock will be locked out of the while block
     dassert(!_queue.empty(), "queue should not be empty when _async_next_internal start");
 
-    std::list<async_scan_next_callback_t> temp;
+    std::list<scan_callback> temp;
     while (true) {
-        while (++_p >= _kvs.size()) {
+        while (++_p >= _kvs->size()) {
+            if (!_prefetched_kvs.empty()) {
+                // switch to the prefetched batch, the consumed one may be still referred by
+                // the kv_views got by next_batch()
+                _kvs = std::make_shared<std::vector<::dsn::apps::key_value>>(
+                    std::move(_prefetched_kvs.front()));
+                _prefetched_kvs.pop_front();
+                _p = -1;
+                continue;
+            }
+
+            if (_rpc_started) {
+                // the next batch is being prefetched, callbacks will be executed when rpc
+                // finished
+                _waiting_for_rpc = true;
+                _lock.unlock();
+                return;
+            }
+
+            if (_rpc_error != PERR_OK) {
+                // error occured
+                int ret = _rpc_error;
+                _rpc_error = PERR_OK;
+                internal_info info = _info;
+                swap(_queue, temp);
+                _lock.unlock();
+                // ATTENTION: after unlock with empty queue, member variables can not be used
+                // anymore
+                for (auto &callback : temp) {
+                    _complete(callback, ret, info);
+                }
+                return;
+            }
+
             if (_context == SCAN_CONTEXT_ID_COMPLETED) {
                 // reach the end of one partition
-                if (_splits_hash.empty()) {
+                if (!_next_split()) {
                     // all completed
                     swap(_queue, temp);
                     _lock.unlock();
                     // ATTENTION: after unlock, member variables can not be used anymore
+                    internal_info info;
+                    info.app_id = -1;
+                    info.partition_index = -1;
+                    info.decree = -1;
                     for (auto &callback : temp) {
-                        if (callback) {
-                            internal_info info;
-                            info.app_id = -1;
-                            info.partition_index = -1;
-                            info.decree = -1;
-                            callback(PERR_SCAN_COMPLETE,
-                                     std::string(),
-                                     std::string(),
-                                     std::string(),
-                                     std::move(info));
-                        }
+                        _complete(callback, PERR_SCAN_COMPLETE, info);
                     }
                     return;
                 } else {
-                    _hash = _splits_hash.back();
-                    _splits_hash.pop_back();
                     _split_reset();
                 }
             } else if (_context == SCAN_CONTEXT_ID_NOT_EXIST) {
                 // no valid context_id found
+                _rpc_started = true;
+                _waiting_for_rpc = true;
                 _lock.unlock();
                 _start_scan();
                 return;
             } else {
                 // valid context_id
+                _rpc_started = true;
+                _waiting_for_rpc = true;
                 _lock.unlock();
                 _next_batch();
                 return;
             }
         }
 
-        // valid data got
-        std::string hash_key, sort_key;
-        pegasus_restore_key(_kvs[_p].key, hash_key, sort_key);
-        std::string value(_kvs[_p].value.data(), _kvs[_p].value.length());
+        // fetch the next batch ahead while the current batch is being consumed
+        _prefetch_next_batch();
 
+        // valid data got
         auto &callback = _queue.front();
-        if (callback) {
+        if (callback.next_batch) {
+            std::vector<kv_view> kvs;
+            _take_batch(kvs);
             internal_info info(_info);
             _lock.unlock();
-            callback(PERR_OK,
-                     std::move(hash_key),
-                     std::move(sort_key),
-                     std::move(value),
-                     std::move(info));
+            callback.next_batch(PERR_OK, std::move(kvs), std::move(info));
             _lock.lock();
-            if (_queue.size() == 1) {
-                // keep the last callback until exit this function
-                std::swap(temp, _queue);
-                _lock.unlock();
-                return;
-            } else {
-                _queue.pop_front();
-            }
+        } else if (callback.next) {
+            std::string hash_key, sort_key;
+            pegasus_restore_key((*_kvs)[_p].key, hash_key, sort_key);
+            std::string value((*_kvs)[_p].value.data(), (*_kvs)[_p].value.length());
+            internal_info info(_info);
+            _lock.unlock();
+            callback.next(PERR_OK,
+                          std::move(hash_key),
+                          std::move(sort_key),
+                          std::move(value),
+                          std::move(info));
+            _lock.lock();
+        } else {
+            continue;
+        }
+
+        if (_queue.size() == 1) {
+            // keep the last callback until exit this function
+            std::swap(temp, _queue);
+            _lock.unlock();
+            return;
+        } else {
+            _queue.pop_front();
         }
     }
 }
 
-void pegasus_client_impl::pegasus_scanner_impl::_next_batch()
+// takes all the remaining k-v of the current batch, _lock should be locked
+void pegasus_client_impl::pegasus_scanner_impl::_take_batch(std::vector<kv_view> &kvs)
+{
+    const std::vector<::dsn::apps::key_value> &batch = *_kvs;
+    kvs.reserve(batch.size() - _p);
+    for (; _p < batch.size(); ++_p) {
+        const ::dsn::apps::key_value &kv = batch[_p];
+        dsn::string_view hash_key, sort_key;
+        pegasus_restore_key(
+            dsn::string_view(kv.key.data(), kv.key.length()), hash_key, sort_key);
+        kvs.emplace_back();
+        kv_view &view = kvs.back();
+        view.hash_key = hash_key.data();
+        view.hash_key_length = hash_key.length();
+        view.sort_key = sort_key.data();
+        view.sort_key_length = sort_key.length();
+        view.value = kv.value.data();
+        view.value_length = kv.value.length();
+        view.holder = _kvs;
+    }
+    // the last k-v is consumed
+    _p = static_cast<int32_t>(batch.size()) - 1;
+}
+
+/*static*/ void pegasus_client_impl::pegasus_scanner_impl::_complete(scan_callback &callback,
+                                                                     int error_code,
+                                                                     const internal_info &info)
+{
+    if (callback.next_batch) {
+        callback.next_batch(error_code, std::vector<kv_view>(), internal_info(info));
+    } else if (callback.next) {
+        callback.next(
+            error_code, std::string(), std::string(), std::string(), internal_info(info));
+    }
+}
+
+// _lock should be locked
+void pegasus_client_impl::pegasus_scanner_impl::_prefetch_next_batch()
+{
+    if (_options.prefetch_batch_count <= 0 || _rpc_started || _rpc_error != PERR_OK ||
+        _context < SCAN_CONTEXT_ID_VALID_MIN ||
+        _prefetched_kvs.size() >= static_cast<size_t>(_options.prefetch_batch_count)) {
+        return;
+    }
+
+    _rpc_started = true;
+    _prefetch_task = _next_batch();
+}
+
+::dsn::task_ptr pegasus_client_impl::pegasus_scanner_impl::_next_batch()
 {
     ::dsn::apps::scan_request req;
     req.context_id = _context;
 
-    dassert(!_rpc_started, "");
-    _rpc_started = true;
-    _client->scan(req,
-                  [this](::dsn::error_code err,
-                         dsn::message_ex *req,
-                         dsn::message_ex *resp) mutable { _on_scan_response(err, req, resp); },
-                  std::chrono::milliseconds(_options.timeout_ms),
-                  _hash);
+    dassert(_rpc_started, "");
+    return _client->scan(
+        req,
+        [this](::dsn::error_code err, dsn::message_ex *req, dsn::message_ex *resp) mutable {
+            _on_scan_response(err, req, resp);
+        },
+        std::chrono::milliseconds(_options.timeout_ms),
+        _hash);
 }
 
-void pegasus_client_impl::pegasus_scanner_impl::_start_scan()
+::dsn::task_ptr pegasus_client_impl::pegasus_scanner_impl::_start_scan()
 {
     ::dsn::apps::get_scanner_request req;
-    if (_kvs.empty()) {
+    if (_kvs->empty()) {
         req.start_key = _start_key;
         req.start_inclusive = _options.start_inclusive;
     } else {
-        req.start_key = _kvs.back().key;
+        req.start_key = _kvs->back().key;
         req.start_inclusive = false;
     }
     req.stop_key = _stop_key;
@@ -196,10 +321,15 @@ void pegasus_client_impl::pegasus_scanner_impl::_start_scan()
     req.sort_key_filter_pattern = ::dsn::blob(
         _options.sort_key_filter_pattern.data(), 0, _options.sort_key_filter_pattern.size());
     req.no_value = _options.no_value;
+    req.bulk_scan = _options.bulk_scan;
+    req.value_filter_type = (dsn::apps::cas_check_type::type)_options.value_filter_type;
+    req.value_filter_operand = ::dsn::blob(
+        _options.value_filter_operand.data(), 0, _options.value_filter_operand.size());
+    req.value_offset = _options.value_offset;
+    req.value_length = _options.value_length;
 
-    dassert(!_rpc_started, "");
-    _rpc_started = true;
-    _client->get_scanner(
+    dassert(_rpc_started, "");
+    return _client->get_scanner(
         req,
         [this](::dsn::error_code err, dsn::message_ex *req, dsn::message_ex *resp) mutable {
             _on_scan_response(err, req, resp);
@@ -212,62 +342,96 @@ void pegasus_client_impl::pegasus_scanner_impl::_on_scan_response(::dsn::error_c
                                                                   dsn::message_ex *req,
                                                                   dsn::message_ex *resp)
 {
-    dassert(_rpc_started, "");
-    _rpc_started = false;
     ::dsn::apps::scan_response response;
     if (err == ERR_OK) {
         ::dsn::unmarshall(resp, response);
+    }
+
+    _lock.lock();
+    dassert(_rpc_started, "");
+    _rpc_started = false;
+    _prefetch_task = nullptr;
+    if (err == ERR_OK) {
         _info.app_id = response.app_id;
         _info.partition_index = response.partition_index;
         _info.decree = -1;
         _info.server = response.server;
 
         if (response.error == 0) {
-            _lock.lock();
-            _kvs = std::move(response.kvs);
-            _p = -1;
+            _prefetched_kvs.emplace_back(std::move(response.kvs));
             _context = response.context_id;
-            _async_next_internal();
-            return;
         } else if (get_rocksdb_server_error(response.error) == PERR_NOT_FOUND) {
-            _lock.lock();
             _context = SCAN_CONTEXT_ID_NOT_EXIST;
-            _async_next_internal();
-            return;
+        } else {
+            _rpc_error = get_client_error(get_rocksdb_server_error(response.error));
         }
     } else {
         _info.app_id = -1;
         _info.partition_index = -1;
         _info.decree = -1;
         _info.server = "";
+        _rpc_error = get_client_error(int(err));
     }
 
-    // error occured
-    auto ret =
-        get_client_error(err == ERR_OK ? get_rocksdb_server_error(response.error) : int(err));
-    internal_info info = _info;
-    std::list<async_scan_next_callback_t> temp;
-    _lock.lock();
-    std::swap(_queue, temp);
-    _lock.unlock();
-    // ATTENTION: after unlock with empty queue,  memebers variables can not be used anymore
+    if (!_waiting_for_rpc) {
+        // the batch is prefetched while the application is consuming the current one
+        _prefetch_next_batch();
+        _lock.unlock();
+        return;
+    }
+    _waiting_for_rpc = false;
+    _async_next_internal();
+}
 
-    for (auto &callback : temp) {
-        if (callback) {
-            callback(ret, std::string(), std::string(), std::string(), internal_info(info));
+// takes the next partition or key range to scan, returns false if all are completed
+bool pegasus_client_impl::pegasus_scanner_impl::_next_split()
+{
+    if (!_splits_hash.empty()) {
+        _hash = _splits_hash.back();
+        _splits_hash.pop_back();
+        return true;
+    }
+    if (_shared_splits != nullptr) {
+        ::dsn::zauto_lock l(_shared_splits->lock);
+        if (!_shared_splits->ranges.empty()) {
+            const split_range &range = _shared_splits->ranges.back();
+            _hash = range.hash;
+            _start_key = range.start_key.length() > 0 ? range.start_key : _min;
+            _stop_key = range.stop_key.length() > 0 ? range.stop_key : _max;
+            _shared_splits->ranges.pop_back();
+            return true;
         }
     }
+    return false;
 }
 
 void pegasus_client_impl::pegasus_scanner_impl::_split_reset()
 {
-    _kvs.clear();
+    _kvs = std::make_shared<std::vector<::dsn::apps::key_value>>();
     _p = -1;
     _context = SCAN_CONTEXT_ID_NOT_EXIST;
 }
 
 pegasus_client_impl::pegasus_scanner_impl::~pegasus_scanner_impl()
 {
+    // the scanner may be destroyed while a batch is being prefetched: cancel the rpc, or wait
+    // until its response handler finished, which may start the next prefetch
+    while (true) {
+        ::dsn::task_ptr prefetch_task;
+        {
+            dsn::zauto_lock l(_lock);
+            prefetch_task = std::move(_prefetch_task);
+        }
+        if (prefetch_task == nullptr) {
+            break;
+        }
+        if (prefetch_task->cancel(true)) {
+            dsn::zauto_lock l(_lock);
+            _rpc_started = false;
+            break;
+        }
+    }
+
     dsn::zauto_lock l(_lock);
 
     dassert(!_rpc_started, "all scan-rpc should be completed here");
@@ -297,6 +461,17 @@ void pegasus_client_impl::pegasus_scanner_impl_wrapper::async_next(
     });
 }
 
+void pegasus_client_impl::pegasus_scanner_impl_wrapper::async_next_batch(
+    async_scan_next_batch_callback_t &&callback)
+{
+    // wrap shared_ptr _p with callback
+    _p->async_next_batch(
+        [ __p = _p, user_callback = std::move(callback) ](
+            int error_code, std::vector<kv_view> &&kvs, internal_info &&info) {
+            user_callback(error_code, std::move(kvs), std::move(info));
+        });
+}
+
 const char pegasus_client_impl::pegasus_scanner_impl::_holder[] = {'\x00', '\x00', '\xFF', '\xFF'};
 const ::dsn::blob pegasus_client_impl::pegasus_scanner_impl::_min = ::dsn::blob(_holder, 0, 2);
 const ::dsn::blob pegasus_client_impl::pegasus_scanner_impl::_max = ::dsn::blob(_holder, 2, 2);
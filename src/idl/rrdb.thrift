@@ -46,6 +46,12 @@ enum mutate_operation
     MO_DELETE
 }
 
+enum count_mode
+{
+    CM_EXACT,         // iterate all the records of the hash key
+    CM_APPROXIMATE    // estimate by per-sst statistics, expired or overwritten records may be counted
+}
+
 struct update_request
 {
     1:dsn.blob      key;
@@ -80,6 +86,12 @@ struct ttl_response
     6:string        server;
 }
 
+struct count_request
+{
+    1:dsn.blob      hash_key;
+    2:count_mode    mode;
+}
+
 struct count_response
 {
     1:i32           error;
@@ -119,6 +131,29 @@ struct multi_remove_response
     6:string        server;
 }
 
+// delete the records in the range by one rocksdb DeleteRange, which leaves one range
+// tombstone instead of one tombstone per record.
+struct delete_range_request
+{
+    1:dsn.blob      hash_key;
+    2:dsn.blob      start_sort_key;
+    3:bool          start_inclusive;
+    4:dsn.blob      stop_sort_key; // empty means to the end of the hash key
+    5:bool          stop_inclusive;
+    // if true, delete all records of the partition `partition_index`, and the key range is
+    // ignored. the request should be sent with the partition hash of `partition_index`.
+    6:bool          clear_partition;
+    7:i32           partition_index;
+}
+
+// ingest the sst files of bulk load into the partition `partition_index`.
+// the request should be sent with the partition hash of `partition_index`.
+struct ingest_request
+{
+    1:string        dir; // the bulk load directory, which is accessible from every replica
+    2:i32           partition_index;
+}
+
 struct multi_get_request
 {
     1:dsn.blob      hash_key;
@@ -133,6 +168,10 @@ struct multi_get_request
     10:filter_type  sort_key_filter_type;
     11:dsn.blob     sort_key_filter_pattern;
     12:bool         reverse; // if search in reverse direction
+    13:cas_check_type value_filter_type; // only return the records whose value passes the check
+    14:dsn.blob     value_filter_operand;
+    15:i32          value_offset; // only return the bytes of value in [value_offset, value_offset + value_length)
+    16:i32          value_length; // <= 0 means to the end of value
 }
 
 struct multi_get_response
@@ -144,6 +183,20 @@ struct multi_get_response
     6:string        server;
 }
 
+struct batch_multi_get_request
+{
+    1:list<multi_get_request> requests; // the hash keys should be in the same partition
+}
+
+struct batch_multi_get_response
+{
+    1:i32           error;
+    2:list<multi_get_response> responses; // in the same order as requests
+    3:i32           app_id;
+    4:i32           partition_index;
+    6:string        server;
+}
+
 struct incr_request
 {
     1:dsn.blob      key;
@@ -163,6 +216,20 @@ struct incr_response
     6:string        server;
 }
 
+// An extra check of check_and_set or check_and_mutate on a sort key of the same hash key.
+struct cas_condition
+{
+    1:dsn.blob       check_sort_key;
+    2:cas_check_type check_type;
+    3:dsn.blob       check_operand;
+}
+
+struct cas_check_value
+{
+    1:bool           exist;
+    2:dsn.blob       value; // used only if exist is true
+}
+
 struct check_and_set_request
 {
     1:dsn.blob       hash_key;
@@ -174,6 +241,7 @@ struct check_and_set_request
     7:dsn.blob       set_value;
     8:i32            set_expire_ts_seconds;
     9:bool           return_check_value;
+    10:list<cas_condition> extra_conditions; // AND-ed with the check above
 }
 
 struct check_and_set_response
@@ -188,6 +256,8 @@ struct check_and_set_response
     6:i32            partition_index;
     7:i64            decree;
     8:string         server;
+    9:list<cas_check_value> extra_check_values; // used only if check_value_returned is true,
+                                                // in the order of extra_conditions
 }
 
 struct mutate
@@ -206,6 +276,7 @@ struct check_and_mutate_request
     4:dsn.blob       check_operand;
     5:list<mutate>   mutate_list;
     6:bool           return_check_value;
+    7:list<cas_condition> extra_conditions; // AND-ed with the check above
 }
 
 struct check_and_mutate_response
@@ -220,6 +291,8 @@ struct check_and_mutate_response
     6:i32            partition_index;
     7:i64            decree;
     8:string         server;
+    9:list<cas_check_value> extra_check_values; // used only if check_value_returned is true,
+                                                // in the order of extra_conditions
 }
 
 struct get_scanner_request
@@ -234,6 +307,11 @@ struct get_scanner_request
     8:dsn.blob     hash_key_filter_pattern;
     9:filter_type  sort_key_filter_type;
     10:dsn.blob    sort_key_filter_pattern;
+    11:bool        bulk_scan; // hint for large scans like data export: read ahead and not fill block cache
+    12:cas_check_type value_filter_type; // only return the records whose value passes the check
+    13:dsn.blob    value_filter_operand;
+    14:i32         value_offset; // only return the bytes of value in [value_offset, value_offset + value_length)
+    15:i32         value_length; // <= 0 means to the end of value
 }
 
 struct scan_request
@@ -251,6 +329,22 @@ struct scan_response
     6:string        server;
 }
 
+struct get_split_keys_request
+{
+    1:i32           split_count; // the expected count of the key ranges
+}
+
+struct get_split_keys_response
+{
+    1:i32           error;
+    // the sorted keys which split the partition into key ranges of roughly equal size,
+    // which may be fewer than split_count - 1
+    2:list<dsn.blob> split_keys;
+    3:i32           app_id;
+    4:i32           partition_index;
+    6:string        server;
+}
+
 struct duplicate_request
 {
     // The timestamp of this write.
@@ -283,16 +377,25 @@ service rrdb
     update_response multi_put(1:multi_put_request request);
     update_response remove(1:dsn.blob key);
     multi_remove_response multi_remove(1:multi_remove_request request);
+    update_response delete_range(1:delete_range_request request);
+    update_response ingest(1:ingest_request request);
     incr_response incr(1:incr_request request);
     check_and_set_response check_and_set(1:check_and_set_request request);
     check_and_mutate_response check_and_mutate(1:check_and_mutate_request request);
+    // the same as check_and_set and check_and_mutate, used only if extra_conditions is not
+    // empty, so that the old servers which ignore extra_conditions reject the requests
+    check_and_set_response check_and_set_v2(1:check_and_set_request request);
+    check_and_mutate_response check_and_mutate_v2(1:check_and_mutate_request request);
     read_response get(1:dsn.blob key);
     multi_get_response multi_get(1:multi_get_request request);
+    batch_multi_get_response batch_multi_get(1:batch_multi_get_request request);
     count_response sortkey_count(1:dsn.blob hash_key);
+    count_response sortkey_count_v2(1:count_request request);
     ttl_response ttl(1:dsn.blob key);
 
     scan_response get_scanner(1:get_scanner_request request);
     scan_response scan(1:scan_request request);
     oneway void clear_scanner(1:i64 context_id);
+    get_split_keys_response get_split_keys(1:get_split_keys_request request);
 }
 
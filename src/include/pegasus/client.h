@@ -73,6 +73,36 @@ public:
         FT_MATCH_EXACT = 4
     };
 
+    enum cas_check_type
+    {
+        CT_NO_CHECK = 0,
+
+        // appearance
+        CT_VALUE_NOT_EXIST = 1,          // value is not exist
+        CT_VALUE_NOT_EXIST_OR_EMPTY = 2, // value is not exist or value is empty
+        CT_VALUE_EXIST = 3,              // value is exist
+        CT_VALUE_NOT_EMPTY = 4,          // value is exist and not empty
+
+        // match
+        CT_VALUE_MATCH_ANYWHERE = 5, // operand matches anywhere in value
+        CT_VALUE_MATCH_PREFIX = 6,   // operand matches prefix in value
+        CT_VALUE_MATCH_POSTFIX = 7,  // operand matches postfix in value
+
+        // bytes compare
+        CT_VALUE_BYTES_LESS = 8,              // bytes compare: value < operand
+        CT_VALUE_BYTES_LESS_OR_EQUAL = 9,     // bytes compare: value <= operand
+        CT_VALUE_BYTES_EQUAL = 10,            // bytes compare: value == operand
+        CT_VALUE_BYTES_GREATER_OR_EQUAL = 11, // bytes compare: value >= operand
+        CT_VALUE_BYTES_GREATER = 12,          // bytes compare: value > operand
+
+        // int compare: first transfer bytes to int64 by atoi(); then compare by int value
+        CT_VALUE_INT_LESS = 13,             // int compare: value < operand
+        CT_VALUE_INT_LESS_OR_EQUAL = 14,    // int compare: value <= operand
+        CT_VALUE_INT_EQUAL = 15,            // int compare: value == operand
+        CT_VALUE_INT_GREATER_OR_EQUAL = 16, // int compare: value >= operand
+        CT_VALUE_INT_GREATER = 17           // int compare: value > operand
+    };
+
     struct multi_get_options
     {
         bool start_inclusive;
@@ -81,12 +111,21 @@ public:
         std::string sort_key_filter_pattern;
         bool no_value; // only fetch hash_key and sort_key, but not fetch value
         bool reverse;  // if search in reverse direction
+        cas_check_type value_filter_type; // only fetch the records whose value passes the check,
+                                          // the checks on the absence of value are not supported
+        std::string value_filter_operand;
+        int value_offset; // only fetch the bytes of value in [value_offset, value_offset +
+                          // value_length), which are filtered and sliced by the server
+        int value_length; // <= 0 means to the end of value
         multi_get_options()
             : start_inclusive(true),
               stop_inclusive(false),
               sort_key_filter_type(FT_NO_FILTER),
               no_value(false),
-              reverse(false)
+              reverse(false),
+              value_filter_type(CT_NO_CHECK),
+              value_offset(0),
+              value_length(0)
         {
         }
         multi_get_options(const multi_get_options &o)
@@ -95,49 +134,103 @@ public:
               sort_key_filter_type(o.sort_key_filter_type),
               sort_key_filter_pattern(o.sort_key_filter_pattern),
               no_value(o.no_value),
-              reverse(o.reverse)
+              reverse(o.reverse),
+              value_filter_type(o.value_filter_type),
+              value_filter_operand(o.value_filter_operand),
+              value_offset(o.value_offset),
+              value_length(o.value_length)
         {
         }
     };
 
-    enum cas_check_type
+    struct parallel_scan_options
     {
-        CT_NO_CHECK = 0,
+        int worker_count; // max count of the partitions scanned concurrently
+        int max_scans_per_server; // max count of the partitions scanned concurrently on one
+                                  // replica server, <= 0 means no limit
+        parallel_scan_options() : worker_count(8), max_scans_per_server(2) {}
+    };
 
-        // appearance
-        CT_VALUE_NOT_EXIST = 1,          // value is not exist
-        CT_VALUE_NOT_EXIST_OR_EMPTY = 2, // value is not exist or value is empty
-        CT_VALUE_EXIST = 3,              // value is exist
-        CT_VALUE_NOT_EMPTY = 4,          // value is exist and not empty
+    struct batch_multi_get_item
+    {
+        std::string hashkey;
+        std::set<std::string> sortkeys; // if empty, means fetch all sortkeys under the hashkey
+    };
 
-        // match
-        CT_VALUE_MATCH_ANYWHERE = 5, // operand matches anywhere in value
-        CT_VALUE_MATCH_PREFIX = 6,   // operand matches prefix in value
-        CT_VALUE_MATCH_POSTFIX = 7,  // operand matches postfix in value
+    struct batch_multi_get_result
+    {
+        int error; // the same as the return value of multi_get()
+        std::map<std::string, std::string> values;
+        batch_multi_get_result() : error(PERR_OK) {}
+    };
 
-        // bytes compare
-        CT_VALUE_BYTES_LESS = 8,              // bytes compare: value < operand
-        CT_VALUE_BYTES_LESS_OR_EQUAL = 9,     // bytes compare: value <= operand
-        CT_VALUE_BYTES_EQUAL = 10,            // bytes compare: value == operand
-        CT_VALUE_BYTES_GREATER_OR_EQUAL = 11, // bytes compare: value >= operand
-        CT_VALUE_BYTES_GREATER = 12,          // bytes compare: value > operand
+    struct batch_key
+    {
+        std::string hashkey;
+        std::string sortkey;
+        batch_key() {}
+        batch_key(const std::string &h, const std::string &s) : hashkey(h), sortkey(s) {}
+    };
 
-        // int compare: first transfer bytes to int64 by atoi(); then compare by int value
-        CT_VALUE_INT_LESS = 13,             // int compare: value < operand
-        CT_VALUE_INT_LESS_OR_EQUAL = 14,    // int compare: value <= operand
-        CT_VALUE_INT_EQUAL = 15,            // int compare: value == operand
-        CT_VALUE_INT_GREATER_OR_EQUAL = 16, // int compare: value >= operand
-        CT_VALUE_INT_GREATER = 17           // int compare: value > operand
+    struct batch_set_item
+    {
+        std::string hashkey;
+        std::string sortkey;
+        std::string value;
+        int ttl_seconds; // 0 means no ttl
+        batch_set_item() : ttl_seconds(0) {}
+        batch_set_item(const std::string &h,
+                       const std::string &s,
+                       const std::string &v,
+                       int ttl = 0)
+            : hashkey(h), sortkey(s), value(v), ttl_seconds(ttl)
+        {
+        }
+    };
+
+    struct batch_get_result
+    {
+        int error; // the same as the return value of get()
+        std::string value;
+        batch_get_result() : error(PERR_OK) {}
+    };
+
+    // An extra check on a sort key of the same hash key, see check_and_set_options and
+    // check_and_mutate_options.
+    struct check_condition
+    {
+        std::string check_sort_key;
+        cas_check_type check_type;
+        std::string check_operand;
+        check_condition() : check_type(CT_NO_CHECK) {}
+        check_condition(const std::string &sort_key,
+                        cas_check_type type,
+                        const std::string &operand = "")
+            : check_sort_key(sort_key), check_type(type), check_operand(operand)
+        {
+        }
+    };
+
+    struct check_value_result
+    {
+        bool exist;        // if the check value exists.
+        std::string value; // can be used only when exist is true.
+        check_value_result() : exist(false) {}
     };
 
     struct check_and_set_options
     {
         int set_value_ttl_seconds; // time to live in seconds of the set value, 0 means no ttl.
         bool return_check_value;   // if return the check value in results.
+        // the conditions to check besides the check of the request, all of which are evaluated
+        // atomically with the set, which is done only if all the checks passed.
+        // The servers which don't support them fail the request.
+        std::vector<check_condition> extra_conditions;
         check_and_set_options() : set_value_ttl_seconds(0), return_check_value(false) {}
         check_and_set_options(const check_and_set_options &o)
             : set_value_ttl_seconds(o.set_value_ttl_seconds),
-              return_check_value(o.return_check_value)
+              return_check_value(o.return_check_value),
+              extra_conditions(o.extra_conditions)
         {
         }
     };
@@ -148,6 +241,9 @@ public:
         bool check_value_returned; // if the check value is returned.
         bool check_value_exist;    // can be used only when check_value_returned is true.
         std::string check_value;   // can be used only when check_value_exist is true.
+        // the check values of extra_conditions in the same order,
+        // can be used only when check_value_returned is true.
+        std::vector<check_value_result> extra_check_values;
         check_and_set_results()
             : set_succeed(false), check_value_returned(false), check_value_exist(false)
         {
@@ -155,7 +251,8 @@ public:
         check_and_set_results(const check_and_set_results &o)
             : set_succeed(o.set_succeed),
               check_value_returned(o.check_value_returned),
-              check_value_exist(o.check_value_exist)
+              check_value_exist(o.check_value_exist),
+              extra_check_values(o.extra_check_values)
         {
         }
     };
@@ -200,9 +297,13 @@ public:
     struct check_and_mutate_options
     {
         bool return_check_value; // if return the check value in results.
+        // the conditions to check besides the check of the request, all of which are evaluated
+        // atomically with the mutations, which are applied only if all the checks passed.
+        // The servers which don't support them fail the request.
+        std::vector<check_condition> extra_conditions;
         check_and_mutate_options() : return_check_value(false) {}
         check_and_mutate_options(const check_and_mutate_options &o)
-            : return_check_value(o.return_check_value)
+            : return_check_value(o.return_check_value), extra_conditions(o.extra_conditions)
         {
         }
     };
@@ -213,6 +314,9 @@ public:
         bool check_value_returned; // if the check value is returned.
         bool check_value_exist;    // can be used only when check_value_returned is true.
         std::string check_value;   // can be used only when check_value_exist is true.
+        // the check values of extra_conditions in the same order,
+        // can be used only when check_value_returned is true.
+        std::vector<check_value_result> extra_check_values;
         check_and_mutate_results()
             : mutate_succeed(false), check_value_returned(false), check_value_exist(false)
         {
@@ -220,7 +324,8 @@ public:
         check_and_mutate_results(const check_and_mutate_results &o)
             : mutate_succeed(o.mutate_succeed),
               check_value_returned(o.check_value_returned),
-              check_value_exist(o.check_value_exist)
+              check_value_exist(o.check_value_exist),
+              extra_check_values(o.extra_check_values)
         {
         }
     };
@@ -235,7 +340,22 @@ public:
         std::string hash_key_filter_pattern;
         filter_type sort_key_filter_type;
         std::string sort_key_filter_pattern;
-        bool no_value; // only fetch hash_key and sort_key, but not fetch value
+        bool no_value;  // only fetch hash_key and sort_key, but not fetch value
+        bool bulk_scan; // hint for large scans like data export: read ahead and not fill cache
+        cas_check_type value_filter_type; // only fetch the records whose value passes the check,
+                                          // the checks on the absence of value are not supported
+        std::string value_filter_operand;
+        int value_offset; // only fetch the bytes of value in [value_offset, value_offset +
+                          // value_length), which are filtered and sliced by the server
+        int value_length; // <= 0 means to the end of value
+        // max count of the batches fetched ahead, while the application is consuming the
+        // current batch. it hides the rpc round trip between batches at the cost of buffering
+        // up to `prefetch_batch_count * batch_size` more k-v. 0 means no prefetch.
+        int prefetch_batch_count;
+        // only for get_unordered_scanners(): split each partition into at most this count of
+        // key ranges of roughly equal size, which are scanned by the scanners concurrently.
+        // it allows more scanners than the partitions. <= 1 means no split.
+        int split_count_per_partition;
         scan_options()
             : timeout_ms(5000),
               batch_size(100),
@@ -243,7 +363,13 @@ public:
               stop_inclusive(false),
               hash_key_filter_type(FT_NO_FILTER),
               sort_key_filter_type(FT_NO_FILTER),
-              no_value(false)
+              no_value(false),
+              bulk_scan(false),
+              value_filter_type(CT_NO_CHECK),
+              value_offset(0),
+              value_length(0),
+              prefetch_batch_count(0),
+              split_count_per_partition(1)
         {
         }
         scan_options(const scan_options &o)
@@ -255,13 +381,43 @@ public:
               hash_key_filter_pattern(o.hash_key_filter_pattern),
               sort_key_filter_type(o.sort_key_filter_type),
               sort_key_filter_pattern(o.sort_key_filter_pattern),
-              no_value(o.no_value)
+              no_value(o.no_value),
+              bulk_scan(o.bulk_scan),
+              value_filter_type(o.value_filter_type),
+              value_filter_operand(o.value_filter_operand),
+              value_offset(o.value_offset),
+              value_length(o.value_length),
+              prefetch_batch_count(o.prefetch_batch_count),
+              split_count_per_partition(o.split_count_per_partition)
         {
         }
     };
 
     class pegasus_scanner;
 
+    // A k-v got by pegasus_scanner::next_batch() without copying the data.
+    // The pointers refer to the memory of the received scan response, which is kept alive by
+    // `holder`, so they are valid as long as the kv_view or any copy of it exists.
+    struct kv_view
+    {
+        const char *hash_key;
+        size_t hash_key_length;
+        const char *sort_key;
+        size_t sort_key_length;
+        const char *value;
+        size_t value_length;
+        std::shared_ptr<const void> holder;
+        kv_view()
+            : hash_key(nullptr),
+              hash_key_length(0),
+              sort_key(nullptr),
+              sort_key_length(0),
+              value(nullptr),
+              value_length(0)
+        {
+        }
+    };
+
     // define callback function types for asynchronous operations.
     typedef std::function<void(int /*error_code*/, internal_info && /*info*/)> async_set_callback_t;
     typedef std::function<void(int /*error_code*/, internal_info && /*info*/)>
@@ -295,6 +451,18 @@ public:
                                std::string && /*value*/,
                                internal_info && /*info*/)>
         async_scan_next_callback_t;
+    typedef std::function<void(
+        int /*error_code*/, std::vector<kv_view> && /*kvs*/, internal_info && /*info*/)>
+        async_scan_next_batch_callback_t;
+    typedef std::function<void(int /*error_code*/,
+                               std::vector<batch_get_result> && /*results*/)>
+        async_batch_get_callback_t;
+    typedef std::function<void(int /*error_code*/, std::vector<int> && /*errors*/)>
+        async_batch_set_callback_t;
+    typedef std::function<void(int /*error_code*/, std::vector<int> && /*errors*/)>
+        async_batch_del_callback_t;
+    // returns false to stop the scan
+    typedef std::function<bool(std::vector<kv_view> && /*kvs*/)> parallel_scan_consumer_t;
     typedef std::function<void(int /*error_code*/, pegasus_scanner * /*hash_scanner*/)>
         async_get_scanner_callback_t;
     typedef std::function<void(int /*error_code*/, std::vector<pegasus_scanner *> && /*scanners*/)>
@@ -335,6 +503,30 @@ public:
         ///
         virtual void async_next(async_scan_next_callback_t &&callback) = 0;
 
+        ///
+        /// \brief get all the remaining key-value pairs of the current batch of this scanner,
+        /// or of the next batch if the current one is consumed, without copying the data
+        /// thread-safe
+        /// \param kvs
+        /// the key-value pairs got, see kv_view
+        /// \return
+        /// int, the error indicates whether or not the operation is succeeded.
+        /// this error can be converted to a string using get_error_string()
+        /// PERR_OK means at least one k-v pair got
+        /// PERR_SCAN_COMPLETE means all k-v have been iterated before this call
+        /// otherwise some error orrured
+        ///
+        virtual int next_batch(std::vector<kv_view> &kvs, internal_info *info = nullptr) = 0;
+
+        ///
+        /// \brief async get all the remaining key-value pairs of the current batch of this
+        /// scanner, or of the next batch if the current one is consumed
+        /// thread-safe
+        /// \param callback
+        /// status and result will be passed to callback, see next_batch()
+        ///
+        virtual void async_next_batch(async_scan_next_batch_callback_t &&callback) = 0;
+
         virtual ~abstract_pegasus_scanner() {}
     };
 
@@ -693,6 +885,142 @@ public:
                                           int max_fetch_size = 1000000,
                                           int timeout_milliseconds = 5000) = 0;
 
+    ///
+    /// \brief batch_multi_get
+    ///     get multiple values under multiple hash keys from the cluster.
+    ///     the hash keys located in the same partition are fetched by one rpc, which is much
+    ///     cheaper than calling multi_get() for each hash key.
+    /// \param items
+    /// the hash keys and their sort keys to be fetched.
+    /// \param results
+    /// results[i] is the result of items[i].
+    /// \param max_fetch_count
+    /// max count of k-v pairs to be fetched for each hash key. max_fetch_count <= 0 means no
+    /// limit.
+    /// \param max_fetch_size
+    /// max size of k-v pairs to be fetched for each hash key. max_fetch_size <= 0 means no limit.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    /// returns PERR_OK if all the rpcs succeeded, the error of each hash key is in results.
+    ///
+    virtual int batch_multi_get(const std::vector<batch_multi_get_item> &items,
+                                std::vector<batch_multi_get_result> &results,
+                                int max_fetch_count = 100,
+                                int max_fetch_size = 1000000,
+                                int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief batch_get
+    ///     get the values of multiple keys from the cluster.
+    ///     the keys are grouped by partition and the keys of each partition are fetched by one
+    ///     rpc, the rpcs of different partitions are sent concurrently.
+    /// \param keys
+    /// the keys to be fetched, which may be under different hash keys.
+    /// \param results
+    /// results[i] is the result of keys[i], whose error is PERR_NOT_FOUND if the key doesn't
+    /// exist, or PERR_INCOMPLETE if the key is not fetched because the server reached its
+    /// iteration limits, in which case the other keys of the same hash key may still be fetched.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    /// returns PERR_OK if all the keys are fetched successfully (PERR_NOT_FOUND of a key is not
+    /// a failure), otherwise the first error encountered. the error of each key is in results.
+    ///
+    virtual int batch_get(const std::vector<batch_key> &keys,
+                          std::vector<batch_get_result> &results,
+                          int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief asynchronous batch_get
+    ///     get the values of multiple keys from the cluster asynchronously.
+    ///     refer to the sync version for the details.
+    /// \param keys
+    /// the keys to be fetched, which may be under different hash keys.
+    /// \param callback
+    /// the callback function will be invoked after all the rpcs are finished or failed.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    ///
+    virtual void async_batch_get(const std::vector<batch_key> &keys,
+                                 async_batch_get_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief batch_set
+    ///     set the values of multiple keys into the cluster.
+    ///     the items of the same hash key and ttl are written by one multi_set rpc, and all the
+    ///     rpcs are sent concurrently. the items of the same hash key may be written by different
+    ///     rpcs if their ttls differ, so the batch is not atomic.
+    /// \param items
+    /// the items to be written, which may be under different hash keys.
+    /// \param errors
+    /// errors[i] is the error of items[i].
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    /// returns PERR_OK if all the items are written, otherwise the first error encountered.
+    ///
+    virtual int batch_set(const std::vector<batch_set_item> &items,
+                          std::vector<int> &errors,
+                          int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief asynchronous batch_set
+    ///     set the values of multiple keys into the cluster asynchronously.
+    ///     refer to the sync version for the details.
+    /// \param items
+    /// the items to be written, which may be under different hash keys.
+    /// \param callback
+    /// the callback function will be invoked after all the rpcs are finished or failed.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    ///
+    virtual void async_batch_set(const std::vector<batch_set_item> &items,
+                                 async_batch_set_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief batch_del
+    ///     delete multiple keys from the cluster.
+    ///     the keys of the same hash key are deleted by one multi_del rpc, and all the rpcs are
+    ///     sent concurrently.
+    /// \param keys
+    /// the keys to be deleted, which may be under different hash keys.
+    /// \param errors
+    /// errors[i] is the error of keys[i].
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    /// returns PERR_OK if all the keys are deleted, otherwise the first error encountered.
+    ///
+    virtual int batch_del(const std::vector<batch_key> &keys,
+                          std::vector<int> &errors,
+                          int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief asynchronous batch_del
+    ///     delete multiple keys from the cluster asynchronously.
+    ///     refer to the sync version for the details.
+    /// \param keys
+    /// the keys to be deleted, which may be under different hash keys.
+    /// \param callback
+    /// the callback function will be invoked after all the rpcs are finished or failed.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    ///
+    virtual void async_batch_del(const std::vector<batch_key> &keys,
+                                 async_batch_del_callback_t &&callback = nullptr,
+                                 int timeout_milliseconds = 5000) = 0;
+
     ///
     /// \brief exist
     ///     check value exist by key from the cluster.
@@ -722,6 +1050,10 @@ public:
     /// the returned sortkey count
     /// \param timeout_milliseconds
     /// if wait longer than this value, will return time out error
+    /// \param approximate
+    /// if true, the count of a hash key with lots of sortkeys is estimated by statistics
+    /// instead of iterating all the records, which is much faster but may include the
+    /// expired, deleted or overwritten records.
     /// \return
     /// int, the error indicates whether or not the operation is succeeded.
     /// this error can be converted to a string using get_error_string().
@@ -729,7 +1061,8 @@ public:
     virtual int sortkey_count(const std::string &hashkey,
                               int64_t &count,
                               int timeout_milliseconds = 5000,
-                              internal_info *info = nullptr) = 0;
+                              internal_info *info = nullptr,
+                              bool approximate = false) = 0;
 
     ///
     /// \brief del
@@ -812,6 +1145,88 @@ public:
                                  async_multi_del_callback_t &&callback = nullptr,
                                  int timeout_milliseconds = 5000) = 0;
 
+    ///
+    /// \brief delete_range
+    ///     delete all the k-v under hashkey whose sortkey is in the range, which is done by one
+    ///     range deletion on the server, without scanning and deleting the k-v one by one.
+    /// \param hashkey
+    /// used to decide which partition to delete the k-v. should not be empty.
+    /// \param start_sortkey
+    /// the start sortkey of the range.
+    /// \param stop_sortkey
+    /// the stop sortkey of the range. empty means to the end of the hashkey.
+    /// \param start_inclusive
+    /// whether the start sortkey is deleted.
+    /// \param stop_inclusive
+    /// whether the stop sortkey is deleted, ignored if stop_sortkey is empty.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    ///
+    virtual int delete_range(const std::string &hashkey,
+                             const std::string &start_sortkey,
+                             const std::string &stop_sortkey,
+                             bool start_inclusive = true,
+                             bool stop_inclusive = false,
+                             int timeout_milliseconds = 5000,
+                             internal_info *info = nullptr) = 0;
+
+    ///
+    /// \brief asynchronous delete_range
+    ///     delete all the k-v under hashkey whose sortkey is in the range.
+    ///     will not be blocked, return immediately.
+    /// \param callback
+    /// the callback function will be invoked after operation finished or error occurred.
+    /// \see delete_range for the other params.
+    /// \return
+    /// void.
+    ///
+    virtual void async_delete_range(const std::string &hashkey,
+                                    const std::string &start_sortkey,
+                                    const std::string &stop_sortkey,
+                                    bool start_inclusive = true,
+                                    bool stop_inclusive = false,
+                                    async_del_callback_t &&callback = nullptr,
+                                    int timeout_milliseconds = 5000) = 0;
+
+    ///
+    /// \brief clear_partition
+    ///     delete all the k-v in the partition by one range deletion on the server.
+    /// \param partition_index
+    /// the index of the partition, should be in [0, partition_count).
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    ///
+    virtual int clear_partition(int partition_index,
+                                int timeout_milliseconds = 5000,
+                                internal_info *info = nullptr) = 0;
+
+    ///
+    /// \brief ingest_partition
+    ///     ingest the sst files generated for the partition by bulk load, see the shell command
+    ///     `generate_sst`. the sst files are ingested by every replica of the partition, so the
+    ///     directory should be accessible from all the replica servers, e.g. a shared mount.
+    ///     the records in the sst files overwrite the existing ones with the same keys.
+    /// \param partition_index
+    /// the index of the partition, should be in [0, partition_count).
+    /// \param dir
+    /// the bulk load directory, which contains the sst files of all the partitions.
+    /// \param timeout_milliseconds
+    /// if wait longer than this value, will return time out error
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    ///
+    virtual int ingest_partition(int partition_index,
+                                 const std::string &dir,
+                                 int timeout_milliseconds = 60000,
+                                 internal_info *info = nullptr) = 0;
+
     ///
     /// \brief incr
     ///     atomically increment value by key from the cluster.
@@ -1109,6 +1524,10 @@ public:
     ///
     /// \brief get a bundle of scanners to iterate all k-v in table
     ///        scanners should be deleted when scan complete
+    ///        the partitions (or the key ranges of them if options.split_count_per_partition
+    ///        is set) are shared by the scanners, each scanner takes the next one not scanned by
+    ///        any scanner after its current one is completed, so that the scanners of the small
+    ///        partitions help to scan the rest ones.
     /// \param max_split_count
     /// the number of scanners returned will always <= max_split_count
     /// \param options
@@ -1138,6 +1557,29 @@ public:
                                  const scan_options &options,
                                  async_get_unordered_scanners_callback_t &&callback) = 0;
 
+    ///
+    /// \brief scan all k-v in table by several partitions concurrently
+    ///        the partitions are kept in a queue, from which an idle worker takes the next
+    ///        partition whose replica server is not busy, so the skewed partitions don't leave
+    ///        the workers idle. the batches of all the workers are passed to the consumer in the
+    ///        caller's thread one by one, while the next batches are being fetched.
+    /// \param options
+    /// which used to indicate scan options, like timeout_milliseconds and batch_size
+    /// \param parallel_options
+    /// the concurrency of the scan, each scanned partition has at most one scan rpc in flight
+    /// unless options.prefetch_batch_count is set
+    /// \param consumer
+    /// the callback to consume the k-v of a batch, returns false to stop the scan.
+    /// the kv_views are valid until they are destroyed.
+    /// \return
+    /// int, the error indicates whether or not the operation is succeeded.
+    /// this error can be converted to a string using get_error_string().
+    /// returns PERR_OK if all the k-v are consumed or the consumer stops the scan.
+    ///
+    virtual int parallel_scan(const scan_options &options,
+                              const parallel_scan_options &parallel_options,
+                              parallel_scan_consumer_t &&consumer) = 0;
+
     ///
     /// \brief get_error_string
     /// get error string
@@ -136,6 +136,66 @@ public:
                                   reply_thread_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_DELETE_RANGE ------------
+    // - synchronous
+    std::pair<::dsn::error_code, update_response>
+    delete_range_sync(const delete_range_request &args,
+                      std::chrono::milliseconds timeout,
+                      uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<update_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_DELETE_RANGE,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack delete_range_request and update_response
+    template <typename TCallback>
+    ::dsn::task_ptr delete_range(const delete_range_request &args,
+                                 TCallback &&callback,
+                                 std::chrono::milliseconds timeout,
+                                 uint64_t request_partition_hash,
+                                 int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_DELETE_RANGE,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
+    // ---------- call RPC_RRDB_RRDB_INGEST ------------
+    // - synchronous
+    std::pair<::dsn::error_code, update_response> ingest_sync(const ingest_request &args,
+                                                              std::chrono::milliseconds timeout,
+                                                              uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<update_response>(_resolver->call_op(
+            RPC_RRDB_RRDB_INGEST, args, &_tracker, empty_rpc_handler, timeout, partition_hash));
+    }
+
+    // - asynchronous with on-stack ingest_request and update_response
+    template <typename TCallback>
+    ::dsn::task_ptr ingest(const ingest_request &args,
+                           TCallback &&callback,
+                           std::chrono::milliseconds timeout,
+                           uint64_t request_partition_hash,
+                           int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_INGEST,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_INCR ------------
     // - synchronous
     std::pair<::dsn::error_code, incr_response>
@@ -228,6 +288,72 @@ public:
                                   reply_thread_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_CHECK_AND_SET_V2 ------------
+    // - synchronous
+    std::pair<::dsn::error_code, check_and_set_response>
+    check_and_set_v2_sync(const check_and_set_request &args,
+                          std::chrono::milliseconds timeout,
+                          uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<check_and_set_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_CHECK_AND_SET_V2,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack check_and_set_request and check_and_set_response
+    template <typename TCallback>
+    ::dsn::task_ptr check_and_set_v2(const check_and_set_request &args,
+                                     TCallback &&callback,
+                                     std::chrono::milliseconds timeout,
+                                     uint64_t request_partition_hash,
+                                     int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_CHECK_AND_SET_V2,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
+    // ---------- call RPC_RRDB_RRDB_CHECK_AND_MUTATE_V2 ------------
+    // - synchronous
+    std::pair<::dsn::error_code, check_and_mutate_response>
+    check_and_mutate_v2_sync(const check_and_mutate_request &args,
+                             std::chrono::milliseconds timeout,
+                             uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<check_and_mutate_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_CHECK_AND_MUTATE_V2,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack check_and_mutate_request and check_and_mutate_response
+    template <typename TCallback>
+    ::dsn::task_ptr check_and_mutate_v2(const check_and_mutate_request &args,
+                                        TCallback &&callback,
+                                        std::chrono::milliseconds timeout,
+                                        uint64_t request_partition_hash,
+                                        int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_CHECK_AND_MUTATE_V2,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_GET ------------
     // - synchronous
     std::pair<::dsn::error_code, read_response>
@@ -280,6 +406,39 @@ public:
                                   reply_thread_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_BATCH_MULTI_GET ------------
+    // - synchronous
+    std::pair<::dsn::error_code, batch_multi_get_response>
+    batch_multi_get_sync(const batch_multi_get_request &args,
+                         std::chrono::milliseconds timeout,
+                         uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<batch_multi_get_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_BATCH_MULTI_GET,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack batch_multi_get_request and batch_multi_get_response
+    template <typename TCallback>
+    ::dsn::task_ptr batch_multi_get(const batch_multi_get_request &args,
+                                    TCallback &&callback,
+                                    std::chrono::milliseconds timeout,
+                                    uint64_t request_partition_hash,
+                                    int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_BATCH_MULTI_GET,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_SORTKEY_COUNT ------------
     // - synchronous
     std::pair<::dsn::error_code, count_response> sortkey_count_sync(
@@ -311,6 +470,37 @@ public:
                                   reply_thread_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_SORTKEY_COUNT_V2 ------------
+    // - synchronous
+    std::pair<::dsn::error_code, count_response> sortkey_count_v2_sync(
+        const count_request &args, std::chrono::milliseconds timeout, uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<count_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_SORTKEY_COUNT_V2,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack count_request and count_response
+    template <typename TCallback>
+    ::dsn::task_ptr sortkey_count_v2(const count_request &args,
+                                     TCallback &&callback,
+                                     std::chrono::milliseconds timeout,
+                                     uint64_t request_partition_hash,
+                                     int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_SORTKEY_COUNT_V2,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_TTL ------------
     // - synchronous
     std::pair<::dsn::error_code, ttl_response>
@@ -408,6 +598,39 @@ public:
                            partition_hash);
     }
 
+    // ---------- call RPC_RRDB_RRDB_GET_SPLIT_KEYS ------------
+    // - synchronous
+    std::pair<::dsn::error_code, get_split_keys_response>
+    get_split_keys_sync(const get_split_keys_request &args,
+                        std::chrono::milliseconds timeout,
+                        uint64_t partition_hash)
+    {
+        return ::dsn::rpc::wait_and_unwrap<get_split_keys_response>(
+            _resolver->call_op(RPC_RRDB_RRDB_GET_SPLIT_KEYS,
+                               args,
+                               &_tracker,
+                               empty_rpc_handler,
+                               timeout,
+                               partition_hash));
+    }
+
+    // - asynchronous with on-stack get_split_keys_request and get_split_keys_response
+    template <typename TCallback>
+    ::dsn::task_ptr get_split_keys(const get_split_keys_request &args,
+                                   TCallback &&callback,
+                                   std::chrono::milliseconds timeout,
+                                   uint64_t request_partition_hash,
+                                   int reply_thread_hash = 0)
+    {
+        return _resolver->call_op(RPC_RRDB_RRDB_GET_SPLIT_KEYS,
+                                  args,
+                                  &_tracker,
+                                  std::forward<TCallback>(callback),
+                                  timeout,
+                                  request_partition_hash,
+                                  reply_thread_hash);
+    }
+
     // ---------- call RPC_RRDB_RRDB_DUPLICATE ------------
 
     // - asynchronous with on-stack duplicate_request and duplicate_response
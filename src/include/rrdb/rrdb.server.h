@@ -50,6 +50,21 @@ protected:
         multi_remove_response resp;
         reply(resp);
     }
+    // RPC_RRDB_RRDB_DELETE_RANGE
+    virtual void on_delete_range(const delete_range_request &args,
+                                 ::dsn::rpc_replier<update_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_DELETE_RANGE ... (not implemented) " << std::endl;
+        update_response resp;
+        reply(resp);
+    }
+    // RPC_RRDB_RRDB_INGEST
+    virtual void on_ingest(const ingest_request &args, ::dsn::rpc_replier<update_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_INGEST ... (not implemented) " << std::endl;
+        update_response resp;
+        reply(resp);
+    }
     // RPC_RRDB_RRDB_INCR
     virtual void on_incr(const incr_request &args, ::dsn::rpc_replier<incr_response> &reply)
     {
@@ -88,6 +103,14 @@ protected:
         multi_get_response resp;
         reply(resp);
     }
+    // RPC_RRDB_RRDB_BATCH_MULTI_GET
+    virtual void on_batch_multi_get(const batch_multi_get_request &args,
+                                    ::dsn::rpc_replier<batch_multi_get_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_BATCH_MULTI_GET ... (not implemented) " << std::endl;
+        batch_multi_get_response resp;
+        reply(resp);
+    }
     // RPC_RRDB_RRDB_SORTKEY_COUNT
     virtual void on_sortkey_count(const ::dsn::blob &args,
                                   ::dsn::rpc_replier<count_response> &reply)
@@ -96,6 +119,14 @@ protected:
         count_response resp;
         reply(resp);
     }
+    // RPC_RRDB_RRDB_SORTKEY_COUNT_V2
+    virtual void on_sortkey_count_v2(const count_request &args,
+                                     ::dsn::rpc_replier<count_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_SORTKEY_COUNT_V2 ... (not implemented) " << std::endl;
+        count_response resp;
+        reply(resp);
+    }
     // RPC_RRDB_RRDB_TTL
     virtual void on_ttl(const ::dsn::blob &args, ::dsn::rpc_replier<ttl_response> &reply)
     {
@@ -123,23 +154,43 @@ protected:
     {
         std::cout << "... exec RPC_RRDB_RRDB_CLEAR_SCANNER ... (not implemented) " << std::endl;
     }
+    // RPC_RRDB_RRDB_GET_SPLIT_KEYS
+    virtual void on_get_split_keys(const get_split_keys_request &args,
+                                   ::dsn::rpc_replier<get_split_keys_response> &reply)
+    {
+        std::cout << "... exec RPC_RRDB_RRDB_GET_SPLIT_KEYS ... (not implemented) " << std::endl;
+        get_split_keys_response resp;
+        reply(resp);
+    }
 
     static void register_rpc_handlers()
     {
         register_async_rpc_handler(RPC_RRDB_RRDB_PUT, "put", on_put);
         register_async_rpc_handler(RPC_RRDB_RRDB_MULTI_PUT, "multi_put", on_multi_put);
         register_async_rpc_handler(RPC_RRDB_RRDB_REMOVE, "remove", on_multi_remove);
+        register_async_rpc_handler(RPC_RRDB_RRDB_DELETE_RANGE, "delete_range", on_delete_range);
+        register_async_rpc_handler(RPC_RRDB_RRDB_INGEST, "ingest", on_ingest);
         register_async_rpc_handler(RPC_RRDB_RRDB_INCR, "incr", on_incr);
         register_async_rpc_handler(RPC_RRDB_RRDB_CHECK_AND_SET, "check_and_set", on_check_and_set);
         register_async_rpc_handler(
             RPC_RRDB_RRDB_CHECK_AND_MUTATE, "check_and_mutate", on_check_and_mutate);
+        register_async_rpc_handler(
+            RPC_RRDB_RRDB_CHECK_AND_SET_V2, "check_and_set_v2", on_check_and_set);
+        register_async_rpc_handler(
+            RPC_RRDB_RRDB_CHECK_AND_MUTATE_V2, "check_and_mutate_v2", on_check_and_mutate);
         register_async_rpc_handler(RPC_RRDB_RRDB_GET, "get", on_get);
         register_async_rpc_handler(RPC_RRDB_RRDB_MULTI_GET, "multi_get", on_multi_get);
+        register_async_rpc_handler(
+            RPC_RRDB_RRDB_BATCH_MULTI_GET, "batch_multi_get", on_batch_multi_get);
         register_async_rpc_handler(RPC_RRDB_RRDB_SORTKEY_COUNT, "sortkey_count", on_sortkey_count);
+        register_async_rpc_handler(
+            RPC_RRDB_RRDB_SORTKEY_COUNT_V2, "sortkey_count_v2", on_sortkey_count_v2);
         register_async_rpc_handler(RPC_RRDB_RRDB_TTL, "ttl", on_ttl);
         register_async_rpc_handler(RPC_RRDB_RRDB_GET_SCANNER, "get_scanner", on_get_scanner);
         register_async_rpc_handler(RPC_RRDB_RRDB_SCAN, "scan", on_scan);
         register_async_rpc_handler(RPC_RRDB_RRDB_CLEAR_SCANNER, "clear_scanner", on_clear_scanner);
+        register_async_rpc_handler(
+            RPC_RRDB_RRDB_GET_SPLIT_KEYS, "get_split_keys", on_get_split_keys);
     }
 
 private:
@@ -167,6 +218,18 @@ private:
     {
         svc->on_multi_remove(args, reply);
     }
+    static void on_delete_range(rrdb_service *svc,
+                                const delete_range_request &args,
+                                ::dsn::rpc_replier<update_response> &reply)
+    {
+        svc->on_delete_range(args, reply);
+    }
+    static void on_ingest(rrdb_service *svc,
+                          const ingest_request &args,
+                          ::dsn::rpc_replier<update_response> &reply)
+    {
+        svc->on_ingest(args, reply);
+    }
     static void
     on_incr(rrdb_service *svc, const incr_request &args, ::dsn::rpc_replier<incr_response> &reply)
     {
@@ -195,12 +258,24 @@ private:
     {
         svc->on_multi_get(args, reply);
     }
+    static void on_batch_multi_get(rrdb_service *svc,
+                                   const batch_multi_get_request &args,
+                                   ::dsn::rpc_replier<batch_multi_get_response> &reply)
+    {
+        svc->on_batch_multi_get(args, reply);
+    }
     static void on_sortkey_count(rrdb_service *svc,
                                  const ::dsn::blob &args,
                                  ::dsn::rpc_replier<count_response> &reply)
     {
         svc->on_sortkey_count(args, reply);
     }
+    static void on_sortkey_count_v2(rrdb_service *svc,
+                                    const count_request &args,
+                                    ::dsn::rpc_replier<count_response> &reply)
+    {
+        svc->on_sortkey_count_v2(args, reply);
+    }
     static void
     on_ttl(rrdb_service *svc, const ::dsn::blob &args, ::dsn::rpc_replier<ttl_response> &reply)
     {
@@ -221,6 +296,12 @@ private:
     {
         svc->on_clear_scanner(args);
     }
+    static void on_get_split_keys(rrdb_service *svc,
+                                  const get_split_keys_request &args,
+                                  ::dsn::rpc_replier<get_split_keys_response> &reply)
+    {
+        svc->on_get_split_keys(args, reply);
+    }
 };
 } // namespace apps
 } // namespace dsn
@@ -71,6 +71,17 @@ struct mutate_operation
 
 extern const std::map<int, const char *> _mutate_operation_VALUES_TO_NAMES;
 
+struct count_mode
+{
+    enum type
+    {
+        CM_EXACT = 0,
+        CM_APPROXIMATE = 1
+    };
+};
+
+extern const std::map<int, const char *> _count_mode_VALUES_TO_NAMES;
+
 class update_request;
 
 class update_response;
@@ -79,6 +90,8 @@ class read_response;
 
 class ttl_response;
 
+class count_request;
+
 class count_response;
 
 class key_value;
@@ -89,14 +102,26 @@ class multi_remove_request;
 
 class multi_remove_response;
 
+class delete_range_request;
+
+class ingest_request;
+
 class multi_get_request;
 
 class multi_get_response;
 
+class batch_multi_get_request;
+
+class batch_multi_get_response;
+
 class incr_request;
 
 class incr_response;
 
+class cas_condition;
+
+class cas_check_value;
+
 class check_and_set_request;
 
 class check_and_set_response;
@@ -113,6 +138,10 @@ class scan_request;
 
 class scan_response;
 
+class get_split_keys_request;
+
+class get_split_keys_response;
+
 class duplicate_request;
 
 class duplicate_response;
@@ -394,6 +423,58 @@ inline std::ostream &operator<<(std::ostream &out, const ttl_response &obj)
     return out;
 }
 
+typedef struct _count_request__isset
+{
+    _count_request__isset() : hash_key(false), mode(false) {}
+    bool hash_key : 1;
+    bool mode : 1;
+} _count_request__isset;
+
+class count_request
+{
+public:
+    count_request(const count_request &);
+    count_request(count_request &&);
+    count_request &operator=(const count_request &);
+    count_request &operator=(count_request &&);
+    count_request() : mode((count_mode::type)0) {}
+
+    virtual ~count_request() throw();
+    ::dsn::blob hash_key;
+    count_mode::type mode;
+
+    _count_request__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_mode(const count_mode::type val);
+
+    bool operator==(const count_request &rhs) const
+    {
+        if (!(hash_key == rhs.hash_key))
+            return false;
+        if (!(mode == rhs.mode))
+            return false;
+        return true;
+    }
+    bool operator!=(const count_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const count_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(count_request &a, count_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const count_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
 typedef struct _count_response__isset
 {
     _count_response__isset()
@@ -721,6 +802,152 @@ inline std::ostream &operator<<(std::ostream &out, const multi_remove_response &
     return out;
 }
 
+typedef struct _delete_range_request__isset
+{
+    _delete_range_request__isset()
+        : hash_key(false),
+          start_sort_key(false),
+          start_inclusive(false),
+          stop_sort_key(false),
+          stop_inclusive(false),
+          clear_partition(false),
+          partition_index(false)
+    {
+    }
+    bool hash_key : 1;
+    bool start_sort_key : 1;
+    bool start_inclusive : 1;
+    bool stop_sort_key : 1;
+    bool stop_inclusive : 1;
+    bool clear_partition : 1;
+    bool partition_index : 1;
+} _delete_range_request__isset;
+
+class delete_range_request
+{
+public:
+    delete_range_request(const delete_range_request &);
+    delete_range_request(delete_range_request &&);
+    delete_range_request &operator=(const delete_range_request &);
+    delete_range_request &operator=(delete_range_request &&);
+    delete_range_request()
+        : start_inclusive(0), stop_inclusive(0), clear_partition(0), partition_index(0)
+    {
+    }
+
+    virtual ~delete_range_request() throw();
+    ::dsn::blob hash_key;
+    ::dsn::blob start_sort_key;
+    bool start_inclusive;
+    ::dsn::blob stop_sort_key;
+    bool stop_inclusive;
+    bool clear_partition;
+    int32_t partition_index;
+
+    _delete_range_request__isset __isset;
+
+    void __set_hash_key(const ::dsn::blob &val);
+
+    void __set_start_sort_key(const ::dsn::blob &val);
+
+    void __set_start_inclusive(const bool val);
+
+    void __set_stop_sort_key(const ::dsn::blob &val);
+
+    void __set_stop_inclusive(const bool val);
+
+    void __set_clear_partition(const bool val);
+
+    void __set_partition_index(const int32_t val);
+
+    bool operator==(const delete_range_request &rhs) const
+    {
+        if (!(hash_key == rhs.hash_key))
+            return false;
+        if (!(start_sort_key == rhs.start_sort_key))
+            return false;
+        if (!(start_inclusive == rhs.start_inclusive))
+            return false;
+        if (!(stop_sort_key == rhs.stop_sort_key))
+            return false;
+        if (!(stop_inclusive == rhs.stop_inclusive))
+            return false;
+        if (!(clear_partition == rhs.clear_partition))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        return true;
+    }
+    bool operator!=(const delete_range_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const delete_range_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(delete_range_request &a, delete_range_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const delete_range_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _ingest_request__isset
+{
+    _ingest_request__isset() : dir(false), partition_index(false) {}
+    bool dir : 1;
+    bool partition_index : 1;
+} _ingest_request__isset;
+
+class ingest_request
+{
+public:
+    ingest_request(const ingest_request &);
+    ingest_request(ingest_request &&);
+    ingest_request &operator=(const ingest_request &);
+    ingest_request &operator=(ingest_request &&);
+    ingest_request() : dir(), partition_index(0) {}
+
+    virtual ~ingest_request() throw();
+    std::string dir;
+    int32_t partition_index;
+
+    _ingest_request__isset __isset;
+
+    void __set_dir(const std::string &val);
+
+    void __set_partition_index(const int32_t val);
+
+    bool operator==(const ingest_request &rhs) const
+    {
+        if (!(dir == rhs.dir))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        return true;
+    }
+    bool operator!=(const ingest_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const ingest_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(ingest_request &a, ingest_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const ingest_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
 typedef struct _multi_get_request__isset
 {
     _multi_get_request__isset()
@@ -735,7 +962,11 @@ typedef struct _multi_get_request__isset
           stop_inclusive(false),
           sort_key_filter_type(false),
           sort_key_filter_pattern(false),
-          reverse(false)
+          reverse(false),
+          value_filter_type(false),
+          value_filter_operand(false),
+          value_offset(false),
+          value_length(false)
     {
     }
     bool hash_key : 1;
@@ -750,6 +981,10 @@ typedef struct _multi_get_request__isset
     bool sort_key_filter_type : 1;
     bool sort_key_filter_pattern : 1;
     bool reverse : 1;
+    bool value_filter_type : 1;
+    bool value_filter_operand : 1;
+    bool value_offset : 1;
+    bool value_length : 1;
 } _multi_get_request__isset;
 
 class multi_get_request
@@ -766,7 +1001,10 @@ public:
           start_inclusive(0),
           stop_inclusive(0),
           sort_key_filter_type((filter_type::type)0),
-          reverse(0)
+          reverse(0),
+          value_filter_type((cas_check_type::type)0),
+          value_offset(0),
+          value_length(0)
     {
     }
 
@@ -783,6 +1021,10 @@ public:
     filter_type::type sort_key_filter_type;
     ::dsn::blob sort_key_filter_pattern;
     bool reverse;
+    cas_check_type::type value_filter_type;
+    ::dsn::blob value_filter_operand;
+    int32_t value_offset;
+    int32_t value_length;
 
     _multi_get_request__isset __isset;
 
@@ -810,6 +1052,14 @@ public:
 
     void __set_reverse(const bool val);
 
+    void __set_value_filter_type(const cas_check_type::type val);
+
+    void __set_value_filter_operand(const ::dsn::blob &val);
+
+    void __set_value_offset(const int32_t val);
+
+    void __set_value_length(const int32_t val);
+
     bool operator==(const multi_get_request &rhs) const
     {
         if (!(hash_key == rhs.hash_key))
@@ -836,6 +1086,14 @@ public:
             return false;
         if (!(reverse == rhs.reverse))
             return false;
+        if (!(value_filter_type == rhs.value_filter_type))
+            return false;
+        if (!(value_filter_operand == rhs.value_filter_operand))
+            return false;
+        if (!(value_offset == rhs.value_offset))
+            return false;
+        if (!(value_length == rhs.value_length))
+            return false;
         return true;
     }
     bool operator!=(const multi_get_request &rhs) const { return !(*this == rhs); }
@@ -929,6 +1187,125 @@ inline std::ostream &operator<<(std::ostream &out, const multi_get_response &obj
     return out;
 }
 
+typedef struct _batch_multi_get_request__isset
+{
+    _batch_multi_get_request__isset() : requests(false) {}
+    bool requests : 1;
+} _batch_multi_get_request__isset;
+
+class batch_multi_get_request
+{
+public:
+    batch_multi_get_request(const batch_multi_get_request &);
+    batch_multi_get_request(batch_multi_get_request &&);
+    batch_multi_get_request &operator=(const batch_multi_get_request &);
+    batch_multi_get_request &operator=(batch_multi_get_request &&);
+    batch_multi_get_request() {}
+
+    virtual ~batch_multi_get_request() throw();
+    std::vector<multi_get_request> requests;
+
+    _batch_multi_get_request__isset __isset;
+
+    void __set_requests(const std::vector<multi_get_request> &val);
+
+    bool operator==(const batch_multi_get_request &rhs) const
+    {
+        if (!(requests == rhs.requests))
+            return false;
+        return true;
+    }
+    bool operator!=(const batch_multi_get_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const batch_multi_get_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(batch_multi_get_request &a, batch_multi_get_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const batch_multi_get_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _batch_multi_get_response__isset
+{
+    _batch_multi_get_response__isset()
+        : error(false), responses(false), app_id(false), partition_index(false), server(false)
+    {
+    }
+    bool error : 1;
+    bool responses : 1;
+    bool app_id : 1;
+    bool partition_index : 1;
+    bool server : 1;
+} _batch_multi_get_response__isset;
+
+class batch_multi_get_response
+{
+public:
+    batch_multi_get_response(const batch_multi_get_response &);
+    batch_multi_get_response(batch_multi_get_response &&);
+    batch_multi_get_response &operator=(const batch_multi_get_response &);
+    batch_multi_get_response &operator=(batch_multi_get_response &&);
+    batch_multi_get_response() : error(0), app_id(0), partition_index(0), server() {}
+
+    virtual ~batch_multi_get_response() throw();
+    int32_t error;
+    std::vector<multi_get_response> responses;
+    int32_t app_id;
+    int32_t partition_index;
+    std::string server;
+
+    _batch_multi_get_response__isset __isset;
+
+    void __set_error(const int32_t val);
+
+    void __set_responses(const std::vector<multi_get_response> &val);
+
+    void __set_app_id(const int32_t val);
+
+    void __set_partition_index(const int32_t val);
+
+    void __set_server(const std::string &val);
+
+    bool operator==(const batch_multi_get_response &rhs) const
+    {
+        if (!(error == rhs.error))
+            return false;
+        if (!(responses == rhs.responses))
+            return false;
+        if (!(app_id == rhs.app_id))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        if (!(server == rhs.server))
+            return false;
+        return true;
+    }
+    bool operator!=(const batch_multi_get_response &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const batch_multi_get_response &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(batch_multi_get_response &a, batch_multi_get_response &b);
+
+inline std::ostream &operator<<(std::ostream &out, const batch_multi_get_response &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
 typedef struct _incr_request__isset
 {
     _incr_request__isset() : key(false), increment(false), expire_ts_seconds(false) {}
@@ -1071,6 +1448,116 @@ inline std::ostream &operator<<(std::ostream &out, const incr_response &obj)
     return out;
 }
 
+typedef struct _cas_condition__isset
+{
+    _cas_condition__isset() : check_sort_key(false), check_type(false), check_operand(false) {}
+    bool check_sort_key : 1;
+    bool check_type : 1;
+    bool check_operand : 1;
+} _cas_condition__isset;
+
+class cas_condition
+{
+public:
+    cas_condition(const cas_condition &);
+    cas_condition(cas_condition &&);
+    cas_condition &operator=(const cas_condition &);
+    cas_condition &operator=(cas_condition &&);
+    cas_condition() : check_type((cas_check_type::type)0) {}
+
+    virtual ~cas_condition() throw();
+    ::dsn::blob check_sort_key;
+    cas_check_type::type check_type;
+    ::dsn::blob check_operand;
+
+    _cas_condition__isset __isset;
+
+    void __set_check_sort_key(const ::dsn::blob &val);
+
+    void __set_check_type(const cas_check_type::type val);
+
+    void __set_check_operand(const ::dsn::blob &val);
+
+    bool operator==(const cas_condition &rhs) const
+    {
+        if (!(check_sort_key == rhs.check_sort_key))
+            return false;
+        if (!(check_type == rhs.check_type))
+            return false;
+        if (!(check_operand == rhs.check_operand))
+            return false;
+        return true;
+    }
+    bool operator!=(const cas_condition &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const cas_condition &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(cas_condition &a, cas_condition &b);
+
+inline std::ostream &operator<<(std::ostream &out, const cas_condition &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _cas_check_value__isset
+{
+    _cas_check_value__isset() : exist(false), value(false) {}
+    bool exist : 1;
+    bool value : 1;
+} _cas_check_value__isset;
+
+class cas_check_value
+{
+public:
+    cas_check_value(const cas_check_value &);
+    cas_check_value(cas_check_value &&);
+    cas_check_value &operator=(const cas_check_value &);
+    cas_check_value &operator=(cas_check_value &&);
+    cas_check_value() : exist(0) {}
+
+    virtual ~cas_check_value() throw();
+    bool exist;
+    ::dsn::blob value;
+
+    _cas_check_value__isset __isset;
+
+    void __set_exist(const bool val);
+
+    void __set_value(const ::dsn::blob &val);
+
+    bool operator==(const cas_check_value &rhs) const
+    {
+        if (!(exist == rhs.exist))
+            return false;
+        if (!(value == rhs.value))
+            return false;
+        return true;
+    }
+    bool operator!=(const cas_check_value &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const cas_check_value &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(cas_check_value &a, cas_check_value &b);
+
+inline std::ostream &operator<<(std::ostream &out, const cas_check_value &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
 typedef struct _check_and_set_request__isset
 {
     _check_and_set_request__isset()
@@ -1082,7 +1569,8 @@ typedef struct _check_and_set_request__isset
           set_sort_key(false),
           set_value(false),
           set_expire_ts_seconds(false),
-          return_check_value(false)
+          return_check_value(false),
+          extra_conditions(false)
     {
     }
     bool hash_key : 1;
@@ -1094,6 +1582,7 @@ typedef struct _check_and_set_request__isset
     bool set_value : 1;
     bool set_expire_ts_seconds : 1;
     bool return_check_value : 1;
+    bool extra_conditions : 1;
 } _check_and_set_request__isset;
 
 class check_and_set_request
@@ -1121,6 +1610,7 @@ public:
     ::dsn::blob set_value;
     int32_t set_expire_ts_seconds;
     bool return_check_value;
+    std::vector<cas_condition> extra_conditions;
 
     _check_and_set_request__isset __isset;
 
@@ -1142,6 +1632,8 @@ public:
 
     void __set_return_check_value(const bool val);
 
+    void __set_extra_conditions(const std::vector<cas_condition> &val);
+
     bool operator==(const check_and_set_request &rhs) const
     {
         if (!(hash_key == rhs.hash_key))
@@ -1162,6 +1654,8 @@ public:
             return false;
         if (!(return_check_value == rhs.return_check_value))
             return false;
+        if (!(extra_conditions == rhs.extra_conditions))
+            return false;
         return true;
     }
     bool operator!=(const check_and_set_request &rhs) const { return !(*this == rhs); }
@@ -1192,7 +1686,8 @@ typedef struct _check_and_set_response__isset
           app_id(false),
           partition_index(false),
           decree(false),
-          server(false)
+          server(false),
+          extra_check_values(false)
     {
     }
     bool error : 1;
@@ -1203,6 +1698,7 @@ typedef struct _check_and_set_response__isset
     bool partition_index : 1;
     bool decree : 1;
     bool server : 1;
+    bool extra_check_values : 1;
 } _check_and_set_response__isset;
 
 class check_and_set_response
@@ -1232,6 +1728,7 @@ public:
     int32_t partition_index;
     int64_t decree;
     std::string server;
+    std::vector<cas_check_value> extra_check_values;
 
     _check_and_set_response__isset __isset;
 
@@ -1251,6 +1748,8 @@ public:
 
     void __set_server(const std::string &val);
 
+    void __set_extra_check_values(const std::vector<cas_check_value> &val);
+
     bool operator==(const check_and_set_response &rhs) const
     {
         if (!(error == rhs.error))
@@ -1269,6 +1768,8 @@ public:
             return false;
         if (!(server == rhs.server))
             return false;
+        if (!(extra_check_values == rhs.extra_check_values))
+            return false;
         return true;
     }
     bool operator!=(const check_and_set_response &rhs) const { return !(*this == rhs); }
@@ -1363,7 +1864,8 @@ typedef struct _check_and_mutate_request__isset
           check_type(false),
           check_operand(false),
           mutate_list(false),
-          return_check_value(false)
+          return_check_value(false),
+          extra_conditions(false)
     {
     }
     bool hash_key : 1;
@@ -1372,6 +1874,7 @@ typedef struct _check_and_mutate_request__isset
     bool check_operand : 1;
     bool mutate_list : 1;
     bool return_check_value : 1;
+    bool extra_conditions : 1;
 } _check_and_mutate_request__isset;
 
 class check_and_mutate_request
@@ -1390,6 +1893,7 @@ public:
     ::dsn::blob check_operand;
     std::vector<mutate> mutate_list;
     bool return_check_value;
+    std::vector<cas_condition> extra_conditions;
 
     _check_and_mutate_request__isset __isset;
 
@@ -1405,6 +1909,8 @@ public:
 
     void __set_return_check_value(const bool val);
 
+    void __set_extra_conditions(const std::vector<cas_condition> &val);
+
     bool operator==(const check_and_mutate_request &rhs) const
     {
         if (!(hash_key == rhs.hash_key))
@@ -1419,6 +1925,8 @@ public:
             return false;
         if (!(return_check_value == rhs.return_check_value))
             return false;
+        if (!(extra_conditions == rhs.extra_conditions))
+            return false;
         return true;
     }
     bool operator!=(const check_and_mutate_request &rhs) const { return !(*this == rhs); }
@@ -1449,7 +1957,8 @@ typedef struct _check_and_mutate_response__isset
           app_id(false),
           partition_index(false),
           decree(false),
-          server(false)
+          server(false),
+          extra_check_values(false)
     {
     }
     bool error : 1;
@@ -1460,6 +1969,7 @@ typedef struct _check_and_mutate_response__isset
     bool partition_index : 1;
     bool decree : 1;
     bool server : 1;
+    bool extra_check_values : 1;
 } _check_and_mutate_response__isset;
 
 class check_and_mutate_response
@@ -1489,6 +1999,7 @@ public:
     int32_t partition_index;
     int64_t decree;
     std::string server;
+    std::vector<cas_check_value> extra_check_values;
 
     _check_and_mutate_response__isset __isset;
 
@@ -1508,6 +2019,8 @@ public:
 
     void __set_server(const std::string &val);
 
+    void __set_extra_check_values(const std::vector<cas_check_value> &val);
+
     bool operator==(const check_and_mutate_response &rhs) const
     {
         if (!(error == rhs.error))
@@ -1526,6 +2039,8 @@ public:
             return false;
         if (!(server == rhs.server))
             return false;
+        if (!(extra_check_values == rhs.extra_check_values))
+            return false;
         return true;
     }
     bool operator!=(const check_and_mutate_response &rhs) const { return !(*this == rhs); }
@@ -1558,7 +2073,12 @@ typedef struct _get_scanner_request__isset
           hash_key_filter_type(false),
           hash_key_filter_pattern(false),
           sort_key_filter_type(false),
-          sort_key_filter_pattern(false)
+          sort_key_filter_pattern(false),
+          bulk_scan(false),
+          value_filter_type(false),
+          value_filter_operand(false),
+          value_offset(false),
+          value_length(false)
     {
     }
     bool start_key : 1;
@@ -1571,6 +2091,11 @@ typedef struct _get_scanner_request__isset
     bool hash_key_filter_pattern : 1;
     bool sort_key_filter_type : 1;
     bool sort_key_filter_pattern : 1;
+    bool bulk_scan : 1;
+    bool value_filter_type : 1;
+    bool value_filter_operand : 1;
+    bool value_offset : 1;
+    bool value_length : 1;
 } _get_scanner_request__isset;
 
 class get_scanner_request
@@ -1586,7 +2111,11 @@ public:
           batch_size(0),
           no_value(0),
           hash_key_filter_type((filter_type::type)0),
-          sort_key_filter_type((filter_type::type)0)
+          sort_key_filter_type((filter_type::type)0),
+          bulk_scan(0),
+          value_filter_type((cas_check_type::type)0),
+          value_offset(0),
+          value_length(0)
     {
     }
 
@@ -1601,6 +2130,11 @@ public:
     ::dsn::blob hash_key_filter_pattern;
     filter_type::type sort_key_filter_type;
     ::dsn::blob sort_key_filter_pattern;
+    bool bulk_scan;
+    cas_check_type::type value_filter_type;
+    ::dsn::blob value_filter_operand;
+    int32_t value_offset;
+    int32_t value_length;
 
     _get_scanner_request__isset __isset;
 
@@ -1624,6 +2158,16 @@ public:
 
     void __set_sort_key_filter_pattern(const ::dsn::blob &val);
 
+    void __set_bulk_scan(const bool val);
+
+    void __set_value_filter_type(const cas_check_type::type val);
+
+    void __set_value_filter_operand(const ::dsn::blob &val);
+
+    void __set_value_offset(const int32_t val);
+
+    void __set_value_length(const int32_t val);
+
     bool operator==(const get_scanner_request &rhs) const
     {
         if (!(start_key == rhs.start_key))
@@ -1646,6 +2190,16 @@ public:
             return false;
         if (!(sort_key_filter_pattern == rhs.sort_key_filter_pattern))
             return false;
+        if (!(bulk_scan == rhs.bulk_scan))
+            return false;
+        if (!(value_filter_type == rhs.value_filter_type))
+            return false;
+        if (!(value_filter_operand == rhs.value_filter_operand))
+            return false;
+        if (!(value_offset == rhs.value_offset))
+            return false;
+        if (!(value_length == rhs.value_length))
+            return false;
         return true;
     }
     bool operator!=(const get_scanner_request &rhs) const { return !(*this == rhs); }
@@ -1796,6 +2350,125 @@ inline std::ostream &operator<<(std::ostream &out, const scan_response &obj)
     return out;
 }
 
+typedef struct _get_split_keys_request__isset
+{
+    _get_split_keys_request__isset() : split_count(false) {}
+    bool split_count : 1;
+} _get_split_keys_request__isset;
+
+class get_split_keys_request
+{
+public:
+    get_split_keys_request(const get_split_keys_request &);
+    get_split_keys_request(get_split_keys_request &&);
+    get_split_keys_request &operator=(const get_split_keys_request &);
+    get_split_keys_request &operator=(get_split_keys_request &&);
+    get_split_keys_request() : split_count(0) {}
+
+    virtual ~get_split_keys_request() throw();
+    int32_t split_count;
+
+    _get_split_keys_request__isset __isset;
+
+    void __set_split_count(const int32_t val);
+
+    bool operator==(const get_split_keys_request &rhs) const
+    {
+        if (!(split_count == rhs.split_count))
+            return false;
+        return true;
+    }
+    bool operator!=(const get_split_keys_request &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const get_split_keys_request &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(get_split_keys_request &a, get_split_keys_request &b);
+
+inline std::ostream &operator<<(std::ostream &out, const get_split_keys_request &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
+typedef struct _get_split_keys_response__isset
+{
+    _get_split_keys_response__isset()
+        : error(false), split_keys(false), app_id(false), partition_index(false), server(false)
+    {
+    }
+    bool error : 1;
+    bool split_keys : 1;
+    bool app_id : 1;
+    bool partition_index : 1;
+    bool server : 1;
+} _get_split_keys_response__isset;
+
+class get_split_keys_response
+{
+public:
+    get_split_keys_response(const get_split_keys_response &);
+    get_split_keys_response(get_split_keys_response &&);
+    get_split_keys_response &operator=(const get_split_keys_response &);
+    get_split_keys_response &operator=(get_split_keys_response &&);
+    get_split_keys_response() : error(0), app_id(0), partition_index(0), server() {}
+
+    virtual ~get_split_keys_response() throw();
+    int32_t error;
+    std::vector<::dsn::blob> split_keys;
+    int32_t app_id;
+    int32_t partition_index;
+    std::string server;
+
+    _get_split_keys_response__isset __isset;
+
+    void __set_error(const int32_t val);
+
+    void __set_split_keys(const std::vector<::dsn::blob> &val);
+
+    void __set_app_id(const int32_t val);
+
+    void __set_partition_index(const int32_t val);
+
+    void __set_server(const std::string &val);
+
+    bool operator==(const get_split_keys_response &rhs) const
+    {
+        if (!(error == rhs.error))
+            return false;
+        if (!(split_keys == rhs.split_keys))
+            return false;
+        if (!(app_id == rhs.app_id))
+            return false;
+        if (!(partition_index == rhs.partition_index))
+            return false;
+        if (!(server == rhs.server))
+            return false;
+        return true;
+    }
+    bool operator!=(const get_split_keys_response &rhs) const { return !(*this == rhs); }
+
+    bool operator<(const get_split_keys_response &) const;
+
+    uint32_t read(::apache::thrift::protocol::TProtocol *iprot);
+    uint32_t write(::apache::thrift::protocol::TProtocol *oprot) const;
+
+    virtual void printTo(std::ostream &out) const;
+};
+
+void swap(get_split_keys_response &a, get_split_keys_response &b);
+
+inline std::ostream &operator<<(std::ostream &out, const get_split_keys_response &obj)
+{
+    obj.printTo(out);
+    return out;
+}
+
 typedef struct _duplicate_request__isset
 {
     _duplicate_request__isset()
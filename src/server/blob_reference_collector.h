@@ -0,0 +1,192 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include <rocksdb/table_properties.h>
+#include <rocksdb/slice.h>
+
+#include <dsn/utility/string_conv.h>
+#include <dsn/utility/strings.h>
+
+#include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+#include "pegasus_value_separation.h"
+
+namespace pegasus {
+namespace server {
+
+// The count of the references to the blobs in an sst of the data column family, by the
+// buckets of the decrees of the blobs. Bucket `b` holds the decrees in
+// [b << bucket_bits, (b + 1) << bucket_bits).
+struct blob_reference_stats
+{
+    uint32_t bucket_bits{0};
+    std::map<uint64_t, uint64_t> counts;
+
+    // Estimates the count of the references to the decrees in [first, last], supposing that
+    // the references are distributed evenly in each bucket.
+    double count_in(uint64_t first, uint64_t last) const
+    {
+        double count = 0;
+        for (auto iter = counts.lower_bound(first >> bucket_bits);
+             iter != counts.end() && iter->first <= (last >> bucket_bits);
+             ++iter) {
+            uint64_t bucket_first = iter->first << bucket_bits;
+            uint64_t bucket_last = bucket_first + (1ULL << bucket_bits) - 1;
+            uint64_t overlap = std::min(last, bucket_last) - std::max(first, bucket_first) + 1;
+            count += static_cast<double>(iter->second) * overlap / (1ULL << bucket_bits);
+        }
+        return count;
+    }
+};
+
+// BlobReferenceCollector records the blob_reference_stats of an sst into its user collected
+// properties, so that the garbage in each sst of the blob column family can be estimated
+// without reading the data, see pegasus_value_separation.
+//
+// NOTE: You must change the property names if the property format changed.
+class BlobReferenceCollector : public rocksdb::TablePropertiesCollector
+{
+public:
+    // the buckets are widened until there are no more than MAX_BUCKET_COUNT of them, so that
+    // the properties of an sst referring to a long range of decrees are still small
+    static const uint32_t MIN_BUCKET_BITS = 10;
+    static const size_t MAX_BUCKET_COUNT = 256;
+
+    static const char *bucket_bits_property() { return "pegasus.blob_ref.bucket_bits"; }
+    // formatted as "bucket:count,bucket:count,..."
+    static const char *counts_property() { return "pegasus.blob_ref.counts"; }
+
+    // Returns false if the properties are missing (e.g. the sst is generated before the
+    // collector is introduced, or before the data version is known) or malformed.
+    static bool parse_properties(const rocksdb::UserCollectedProperties &properties,
+                                 blob_reference_stats &stats)
+    {
+        auto bits = properties.find(bucket_bits_property());
+        auto counts = properties.find(counts_property());
+        uint64_t bucket_bits = 0;
+        if (bits == properties.end() || counts == properties.end() ||
+            !dsn::buf2uint64(bits->second, bucket_bits) || bucket_bits >= 64) {
+            return false;
+        }
+        stats.bucket_bits = static_cast<uint32_t>(bucket_bits);
+        stats.counts.clear();
+        std::vector<std::string> items;
+        dsn::utils::split_args(counts->second.c_str(), items, ',');
+        for (const std::string &item : items) {
+            size_t pos = item.find(':');
+            uint64_t bucket = 0, count = 0;
+            if (pos == std::string::npos || !dsn::buf2uint64(item.substr(0, pos), bucket) ||
+                !dsn::buf2uint64(item.substr(pos + 1), count)) {
+                return false;
+            }
+            stats.counts[bucket] += count;
+        }
+        return true;
+    }
+
+    explicit BlobReferenceCollector(uint32_t pegasus_data_version)
+        : _pegasus_data_version(pegasus_data_version)
+    {
+        _stats.bucket_bits = MIN_BUCKET_BITS;
+    }
+
+    rocksdb::Status AddUserKey(const rocksdb::Slice & /*key*/,
+                               const rocksdb::Slice &value,
+                               rocksdb::EntryType type,
+                               rocksdb::SequenceNumber /*seq*/,
+                               uint64_t /*file_size*/) override
+    {
+        dsn::string_view raw_value = utils::to_string_view(value);
+        int64_t decree = 0;
+        if (type != rocksdb::kEntryPut ||
+            !pegasus_value_separation::is_separated(_pegasus_data_version, raw_value) ||
+            !pegasus_value_separation::extract_reference(
+                pegasus_extract_user_data(_pegasus_data_version, raw_value), decree)) {
+            return rocksdb::Status::OK();
+        }
+        _stats.counts[static_cast<uint64_t>(decree) >> _stats.bucket_bits]++;
+        if (_stats.counts.size() > MAX_BUCKET_COUNT) {
+            widen_buckets();
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status Finish(rocksdb::UserCollectedProperties *properties) override
+    {
+        if (_pegasus_data_version == 0) {
+            // the references are unknown, since the data version may be not set yet
+            return rocksdb::Status::OK();
+        }
+        for (auto &kv : GetReadableProperties()) {
+            properties->emplace(kv.first, std::move(kv.second));
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::UserCollectedProperties GetReadableProperties() const override
+    {
+        std::string counts;
+        for (const auto &kv : _stats.counts) {
+            if (!counts.empty()) {
+                counts.push_back(',');
+            }
+            counts.append(std::to_string(kv.first)).push_back(':');
+            counts.append(std::to_string(kv.second));
+        }
+        return {{bucket_bits_property(), std::to_string(_stats.bucket_bits)},
+                {counts_property(), counts}};
+    }
+
+    const char *Name() const override { return "pegasus.BlobReferenceCollector"; }
+
+private:
+    void widen_buckets()
+    {
+        while (_stats.counts.size() > MAX_BUCKET_COUNT) {
+            std::map<uint64_t, uint64_t> counts;
+            for (const auto &kv : _stats.counts) {
+                counts[kv.first >> 1] += kv.second;
+            }
+            _stats.counts.swap(counts);
+            _stats.bucket_bits++;
+        }
+    }
+
+    const uint32_t _pegasus_data_version;
+    blob_reference_stats _stats;
+};
+
+class BlobReferenceCollectorFactory : public rocksdb::TablePropertiesCollectorFactory
+{
+public:
+    BlobReferenceCollectorFactory() : _pegasus_data_version(0) {}
+
+    rocksdb::TablePropertiesCollector *
+    CreateTablePropertiesCollector(rocksdb::TablePropertiesCollectorFactory::Context) override
+    {
+        return new BlobReferenceCollector(_pegasus_data_version.load(std::memory_order_acquire));
+    }
+
+    const char *Name() const override { return "pegasus.BlobReferenceCollectorFactory"; }
+
+    // the references are not collected until the data version is set, since the values are
+    // not separated before data version 1
+    void SetPegasusDataVersion(uint32_t version)
+    {
+        _pegasus_data_version.store(version, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> _pegasus_data_version;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -212,7 +212,8 @@ void capacity_unit_calculator::add_check_and_set_cu(int32_t status,
                                                     const dsn::blob &hash_key,
                                                     const dsn::blob &check_sort_key,
                                                     const dsn::blob &set_sort_key,
-                                                    const dsn::blob &value)
+                                                    const dsn::blob &value,
+                                                    size_t extra_condition_count)
 {
 
     _pfc_check_and_set_bytes->add(hash_key.size() + check_sort_key.size() + set_sort_key.size() +
@@ -225,14 +226,18 @@ void capacity_unit_calculator::add_check_and_set_cu(int32_t status,
     if (status == rocksdb::Status::kOk) {
         add_write_cu(set_sort_key.size() + value.size());
     }
-    add_read_cu(1);
+    // each condition reads a record
+    for (size_t i = 0; i <= extra_condition_count; ++i) {
+        add_read_cu(1);
+    }
 }
 
 void capacity_unit_calculator::add_check_and_mutate_cu(
     int32_t status,
     const dsn::blob &hash_key,
     const dsn::blob &check_sort_key,
-    const std::vector<::dsn::apps::mutate> &mutate_list)
+    const std::vector<::dsn::apps::mutate> &mutate_list,
+    size_t extra_condition_count)
 {
     int64_t data_size = 0;
     for (const auto &m : mutate_list) {
@@ -248,7 +253,10 @@ void capacity_unit_calculator::add_check_and_mutate_cu(
     if (status == rocksdb::Status::kOk) {
         add_write_cu(data_size);
     }
-    add_read_cu(1);
+    // each condition reads a record
+    for (size_t i = 0; i <= extra_condition_count; ++i) {
+        add_read_cu(1);
+    }
 }
 
 } // namespace server
@@ -35,11 +35,13 @@ public:
                               const dsn::blob &hash_key,
                               const dsn::blob &check_sort_key,
                               const dsn::blob &set_sort_key,
-                              const dsn::blob &value);
+                              const dsn::blob &value,
+                              size_t extra_condition_count = 0);
     void add_check_and_mutate_cu(int32_t status,
                                  const dsn::blob &hash_key,
                                  const dsn::blob &check_sort_key,
-                                 const std::vector<::dsn::apps::mutate> &mutate_list);
+                                 const std::vector<::dsn::apps::mutate> &mutate_list,
+                                 size_t extra_condition_count = 0);
 
 protected:
     friend class capacity_unit_calculator_test;
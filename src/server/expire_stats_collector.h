@@ -0,0 +1,132 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <rocksdb/table_properties.h>
+#include <rocksdb/slice.h>
+
+#include <dsn/utility/string_conv.h>
+
+#include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+
+namespace pegasus {
+namespace server {
+
+// The expiration statistics of the records in an sst.
+struct expire_stats
+{
+    // the min and max expire_ts of the records with ttl, 0 if there is no such record
+    uint32_t min_expire_ts{0};
+    uint32_t max_expire_ts{0};
+    // count of the entries which never expire: the records without ttl, and the tombstones or
+    // merge operands, which may shadow or be applied on the records of the other ssts.
+    uint64_t no_ttl_count{0};
+
+    // Returns true if all the entries have expired at `epoch_now`, so the sst can be dropped
+    // as a whole without changing any read result.
+    bool all_expired(uint32_t epoch_now) const
+    {
+        return no_ttl_count == 0 && max_expire_ts > 0 &&
+               check_if_ts_expired(epoch_now, max_expire_ts);
+    }
+};
+
+// ExpireStatsCollector records the expire_stats of an sst into its user collected properties,
+// so that the ssts of which all the records have expired can be found without reading them.
+//
+// NOTE: You must change the property names if the property format changed.
+class ExpireStatsCollector : public rocksdb::TablePropertiesCollector
+{
+public:
+    static const char *min_expire_ts_property() { return "pegasus.expire.min_ts"; }
+    static const char *max_expire_ts_property() { return "pegasus.expire.max_ts"; }
+    static const char *no_ttl_count_property() { return "pegasus.expire.no_ttl_count"; }
+
+    // Returns false if the properties are missing (e.g. the sst is generated before the
+    // collector is introduced) or malformed.
+    static bool parse_properties(const rocksdb::UserCollectedProperties &properties,
+                                 expire_stats &stats)
+    {
+        uint64_t min_expire_ts = 0, max_expire_ts = 0;
+        if (!parse_property(properties, min_expire_ts_property(), min_expire_ts) ||
+            !parse_property(properties, max_expire_ts_property(), max_expire_ts) ||
+            !parse_property(properties, no_ttl_count_property(), stats.no_ttl_count) ||
+            min_expire_ts > UINT32_MAX || max_expire_ts > UINT32_MAX) {
+            return false;
+        }
+        stats.min_expire_ts = static_cast<uint32_t>(min_expire_ts);
+        stats.max_expire_ts = static_cast<uint32_t>(max_expire_ts);
+        return true;
+    }
+
+    rocksdb::Status AddUserKey(const rocksdb::Slice & /*key*/,
+                               const rocksdb::Slice &value,
+                               rocksdb::EntryType type,
+                               rocksdb::SequenceNumber /*seq*/,
+                               uint64_t /*file_size*/) override
+    {
+        if (type != rocksdb::kEntryPut || value.size() < sizeof(uint32_t)) {
+            _stats.no_ttl_count++;
+            return rocksdb::Status::OK();
+        }
+
+        // expire_ts is the first field of the value in all the data versions
+        uint32_t expire_ts = pegasus_extract_expire_ts(0, utils::to_string_view(value));
+        if (expire_ts == 0) {
+            _stats.no_ttl_count++;
+        } else {
+            _stats.min_expire_ts =
+                _stats.min_expire_ts == 0 ? expire_ts : std::min(_stats.min_expire_ts, expire_ts);
+            _stats.max_expire_ts = std::max(_stats.max_expire_ts, expire_ts);
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status Finish(rocksdb::UserCollectedProperties *properties) override
+    {
+        properties->emplace(min_expire_ts_property(), std::to_string(_stats.min_expire_ts));
+        properties->emplace(max_expire_ts_property(), std::to_string(_stats.max_expire_ts));
+        properties->emplace(no_ttl_count_property(), std::to_string(_stats.no_ttl_count));
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::UserCollectedProperties GetReadableProperties() const override
+    {
+        return {{min_expire_ts_property(), std::to_string(_stats.min_expire_ts)},
+                {max_expire_ts_property(), std::to_string(_stats.max_expire_ts)},
+                {no_ttl_count_property(), std::to_string(_stats.no_ttl_count)}};
+    }
+
+    const char *Name() const override { return "pegasus.ExpireStatsCollector"; }
+
+private:
+    static bool parse_property(const rocksdb::UserCollectedProperties &properties,
+                               const char *name,
+                               uint64_t &value)
+    {
+        auto find = properties.find(name);
+        return find != properties.end() && dsn::buf2uint64(find->second, value);
+    }
+
+    expire_stats _stats;
+};
+
+class ExpireStatsCollectorFactory : public rocksdb::TablePropertiesCollectorFactory
+{
+public:
+    rocksdb::TablePropertiesCollector *
+    CreateTablePropertiesCollector(rocksdb::TablePropertiesCollectorFactory::Context) override
+    {
+        return new ExpireStatsCollector();
+    }
+
+    const char *Name() const override { return "pegasus.ExpireStatsCollectorFactory"; }
+};
+
+} // namespace server
+} // namespace pegasus
@@ -0,0 +1,126 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <rocksdb/table_properties.h>
+#include <rocksdb/slice.h>
+
+#include <dsn/c/api_utilities.h>
+#include <dsn/utility/string_conv.h>
+
+namespace pegasus {
+namespace server {
+
+// HashkeyStatsCollector records the record count of each "large" hash key (which has at
+// least `min_count` records in the sst) into the user collected properties of the sst, so
+// that the sortkey count of a large hash key can be estimated without iterating the data.
+//
+// The property of a hash key is `"pegasus.hashkey_count." + hash_key` => decimal record count.
+// Small hash keys are not recorded, they are cheap to count by iterating. The first and the
+// last hash keys of the sst are always recorded, since a hash key spanning several ssts may
+// have only a few records in some of them.
+class HashkeyStatsCollector : public rocksdb::TablePropertiesCollector
+{
+public:
+    // NOTE: You must change the prefix if the property format changed.
+    static std::string property_name(const rocksdb::Slice &hash_key)
+    {
+        std::string name("pegasus.hashkey_count.");
+        name.append(hash_key.data(), hash_key.size());
+        return name;
+    }
+
+    // Returns false if the property is malformed.
+    static bool parse_property(const std::string &value, uint64_t &count)
+    {
+        return dsn::buf2uint64(value, count);
+    }
+
+    explicit HashkeyStatsCollector(uint64_t min_count) : _min_count(min_count) {}
+
+    rocksdb::Status AddUserKey(const rocksdb::Slice &key,
+                               const rocksdb::Slice & /*value*/,
+                               rocksdb::EntryType type,
+                               rocksdb::SequenceNumber /*seq*/,
+                               uint64_t /*file_size*/) override
+    {
+        // only count the records, tombstones or merge operands are ignored.
+        if (type != rocksdb::kEntryPut || key.size() < 2) {
+            return rocksdb::Status::OK();
+        }
+
+        // hash_key_len is in big endian
+        uint16_t hash_key_len = be16toh(*(int16_t *)(key.data()));
+        dassert(key.size() >= 2 + hash_key_len,
+                "key length must be no less than (2 + hash_key_len)");
+        rocksdb::Slice hash_key(key.data() + 2, hash_key_len);
+
+        // keys are added in order, so records of the same hash key are adjacent.
+        if (_current_count == 0 || hash_key != rocksdb::Slice(_current_hash_key)) {
+            finish_current_hash_key(_current_is_first);
+            _current_is_first = !_started;
+            _started = true;
+            _current_hash_key.assign(hash_key.data(), hash_key.size());
+        }
+        _current_count++;
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status Finish(rocksdb::UserCollectedProperties *properties) override
+    {
+        // the last hash key
+        finish_current_hash_key(true);
+        for (const auto &kv : _large_hash_keys) {
+            properties->emplace(property_name(kv.first), std::to_string(kv.second));
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::UserCollectedProperties GetReadableProperties() const override
+    {
+        return {{"pegasus.large_hashkey_count", std::to_string(_large_hash_keys.size())}};
+    }
+
+    const char *Name() const override { return "pegasus.HashkeyStatsCollector"; }
+
+private:
+    void finish_current_hash_key(bool is_boundary)
+    {
+        if (_current_count > 0 && (_current_count >= _min_count || is_boundary)) {
+            _large_hash_keys.emplace(_current_hash_key, _current_count);
+        }
+        _current_count = 0;
+    }
+
+    const uint64_t _min_count;
+    std::string _current_hash_key;
+    uint64_t _current_count{0};
+    // whether the current hash key is the first one of the sst
+    bool _current_is_first{false};
+    bool _started{false};
+    std::map<std::string, uint64_t> _large_hash_keys;
+};
+
+class HashkeyStatsCollectorFactory : public rocksdb::TablePropertiesCollectorFactory
+{
+public:
+    explicit HashkeyStatsCollectorFactory(uint64_t min_count) : _min_count(min_count) {}
+
+    rocksdb::TablePropertiesCollector *
+    CreateTablePropertiesCollector(rocksdb::TablePropertiesCollectorFactory::Context) override
+    {
+        return new HashkeyStatsCollector(_min_count);
+    }
+
+    const char *Name() const override { return "pegasus.HashkeyStatsCollectorFactory"; }
+
+private:
+    const uint64_t _min_count;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -11,15 +11,23 @@
 
 #include "base/pegasus_utils.h"
 #include "base/pegasus_value_schema.h"
+#include "expire_stats_collector.h"
 
 namespace pegasus {
 namespace server {
 
+// KeyWithTTLCompactionFilter drops the expired records, and sets the default ttl to the records
+// without ttl if the default ttl of the table is set.
 class KeyWithTTLCompactionFilter : public rocksdb::CompactionFilter
 {
 public:
-    KeyWithTTLCompactionFilter(uint32_t pegasus_data_version, uint32_t default_ttl, bool enabled)
-        : _pegasus_data_version(pegasus_data_version), _default_ttl(default_ttl), _enabled(enabled)
+    // `epoch_now` is read once when the compaction starts, rather than once per record.
+    KeyWithTTLCompactionFilter(uint32_t pegasus_data_version,
+                               uint32_t default_ttl,
+                               uint32_t epoch_now)
+        : _pegasus_data_version(pegasus_data_version),
+          _default_ttl(default_ttl),
+          _epoch_now(epoch_now)
     {
     }
 
@@ -29,21 +37,16 @@ public:
                 std::string *new_value,
                 bool *value_changed) const override
     {
-        if (!_enabled) {
-            return false;
-        }
-
         uint32_t expire_ts =
             pegasus_extract_expire_ts(_pegasus_data_version, utils::to_string_view(existing_value));
         if (_default_ttl != 0 && expire_ts == 0) {
             // should update ttl
             *new_value = existing_value.ToString();
-            pegasus_update_expire_ts(
-                _pegasus_data_version, *new_value, utils::epoch_now() + _default_ttl);
+            pegasus_update_expire_ts(_pegasus_data_version, *new_value, _epoch_now + _default_ttl);
             *value_changed = true;
             return false;
         }
-        return check_if_ts_expired(utils::epoch_now(), expire_ts);
+        return check_if_ts_expired(_epoch_now, expire_ts);
     }
 
     const char *Name() const override { return "KeyWithTTLCompactionFilter"; }
@@ -51,21 +54,32 @@ public:
 private:
     uint32_t _pegasus_data_version;
     uint32_t _default_ttl;
-    bool _enabled; // only process filtering when _enabled == true
-    mutable pegasus_value_generator _gen;
+    uint32_t _epoch_now;
 };
 
 class KeyWithTTLCompactionFilterFactory : public rocksdb::CompactionFilterFactory
 {
 public:
-    KeyWithTTLCompactionFilterFactory() : _pegasus_data_version(0), _default_ttl(0), _enabled(false)
+    KeyWithTTLCompactionFilterFactory()
+        : _pegasus_data_version(0),
+          _default_ttl(0),
+          _enabled(false),
+          _may_contain_ttl_records(true)
     {
     }
+
+    // No filter is created if it would neither drop nor change any record, i.e. there is no
+    // default ttl and no sst contains the records with ttl, so the compactions of the tables
+    // without ttl don't parse the values at all.
     std::unique_ptr<rocksdb::CompactionFilter>
     CreateCompactionFilter(const rocksdb::CompactionFilter::Context & /*context*/) override
     {
+        uint32_t default_ttl = _default_ttl.load();
+        if (!_enabled.load() || (default_ttl == 0 && !_may_contain_ttl_records.load())) {
+            return nullptr;
+        }
         return std::unique_ptr<KeyWithTTLCompactionFilter>(new KeyWithTTLCompactionFilter(
-            _pegasus_data_version.load(), _default_ttl.load(), _enabled.load()));
+            _pegasus_data_version.load(), default_ttl, utils::epoch_now()));
     }
     const char *Name() const override { return "KeyWithTTLCompactionFilterFactory"; }
 
@@ -76,10 +90,41 @@ public:
     void EnableFilter() { _enabled.store(true, std::memory_order_release); }
     void SetDefaultTTL(uint32_t ttl) { _default_ttl.store(ttl, std::memory_order_release); }
 
+    // Refreshed periodically by the ssts of the column family, since the input ssts are not
+    // given to CreateCompactionFilter. It may be stale, e.g. the records with ttl written after
+    // the refresh are compacted without filter, which only delays the removal of the expired
+    // records, since they are filtered by the reads anyway.
+    void SetMayContainTTLRecords(bool may_contain)
+    {
+        _may_contain_ttl_records.store(may_contain, std::memory_order_release);
+    }
+
+    // Returns true if any of the ssts may contain the records with ttl, according to the
+    // expire_stats collected by ExpireStatsCollector. The ssts without the stats, e.g. those
+    // generated before the collector is introduced, are assumed to contain such records.
+    static bool may_contain_ttl_records(const rocksdb::TablePropertiesCollection &ssts)
+    {
+        if (ssts.empty()) {
+            // the input ssts are unknown
+            return true;
+        }
+        for (const auto &sst : ssts) {
+            expire_stats stats;
+            if (sst.second == nullptr ||
+                !ExpireStatsCollector::parse_properties(sst.second->user_collected_properties,
+                                                        stats) ||
+                stats.max_expire_ts > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
 private:
     std::atomic<uint32_t> _pegasus_data_version;
     std::atomic<uint32_t> _default_ttl;
     std::atomic_bool _enabled; // only process filtering when _enabled == true
+    std::atomic_bool _may_contain_ttl_records;
 };
 
 } // namespace server
@@ -0,0 +1,168 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <dsn/utility/string_conv.h>
+#include <rocksdb/merge_operator.h>
+
+#include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+#include "pegasus_value_separation.h"
+
+namespace pegasus {
+namespace server {
+
+// The operand of a blind increment, which is written by `incr` without reading the old value
+// if the table is in blind incr mode (see TABLE_LEVEL_BLIND_INCR).
+//
+// operand = [increment(int64_t)] [expire_ts_seconds(int32_t)] [default_expire_ts(uint32_t)]
+//           [epoch_now(uint32_t)] [timetag(uint64_t)]
+//
+// `expire_ts_seconds` is the one in incr_request, `default_expire_ts` is given to the record
+// if it has no expire_ts after incremented (for the table level default ttl), and `epoch_now`
+// is the time when the increment is applied, by which the old value is checked for expiration.
+struct incr_merge_operand
+{
+    static const size_t SIZE = sizeof(int64_t) + sizeof(int32_t) + sizeof(uint32_t) * 2 +
+                               sizeof(uint64_t);
+
+    int64_t increment{0};
+    int32_t expire_ts_seconds{0};
+    uint32_t default_expire_ts{0};
+    uint32_t epoch_now{0};
+    uint64_t timetag{0};
+
+    void encode(std::string &buf) const
+    {
+        buf.resize(SIZE);
+        dsn::data_output(buf)
+            .write_u64(static_cast<uint64_t>(increment))
+            .write_u32(static_cast<uint32_t>(expire_ts_seconds))
+            .write_u32(default_expire_ts)
+            .write_u32(epoch_now)
+            .write_u64(timetag);
+    }
+
+    // returns false if `buf` is not an encoded operand.
+    bool decode(dsn::string_view buf)
+    {
+        if (buf.size() != SIZE) {
+            return false;
+        }
+        dsn::data_input input(buf);
+        increment = static_cast<int64_t>(input.read_u64());
+        expire_ts_seconds = static_cast<int32_t>(input.read_u32());
+        default_expire_ts = input.read_u32();
+        epoch_now = input.read_u32();
+        timetag = input.read_u64();
+        return true;
+    }
+};
+
+// The merge operator of the blind increments, which applies the operands on the old value in
+// the same way as `incr` does, when the value is read or compacted.
+//
+// Since an error can't be returned to the client after the increment is written, the operand
+// which can't be applied (the old value is not an integer, or the new value is out of range)
+// is skipped, which keeps the value unchanged just like a failed `incr`.
+//
+// The operands are not partially merged, because whether the old value is expired depends on
+// the time of each operand.
+//
+// An operand merged onto nothing is taken as the first increment of the record. It's correct
+// only because the increments are not written blindly while any record with ttl may exist,
+// whose removal by compaction would otherwise change the merged value, see can_blind_incr().
+class pegasus_incr_merge_operator : public rocksdb::MergeOperator
+{
+public:
+    pegasus_incr_merge_operator() : _pegasus_data_version(0) {}
+
+    bool FullMergeV2(const MergeOperationInput &merge_in,
+                     MergeOperationOutput *merge_out) const override
+    {
+        uint32_t version = _pegasus_data_version.load(std::memory_order_acquire);
+
+        bool exist = merge_in.existing_value != nullptr;
+        bool valid = true; // whether the old value is an integer
+        int64_t value = 0;
+        uint32_t expire_ts = 0;
+        uint64_t timetag = 0;
+        if (exist) {
+            dsn::string_view raw_value = utils::to_string_view(*merge_in.existing_value);
+            expire_ts = pegasus_extract_expire_ts(version, raw_value);
+            if (version >= 1) {
+                timetag = pegasus_extract_timetag(version, raw_value);
+            }
+            dsn::string_view user_data = pegasus_extract_user_data(version, raw_value);
+            // empty old value is taken as 0, and a separated value is too large to be an integer
+            valid = !pegasus_value_separation::is_separated(version, raw_value) &&
+                    (user_data.empty() || dsn::buf2int64(user_data, value));
+        }
+
+        bool changed = false;
+        incr_merge_operand op;
+        for (const rocksdb::Slice &operand : merge_in.operand_list) {
+            if (!op.decode(utils::to_string_view(operand))) {
+                return false;
+            }
+            if (!exist || check_if_ts_expired(op.epoch_now, expire_ts)) {
+                // old value is not found or expired, set to 0 before increment
+                exist = true;
+                valid = true;
+                value = op.increment;
+                expire_ts = op.expire_ts_seconds > 0 ? op.expire_ts_seconds : 0;
+            } else if (!valid) {
+                continue;
+            } else {
+                int64_t new_value = value + op.increment;
+                if ((op.increment > 0 && new_value < value) ||
+                    (op.increment < 0 && new_value > value)) {
+                    // new value is out of range
+                    continue;
+                }
+                value = new_value;
+                if (op.expire_ts_seconds < 0)
+                    expire_ts = 0;
+                else if (op.expire_ts_seconds > 0)
+                    expire_ts = op.expire_ts_seconds;
+            }
+            if (expire_ts == 0) {
+                expire_ts = op.default_expire_ts;
+            }
+            timetag = op.timetag;
+            changed = true;
+        }
+
+        if (!changed && merge_in.existing_value != nullptr) {
+            merge_out->new_value.assign(merge_in.existing_value->data(),
+                                        merge_in.existing_value->size());
+            return true;
+        }
+
+        pegasus_value_generator gen;
+        std::string user_data = std::to_string(value);
+        rocksdb::SliceParts parts = gen.generate_value(version, user_data, expire_ts, timetag);
+        merge_out->new_value.clear();
+        for (int i = 0; i < parts.num_parts; ++i) {
+            merge_out->new_value.append(parts.parts[i].data(), parts.parts[i].size());
+        }
+        return true;
+    }
+
+    const char *Name() const override { return "PegasusIncrMergeOperator"; }
+
+    void SetPegasusDataVersion(uint32_t version)
+    {
+        _pegasus_data_version.store(version, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> _pegasus_data_version;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -51,6 +51,15 @@ using namespace dsn::literals::chrono_literals;
         dsn::from_blob_to_thrift(data, thrift_request);
         return pegasus_hash_key_hash(thrift_request.hash_key);
     }
+    if (tc == dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE) {
+        dsn::apps::delete_range_request thrift_request;
+        dsn::from_blob_to_thrift(data, thrift_request);
+        // a cleared partition is cleared in the remote partition of the same index
+        if (thrift_request.clear_partition) {
+            return static_cast<uint64_t>(thrift_request.partition_index);
+        }
+        return pegasus_hash_key_hash(thrift_request.hash_key);
+    }
     dfatal("unexpected task code: %s", tc.to_string());
     __builtin_unreachable();
 }
@@ -173,6 +182,11 @@ void pegasus_mutation_duplicator::duplicate(mutation_tuple_set muts, callback cb
         // mut: 0=timestamp, 1=rpc_code, 2=raw_message
 
         dsn::task_code rpc_code = std::get<1>(mut);
+        if (rpc_code == dsn::apps::RPC_RRDB_RRDB_INGEST) {
+            // the sst files are in the local storage, they should be ingested into the
+            // remote cluster by its own bulk load.
+            continue;
+        }
         dsn::blob raw_message = std::get<2>(mut);
         auto dreq = dsn::make_unique<dsn::apps::duplicate_request>();
         uint64_t hash = get_hash_from_request(rpc_code, raw_message);
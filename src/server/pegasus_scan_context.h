@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <rocksdb/db.h>
 #include <dsn/tool_api.h>
 #include <dsn/utility/rand.h>
@@ -12,10 +15,42 @@
 
 #include "base/pegasus_const.h"
 #include "base/pegasus_utils.h"
+#include "pegasus_value_separation.h"
+#include "value_filter.h"
 
 namespace pegasus {
 namespace server {
 
+// The key referred by ReadOptions::iterate_lower_bound or iterate_upper_bound, which must be
+// alive and not moved while the iterator is used. The key can be reassigned before re-seeking
+// the iterator to reuse it for another range.
+struct iterate_bound
+{
+    iterate_bound() = default;
+    iterate_bound(const iterate_bound &) = delete;
+    iterate_bound &operator=(const iterate_bound &) = delete;
+
+    void assign_lower(const rocksdb::Slice &key)
+    {
+        buf.assign(key.data(), key.size());
+        slice = rocksdb::Slice(buf);
+    }
+
+    // the upper bound is exclusive, so an inclusive key is turned into the smallest key
+    // greater than it
+    void assign_upper(const rocksdb::Slice &key, bool inclusive)
+    {
+        buf.assign(key.data(), key.size());
+        if (inclusive) {
+            buf.push_back('\0');
+        }
+        slice = rocksdb::Slice(buf);
+    }
+
+    std::string buf;
+    rocksdb::Slice slice;
+};
+
 struct pegasus_scan_context
 {
     pegasus_scan_context(std::unique_ptr<rocksdb::Iterator> &&iterator_,
@@ -50,6 +85,11 @@ private:
     std::string _sort_key_filter_pattern_holder;
 
 public:
+    // the snapshot `iterator` reads on if the records may be separated, released after it
+    std::shared_ptr<const blob_read_snapshot> read_snapshot;
+    // referred by `iterator` if not null, so it is declared before `iterator` to be destroyed
+    // after it
+    std::unique_ptr<iterate_bound> upper_bound;
     std::unique_ptr<rocksdb::Iterator> iterator;
     rocksdb::Slice stop;
     bool stop_inclusive;
@@ -59,8 +99,15 @@ public:
     dsn::blob sort_key_filter_pattern;
     int32_t batch_size;
     bool no_value;
+    value_filter vfilter;
+    // the time when this context is put into the cache last time, used for ttl eviction
+    uint64_t last_access_time_ms = 0;
+    // reused as the response buffer for each batch, to avoid reallocation of the kvs vector
+    std::vector<::dsn::apps::key_value> kvs_buffer;
 };
 
+// The contexts are distributed into shards by the handle, each shard is protected by its
+// own spin lock, so that concurrent scanners of one replica rarely contend on the same lock.
 class pegasus_context_cache
 {
 public:
@@ -77,39 +124,99 @@ public:
         //
         // however, currently the implementation is not 100% correct.
         //
-        _counter = dsn::rand::next_u64(0, 2L << 31);
-        _counter <<= 32;
+        int64_t counter = dsn::rand::next_u64(0, 2L << 31);
+        _counter.store(counter << 32);
     }
 
     void clear()
     {
-        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
-        _map.clear();
+        for (auto &s : _shards) {
+            ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+            s.map.clear();
+        }
     }
 
+    // allocate a handle for the context which will be put later by put(handle, context)
+    int64_t alloc_handle() { return _counter.fetch_add(1, std::memory_order_relaxed); }
+
     int64_t put(std::unique_ptr<pegasus_scan_context> context)
     {
-        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
-        int64_t handle = _counter++;
-        _map[handle] = std::move(context);
+        int64_t handle = alloc_handle();
+        put(handle, std::move(context));
         return handle;
     }
 
+    void put(int64_t handle, std::unique_ptr<pegasus_scan_context> context)
+    {
+        context->last_access_time_ms = dsn_now_ms();
+        shard &s = get_shard(handle);
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+        s.map[handle] = std::move(context);
+    }
+
+    // swap the cleared `buffer` into the context of `handle` as its response buffer, if the
+    // context is still in the cache and `buffer` is larger than the buffer it holds
+    void recycle_buffer(int64_t handle, std::vector<::dsn::apps::key_value> &buffer)
+    {
+        shard &s = get_shard(handle);
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+        auto kv = s.map.find(handle);
+        if (kv != s.map.end() && kv->second->kvs_buffer.capacity() < buffer.capacity()) {
+            kv->second->kvs_buffer.swap(buffer);
+        }
+    }
+
     std::unique_ptr<pegasus_scan_context> fetch(int64_t handle)
     {
-        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
-        auto kv = _map.find(handle);
-        if (kv == _map.end())
+        shard &s = get_shard(handle);
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+        auto kv = s.map.find(handle);
+        if (kv == s.map.end())
             return nullptr;
         std::unique_ptr<pegasus_scan_context> ret = std::move(kv->second);
-        _map.erase(kv);
+        s.map.erase(kv);
         return ret;
     }
 
+    // remove the contexts which have not been accessed for `ttl_ms`, which are usually
+    // abandoned by crashed clients.
+    // return the count of removed contexts.
+    size_t remove_expired(uint64_t ttl_ms)
+    {
+        uint64_t now_ms = dsn_now_ms();
+        size_t count = 0;
+        for (auto &s : _shards) {
+            // the iterators are released out of the lock
+            std::vector<std::unique_ptr<pegasus_scan_context>> expired;
+            {
+                ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(s.lock);
+                for (auto it = s.map.begin(); it != s.map.end();) {
+                    if (it->second->last_access_time_ms + ttl_ms <= now_ms) {
+                        expired.emplace_back(std::move(it->second));
+                        it = s.map.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+            count += expired.size();
+        }
+        return count;
+    }
+
 private:
-    int64_t _counter;
-    std::unordered_map<int64_t, std::unique_ptr<pegasus_scan_context>> _map;
-    ::dsn::utils::ex_lock_nr_spin _lock;
+    static const int SHARD_COUNT = 16;
+
+    struct shard
+    {
+        std::unordered_map<int64_t, std::unique_ptr<pegasus_scan_context>> map;
+        ::dsn::utils::ex_lock_nr_spin lock;
+    };
+
+    shard &get_shard(int64_t handle) { return _shards[handle & (SHARD_COUNT - 1)]; }
+
+    std::atomic<int64_t> _counter;
+    shard _shards[SHARD_COUNT];
 };
 }
 }
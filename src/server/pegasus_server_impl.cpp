@@ -5,10 +5,12 @@
 #include "pegasus_server_impl.h"
 
 #include <algorithm>
+#include <numeric>
 #include <boost/lexical_cast.hpp>
 #include <rocksdb/convenience.h>
 #include <rocksdb/utilities/checkpoint.h>
 #include <rocksdb/filter_policy.h>
+#include <rocksdb/snapshot.h>
 #include <dsn/utility/chrono_literals.h>
 #include <dsn/utility/utils.h>
 #include <dsn/utility/filesystem.h>
@@ -21,6 +23,8 @@
 #include "base/pegasus_utils.h"
 #include "capacity_unit_calculator.h"
 #include "hashkey_transform.h"
+#include "hashkey_stats_collector.h"
+#include "expire_stats_collector.h"
 #include "pegasus_event_listener.h"
 #include "pegasus_server_write.h"
 #include "meta_store.h"
@@ -51,12 +55,15 @@ std::shared_ptr<rocksdb::Cache> pegasus_server_impl::_s_block_cache;
 const std::string pegasus_server_impl::COMPRESSION_HEADER = "per_level:";
 const std::string pegasus_server_impl::DATA_COLUMN_FAMILY_NAME = "default";
 const std::string pegasus_server_impl::META_COLUMN_FAMILY_NAME = "pegasus_meta_cf";
+const std::string pegasus_server_impl::BLOB_COLUMN_FAMILY_NAME = "pegasus_blob_cf";
 
 pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     : dsn::apps::rrdb_service(r),
+      _blob_read_snapshots([this]() { return last_committed_decree(); }),
       _db(nullptr),
       _data_cf(nullptr),
       _meta_cf(nullptr),
+      _blob_cf(nullptr),
       _is_open(false),
       _pegasus_data_version(PEGASUS_DATA_VERSION_MAX),
       _last_durable_decree(0),
@@ -94,6 +101,13 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
         "rocksdb_abnormal_multi_get_iterate_count_threshold",
         1000,
         "multi-get operation iterate count exceed this threshold will be logged, 0 means no check");
+    _abnormal_batch_write_time_threshold_ns = dsn_config_get_value_uint64(
+        "pegasus.server",
+        "rocksdb_abnormal_batch_write_time_threshold_ns",
+        100000000,
+        "batched write duration (from prepared on primary to written into rocksdb, the rpc "
+        "receiving and replying are not included) exceed this threshold will be logged with "
+        "the latency of each stage, 0 means no check");
 
     // init rocksdb::DBOptions
     _db_opts.pegasus_data = true;
@@ -284,6 +298,69 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     _key_ttl_compaction_filter_factory = std::make_shared<KeyWithTTLCompactionFilterFactory>();
     _data_cf_opts.compaction_filter_factory = _key_ttl_compaction_filter_factory;
 
+    // always set to read the merge operands of blind incr, even if the mode is turned off
+    _incr_merge_operator = std::make_shared<pegasus_incr_merge_operator>();
+    _data_cf_opts.merge_operator = _incr_merge_operator;
+
+    // hash key statistics for approximate sortkey_count.
+    uint64_t hashkey_stats_min_count =
+        dsn_config_get_value_uint64("pegasus.server",
+                                    "rocksdb_hashkey_stats_min_count",
+                                    1000,
+                                    "record count of the hash keys in a sst which have no less "
+                                    "than this count of records, 0 means disable");
+    if (hashkey_stats_min_count > 0) {
+        _data_cf_opts.table_properties_collector_factories.emplace_back(
+            std::make_shared<HashkeyStatsCollectorFactory>(hashkey_stats_min_count));
+    }
+
+    // expiration statistics of each sst, for dropping the ssts whose records all expired.
+    _data_cf_opts.table_properties_collector_factories.emplace_back(
+        std::make_shared<ExpireStatsCollectorFactory>());
+    _expired_file_drop_interval_seconds = (uint32_t)dsn_config_get_value_uint64(
+        "pegasus.server",
+        "expired_file_drop_interval_seconds",
+        3600,
+        "the interval to drop the ssts of which all the records have expired, in seconds, "
+        "0 means disable");
+
+    // the references to the blobs of each sst, for estimating the garbage of the blob ssts.
+    _blob_reference_collector_factory = std::make_shared<BlobReferenceCollectorFactory>();
+    _data_cf_opts.table_properties_collector_factories.emplace_back(
+        _blob_reference_collector_factory);
+
+    // the blob column family of the separated values, see pegasus_value_separation.
+    _blob_cf_opts = _data_cf_opts;
+    _blob_cf_opts.merge_operator = nullptr;
+    _blob_cf_opts.table_properties_collector_factories.clear();
+    _blob_compaction_filter_factory =
+        std::make_shared<BlobCompactionFilterFactory>(&_blob_read_snapshots);
+    _blob_cf_opts.compaction_filter_factory = _blob_compaction_filter_factory;
+    // append-only, the flushed ssts are never rewritten but by the blob gc, so the large values
+    // are not rewritten as they go down the levels. The number of level 0 ssts doesn't stall
+    // the writes when the automatic compactions are disabled.
+    _blob_cf_opts.disable_auto_compactions = true;
+    std::string blob_compression_str =
+        dsn_config_get_value_string("pegasus.server",
+                                    "rocksdb_blob_compression_type",
+                                    "lz4",
+                                    "rocksdb options.compression of the blob column family, in the "
+                                    "same format as rocksdb_compression_type");
+    dassert(parse_compression_types(blob_compression_str, _blob_cf_opts.compression_per_level),
+            "parse rocksdb_blob_compression_type failed.");
+    _blob_gc_interval_seconds = (uint32_t)dsn_config_get_value_uint64(
+        "pegasus.server",
+        "blob_gc_interval_seconds",
+        600,
+        "the interval to compact the ssts of the blob column family with much garbage, in "
+        "seconds, 0 means disable");
+    _blob_gc_garbage_ratio =
+        dsn_config_get_value_double("pegasus.server",
+                                    "blob_gc_garbage_ratio",
+                                    0.5,
+                                    "the sst of the blob column family is compacted by the blob gc "
+                                    "once the estimated ratio of its unreferred blobs reaches it");
+
     // get the checkpoint reserve options.
     _checkpoint_reserve_min_count_in_config = (uint32_t)dsn_config_get_value_uint64(
         "pegasus.server", "checkpoint_reserve_min_count", 2, "checkpoint_reserve_min_count");
@@ -298,6 +375,34 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     _update_rdb_stat_interval = std::chrono::seconds(dsn_config_get_value_uint64(
         "pegasus.server", "update_rdb_stat_interval", 600, "update_rdb_stat_interval, in seconds"));
 
+    _scan_context_ttl_seconds = (uint32_t)dsn_config_get_value_uint64(
+        "pegasus.server",
+        "scan_context_ttl_seconds",
+        300,
+        "the scan context which is not accessed for this time will be removed, in seconds");
+
+    _bulk_scan_readahead_size = dsn_config_get_value_uint64(
+        "pegasus.server",
+        "rocksdb_bulk_scan_readahead_size",
+        2 * 1024 * 1024,
+        "rocksdb readahead size for bulk scans which are hinted by client, in bytes");
+
+    _get_split_keys_max_split_count = (uint32_t)dsn_config_get_value_uint64(
+        "pegasus.server",
+        "get_split_keys_max_split_count",
+        1024,
+        "the split_count of get_split_keys requests larger than this value is clamped to it");
+
+    uint64_t read_cache_capacity =
+        dsn_config_get_value_uint64("pegasus.server",
+                                    "hotkey_read_cache_capacity",
+                                    0,
+                                    "capacity of the read cache of hot keys for GET requests "
+                                    "of each replica, in bytes, 0 means disabled");
+    if (read_cache_capacity > 0) {
+        _read_cache = dsn::make_unique<read_cache>(read_cache_capacity);
+    }
+
     // TODO: move the qps/latency counters and it's statistics to replication_app_base layer
     std::string str_gpid = _gpid.to_string();
     char name[256];
@@ -311,6 +416,12 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
     _pfc_multi_get_qps.init_app_counter(
         "app.pegasus", name, COUNTER_TYPE_RATE, "statistic the qps of MULTI_GET request");
 
+    snprintf(name, 255, "batch_multi_get_qps@%s", str_gpid.c_str());
+    _pfc_batch_multi_get_qps.init_app_counter("app.pegasus",
+                                              name,
+                                              COUNTER_TYPE_RATE,
+                                              "statistic the qps of BATCH_MULTI_GET request");
+
     snprintf(name, 255, "scan_qps@%s", str_gpid.c_str());
     _pfc_scan_qps.init_app_counter(
         "app.pegasus", name, COUNTER_TYPE_RATE, "statistic the qps of SCAN request");
@@ -327,6 +438,13 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
                                             COUNTER_TYPE_NUMBER_PERCENTILES,
                                             "statistic the latency of MULTI_GET request");
 
+    snprintf(name, 255, "batch_multi_get_latency@%s", str_gpid.c_str());
+    _pfc_batch_multi_get_latency.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_NUMBER_PERCENTILES,
+        "statistic the latency of BATCH_MULTI_GET request");
+
     snprintf(name, 255, "scan_latency@%s", str_gpid.c_str());
     _pfc_scan_latency.init_app_counter("app.pegasus",
                                        name,
@@ -345,12 +463,40 @@ pegasus_server_impl::pegasus_server_impl(dsn::replication::replica *r)
                                               COUNTER_TYPE_VOLATILE_NUMBER,
                                               "statistic the recent filtered value read count");
 
+    snprintf(name, 255, "recent.expired.file.drop.count@%s", str_gpid.c_str());
+    _pfc_recent_expired_file_drop_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent dropped sst count of which all the records have expired");
+
     snprintf(name, 255, "recent.abnormal.count@%s", str_gpid.c_str());
     _pfc_recent_abnormal_count.init_app_counter("app.pegasus",
                                                 name,
                                                 COUNTER_TYPE_VOLATILE_NUMBER,
                                                 "statistic the recent abnormal read count");
 
+    snprintf(name, 255, "recent.read_cache.hit.count@%s", str_gpid.c_str());
+    _pfc_recent_read_cache_hit_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent GET request count served by read cache");
+
+    snprintf(name, 255, "recent.read_cache.miss.count@%s", str_gpid.c_str());
+    _pfc_recent_read_cache_miss_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent GET request count missed in read cache");
+
+    snprintf(name, 255, "recent.read_cache.evict.count@%s", str_gpid.c_str());
+    _pfc_recent_read_cache_evict_count.init_app_counter(
+        "app.pegasus",
+        name,
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent evicted entry count of read cache");
+
     snprintf(name, 255, "disk.storage.sst.count@%s", str_gpid.c_str());
     _pfc_rdb_sst_count.init_app_counter(
         "app.pegasus", name, COUNTER_TYPE_NUMBER, "statistic the count of sstable files");
@@ -597,12 +743,38 @@ void pegasus_server_impl::on_get(const ::dsn::blob &key,
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    uint32_t epoch_now = utils::epoch_now();
+    uint64_t cache_version = 0;
+    if (_read_cache != nullptr) {
+        if (_read_cache->get(
+                dsn::string_view(key.data(), key.length()), epoch_now, resp.value)) {
+            _pfc_recent_read_cache_hit_count->increment();
+            resp.error = rocksdb::Status::kOk;
+            _cu_calculator->add_get_cu(resp.error, key, resp.value);
+            _pfc_get_latency->set(dsn_now_ns() - start_time);
+            reply(resp);
+            return;
+        }
+        _pfc_recent_read_cache_miss_count->increment();
+        // must be got before reading rocksdb, see read_cache
+        cache_version = _read_cache->version();
+    }
+
     rocksdb::Slice skey(key.data(), key.length());
-    std::string value;
-    rocksdb::Status status = _db->Get(_data_cf_rd_opts, _data_cf, skey, &value);
+    // the value is pinned in block cache if possible, and resp.value refers to it without copy.
+    // the slice is local to this get, since the gets of a replica may run concurrently.
+    rocksdb::PinnableSlice value;
+    // the record and its separated value are read on the same snapshot
+    rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
+    std::shared_ptr<const blob_read_snapshot> read_snapshot;
+    if (may_read_separated_values()) {
+        read_snapshot = _blob_read_snapshots.take(_db);
+        rd_opts.snapshot = read_snapshot->snapshot;
+    }
+    rocksdb::Status status = _db->Get(rd_opts, _data_cf, skey, &value);
 
     if (status.ok()) {
-        if (check_if_record_expired(utils::epoch_now(), value)) {
+        if (check_if_record_expired(epoch_now, value)) {
             _pfc_recent_expire_count->increment();
             if (_verbose_log) {
                 derror("%s: rocksdb data expired for get from %s",
@@ -656,12 +828,38 @@ void pegasus_server_impl::on_get(const ::dsn::blob &key,
 
     resp.error = status.code();
     if (status.ok()) {
-        pegasus_extract_user_data(_pegasus_data_version, std::move(value), resp.value);
+        dsn::string_view raw_value(value.data(), value.size());
+        uint32_t expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, raw_value);
+        dsn::string_view user_data = pegasus_extract_user_data(_pegasus_data_version, raw_value);
+        resp.value = ::dsn::blob(user_data.data(), 0, static_cast<unsigned int>(user_data.size()));
+        ::dsn::blob separated_value;
+        status = read_separated_value(
+            utils::to_string_view(skey), raw_value, rd_opts.snapshot, user_data, separated_value);
+        if (!status.ok()) {
+            derror("%s: read separated value failed for get from %s: error = %s",
+                   replica_name(),
+                   reply.to_address().to_string(),
+                   status.ToString().c_str());
+            resp.error = status.code();
+            resp.value = ::dsn::blob();
+        } else if (separated_value.length() > 0) {
+            resp.value = std::move(separated_value);
+        }
+        if (status.ok() && _read_cache != nullptr) {
+            // the value is copied into cache, so that no block of block cache is pinned by it
+            int evicted = _read_cache->put(dsn::string_view(key.data(), key.length()),
+                                           dsn::string_view(resp.value.data(), resp.value.length()),
+                                           expire_ts,
+                                           epoch_now,
+                                           cache_version);
+            _pfc_recent_read_cache_evict_count->add(evicted);
+        }
     }
 
     _cu_calculator->add_get_cu(resp.error, key, resp.value);
     _pfc_get_latency->set(dsn_now_ns() - start_time);
 
+    // the response is serialized by reply(), so the pinned value outlives its use
     reply(resp);
 }
 
@@ -677,16 +875,82 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    // the context holds the iterators and pinned values which are referred by resp.kvs,
+    // so it must be alive until the response is replied
+    multi_get_context context(_data_cf_rd_opts);
+    if (may_read_separated_values()) {
+        context.set_read_snapshot(_blob_read_snapshots.take(_db));
+    }
+    do_multi_get(request, reply.to_address(), context, resp);
+
+    _cu_calculator->add_multi_get_cu(resp.error, request.hash_key, resp.kvs);
+    _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
+
+    reply(resp);
+}
+
+void pegasus_server_impl::on_batch_multi_get(
+    const ::dsn::apps::batch_multi_get_request &request,
+    ::dsn::rpc_replier<::dsn::apps::batch_multi_get_response> &reply)
+{
+    dassert(_is_open, "");
+    _pfc_batch_multi_get_qps->increment();
+    uint64_t start_time = dsn_now_ns();
+
+    ::dsn::apps::batch_multi_get_response resp;
+    resp.app_id = _gpid.get_app_id();
+    resp.partition_index = _gpid.get_partition_index();
+    resp.server = _primary_address;
+
+    // all the requests are served on one snapshot to make the results consistent, and the
+    // iterators are reused across them to save the cost of creating iterators.
+    multi_get_context context(_data_cf_rd_opts);
+    context.set_read_snapshot(_blob_read_snapshots.take(_db));
+
+    resp.error = rocksdb::Status::kOk;
+    resp.responses.resize(request.requests.size());
+    for (size_t i = 0; i < request.requests.size(); i++) {
+        const ::dsn::apps::multi_get_request &sub_request = request.requests[i];
+        ::dsn::apps::multi_get_response &sub_resp = resp.responses[i];
+        sub_resp.app_id = resp.app_id;
+        sub_resp.partition_index = resp.partition_index;
+        do_multi_get(sub_request, reply.to_address(), context, sub_resp);
+        _cu_calculator->add_multi_get_cu(sub_resp.error, sub_request.hash_key, sub_resp.kvs);
+    }
+
+    _pfc_batch_multi_get_latency->set(dsn_now_ns() - start_time);
+
+    reply(resp);
+}
+
+void pegasus_server_impl::do_multi_get(const ::dsn::apps::multi_get_request &request,
+                                       const ::dsn::rpc_address &from,
+                                       multi_get_context &context,
+                                       ::dsn::apps::multi_get_response &resp)
+{
+    uint64_t start_time = dsn_now_ns();
+
     if (!is_filter_type_supported(request.sort_key_filter_type)) {
         derror("%s: invalid argument for multi_get from %s: "
                "sort key filter type %d not supported",
                replica_name(),
-               reply.to_address().to_string(),
+               from.to_string(),
                request.sort_key_filter_type);
         resp.error = rocksdb::Status::kInvalidArgument;
-        _cu_calculator->add_multi_get_cu(resp.error, request.hash_key, resp.kvs);
-        _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
-        reply(resp);
+        return;
+    }
+    value_filter vfilter;
+    std::string vfilter_err;
+    if (!vfilter.init(request.value_filter_type,
+                      request.value_filter_operand,
+                      request.value_offset,
+                      request.value_length,
+                      vfilter_err)) {
+        derror("%s: invalid argument for multi_get from %s: %s",
+               replica_name(),
+               from.to_string(),
+               vfilter_err.c_str());
+        resp.error = rocksdb::Status::kInvalidArgument;
         return;
     }
 
@@ -747,7 +1011,7 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                       "sort_key_filter_type = %s, sort_key_filter_pattern = \"%s\", "
                       "final_start = \"%s\" (%s), final_stop = \"%s\" (%s)",
                       replica_name(),
-                      reply.to_address().to_string(),
+                      from.to_string(),
                       ::pegasus::utils::c_escape_string(request.hash_key).c_str(),
                       ::pegasus::utils::c_escape_string(request.start_sortkey).c_str(),
                       request.start_inclusive ? "inclusive" : "exclusive",
@@ -762,16 +1026,26 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                       stop_inclusive ? "inclusive" : "exclusive");
             }
             resp.error = rocksdb::Status::kOk;
-            _cu_calculator->add_multi_get_cu(resp.error, request.hash_key, resp.kvs);
-            _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
-            reply(resp);
             return;
         }
 
-        std::unique_ptr<rocksdb::Iterator> it;
+        // bound the iterator to stop rocksdb from reading past the range, e.g. the tombstones
+        // of deleted sort keys or the records of neighbouring hash keys. The bounds are
+        // referred by the reused iterators, so they are reassigned before seeking.
+        context.lower_bound.assign_lower(start);
+        context.upper_bound.assign_upper(stop, stop_inclusive);
+        rocksdb::ReadOptions rd_opts(context.rd_opts);
+        rd_opts.iterate_lower_bound = &context.lower_bound.slice;
+        rd_opts.iterate_upper_bound = &context.upper_bound.slice;
+
+        std::shared_ptr<rocksdb::Iterator> it;
+        rocksdb::Status status;
         bool complete = false;
         if (!request.reverse) {
-            it.reset(_db->NewIterator(_data_cf_rd_opts, _data_cf));
+            if (!context.forward_it) {
+                context.forward_it.reset(_db->NewIterator(rd_opts, _data_cf));
+            }
+            it = context.forward_it;
             it->Seek(start);
             bool first_exclusive = !start_inclusive;
             while (count < max_kv_count && size < max_kv_size && it->Valid()) {
@@ -797,20 +1071,24 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
 
                 // extract value
                 int r = append_key_value_for_multi_get(resp.kvs,
-                                                       it->key(),
-                                                       it->value(),
+                                                       it,
                                                        request.sort_key_filter_type,
                                                        request.sort_key_filter_pattern,
+                                                       vfilter,
                                                        epoch_now,
-                                                       request.no_value);
+                                                       request.no_value,
+                                                       context.rd_opts.snapshot,
+                                                       status);
                 if (r == 1) {
                     count++;
                     auto &kv = resp.kvs.back();
                     size += kv.key.length() + kv.value.length();
                 } else if (r == 2) {
                     expire_count++;
-                } else { // r == 3
+                } else if (r == 3) {
                     filter_count++;
+                } else { // r == 4
+                    break;
                 }
 
                 if (c == 0) {
@@ -822,21 +1100,28 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                 it->Next();
             }
         } else { // reverse
-            rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
-            if (_data_cf_opts.prefix_extractor) {
-                // NOTE: Prefix bloom filter is not supported in reverse seek mode (see
-                // https://github.com/facebook/rocksdb/wiki/Prefix-Seek-API-Changes#limitation for
-                // more details), and we have to do total order seek on rocksdb which might be worse
-                // performance. However we consider that reverse scan is a rare use case, and if
-                // your workload has many reverse scans, you'd better use 'common' bloom filter (by
-                // set [pegasus.server]rocksdb_filter_type to 'common').
+            // NOTE: SeekForPrev() checks the prefix bloom filter by the prefix of the seek key,
+            // and the iterator stops at the prefix boundary with prefix_same_as_start. So prefix
+            // seek is only usable when 'stop' is in the hash key (i.e. stop_sortkey is given),
+            // otherwise we have to do total order seek, which is still bounded by the iterate
+            // bounds.
+            std::shared_ptr<rocksdb::Iterator> *reverse_it = &context.reverse_it;
+            const rocksdb::SliceTransform *prefix_extractor =
+                _data_cf_opts.prefix_extractor.get();
+            if (prefix_extractor != nullptr &&
+                prefix_extractor->Transform(stop) != prefix_extractor->Transform(start)) {
                 rd_opts.total_order_seek = true;
                 rd_opts.prefix_same_as_start = false;
+                reverse_it = &context.reverse_total_order_it;
+            }
+            if (!*reverse_it) {
+                reverse_it->reset(_db->NewIterator(rd_opts, _data_cf));
             }
-            it.reset(_db->NewIterator(rd_opts, _data_cf));
+            it = *reverse_it;
             it->SeekForPrev(stop);
             bool first_exclusive = !stop_inclusive;
-            std::vector<::dsn::apps::key_value> reverse_kvs;
+            // the kvs are appended in descending order, and reversed in place after the scan
+            size_t first_kv_index = resp.kvs.size();
             while (count < max_kv_count && size < max_kv_size && it->Valid()) {
                 // check start sort key
                 int c = it->key().compare(start);
@@ -859,21 +1144,25 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                 iterate_count++;
 
                 // extract value
-                int r = append_key_value_for_multi_get(reverse_kvs,
-                                                       it->key(),
-                                                       it->value(),
+                int r = append_key_value_for_multi_get(resp.kvs,
+                                                       it,
                                                        request.sort_key_filter_type,
                                                        request.sort_key_filter_pattern,
+                                                       vfilter,
                                                        epoch_now,
-                                                       request.no_value);
+                                                       request.no_value,
+                                                       context.rd_opts.snapshot,
+                                                       status);
                 if (r == 1) {
                     count++;
-                    auto &kv = reverse_kvs.back();
+                    auto &kv = resp.kvs.back();
                     size += kv.key.length() + kv.value.length();
                 } else if (r == 2) {
                     expire_count++;
-                } else { // r == 3
+                } else if (r == 3) {
                     filter_count++;
+                } else { // r == 4
+                    break;
                 }
 
                 if (c == 0) {
@@ -885,33 +1174,31 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                 it->Prev();
             }
 
-            if (it->status().ok() && !reverse_kvs.empty()) {
-                // revert order to make resp.kvs ordered in sort_key
-                resp.kvs.reserve(reverse_kvs.size());
-                for (int i = reverse_kvs.size() - 1; i >= 0; i--) {
-                    resp.kvs.emplace_back(std::move(reverse_kvs[i]));
-                }
-            }
+            // revert order to make resp.kvs ordered in sort_key
+            std::reverse(resp.kvs.begin() + first_kv_index, resp.kvs.end());
         }
 
-        resp.error = it->status().code();
-        if (!it->status().ok()) {
+        if (status.ok()) {
+            status = it->status();
+        }
+        resp.error = status.code();
+        if (!status.ok()) {
             // error occur
             if (_verbose_log) {
                 derror("%s: rocksdb scan failed for multi_get from %s: "
                        "hash_key = \"%s\", reverse = %s, error = %s",
                        replica_name(),
-                       reply.to_address().to_string(),
+                       from.to_string(),
                        ::pegasus::utils::c_escape_string(request.hash_key).c_str(),
                        request.reverse ? "true" : "false",
-                       it->status().ToString().c_str());
+                       status.ToString().c_str());
             } else {
                 derror("%s: rocksdb scan failed for multi_get from %s: "
                        "reverse = %s, error = %s",
                        replica_name(),
-                       reply.to_address().to_string(),
+                       from.to_string(),
                        request.reverse ? "true" : "false",
-                       it->status().ToString().c_str());
+                       status.ToString().c_str());
             }
             resp.kvs.clear();
         } else if (it->Valid() && !complete) {
@@ -922,52 +1209,98 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
         bool error_occurred = false;
         rocksdb::Status final_status;
         bool exceed_limit = false;
-        std::vector<::dsn::blob> keys_holder;
+        size_t key_count = request.sort_keys.size();
+        std::vector<::dsn::blob> keys_holder(key_count);
+        std::vector<rocksdb::Slice> raw_keys;
+        raw_keys.reserve(key_count);
+        for (size_t i = 0; i < key_count; i++) {
+            pegasus_generate_key(keys_holder[i], request.hash_key, request.sort_keys[i]);
+            raw_keys.emplace_back(keys_holder[i].data(), keys_holder[i].length());
+        }
+
+        // sort the raw keys to let the batched MultiGet look up all of them in one ordered
+        // pass over the memtables and SST files, and the values are pinned in block cache
+        // instead of being copied out.
+        std::vector<size_t> sorted_index(key_count);
+        std::iota(sorted_index.begin(), sorted_index.end(), 0);
+        std::sort(sorted_index.begin(), sorted_index.end(), [&raw_keys](size_t a, size_t b) {
+            return raw_keys[a].compare(raw_keys[b]) < 0;
+        });
         std::vector<rocksdb::Slice> keys;
-        std::vector<std::string> values;
-        keys_holder.reserve(request.sort_keys.size());
-        keys.reserve(request.sort_keys.size());
-        for (auto &sort_key : request.sort_keys) {
-            ::dsn::blob raw_key;
-            pegasus_generate_key(raw_key, request.hash_key, sort_key);
-            keys.emplace_back(raw_key.data(), raw_key.length());
-            keys_holder.emplace_back(std::move(raw_key));
-        }
-
-        std::vector<rocksdb::Status> statuses = _db->MultiGet(_data_cf_rd_opts, keys, &values);
-        for (int i = 0; i < keys.size(); i++) {
+        keys.reserve(key_count);
+        for (size_t idx : sorted_index) {
+            keys.emplace_back(raw_keys[idx]);
+        }
+
+        context.pinned_values.emplace_back(new rocksdb::PinnableSlice[key_count]);
+        rocksdb::PinnableSlice *pinned_values = context.pinned_values.back().get();
+        std::vector<rocksdb::Status> statuses(key_count);
+        _db->MultiGet(context.rd_opts,
+                      _data_cf,
+                      key_count,
+                      keys.data(),
+                      pinned_values,
+                      statuses.data(),
+                      true /* sorted_input */);
+        // the response is filled in the sorted order, which is the order of sort_key
+        for (size_t i = 0; i < key_count; i++) {
             rocksdb::Status &status = statuses[i];
-            std::string &value = values[i];
+            const rocksdb::PinnableSlice &value = pinned_values[i];
+            const ::dsn::blob &sort_key = request.sort_keys[sorted_index[i]];
             // print log
             if (!status.ok()) {
                 if (_verbose_log) {
                     derror("%s: rocksdb get failed for multi_get from %s: "
                            "hash_key = \"%s\", sort_key = \"%s\", error = %s",
                            replica_name(),
-                           reply.to_address().to_string(),
+                           from.to_string(),
                            ::pegasus::utils::c_escape_string(request.hash_key).c_str(),
-                           ::pegasus::utils::c_escape_string(request.sort_keys[i]).c_str(),
+                           ::pegasus::utils::c_escape_string(sort_key).c_str(),
                            status.ToString().c_str());
                 } else if (!status.IsNotFound()) {
                     derror("%s: rocksdb get failed for multi_get from %s: error = %s",
                            replica_name(),
-                           reply.to_address().to_string(),
+                           from.to_string(),
                            status.ToString().c_str());
                 }
             }
             // check ttl
             if (status.ok()) {
-                uint32_t expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, value);
+                uint32_t expire_ts = pegasus_extract_expire_ts(
+                    _pegasus_data_version, utils::to_string_view(value));
                 if (expire_ts > 0 && expire_ts <= epoch_now) {
                     expire_count++;
                     if (_verbose_log) {
                         derror("%s: rocksdb data expired for multi_get from %s",
                                replica_name(),
-                               reply.to_address().to_string());
+                               from.to_string());
                     }
                     status = rocksdb::Status::NotFound();
                 }
             }
+            // check value filter
+            dsn::string_view user_data;
+            ::dsn::blob separated_value;
+            if (status.ok() && (!request.no_value || vfilter.has_predicate())) {
+                user_data =
+                    pegasus_extract_user_data(_pegasus_data_version, utils::to_string_view(value));
+                status = read_separated_value(utils::to_string_view(keys[i]),
+                                              utils::to_string_view(value),
+                                              context.rd_opts.snapshot,
+                                              user_data,
+                                              separated_value);
+            }
+            if (status.ok() && (!request.no_value || vfilter.has_predicate())) {
+                if (!vfilter.match(user_data)) {
+                    filter_count++;
+                    if (_verbose_log) {
+                        derror("%s: value filtered for multi_get from %s",
+                               replica_name(),
+                               from.to_string());
+                    }
+                    continue;
+                }
+            }
             // extract value
             if (status.ok()) {
                 // check if exceed limit
@@ -976,9 +1309,18 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
                     break;
                 }
                 ::dsn::apps::key_value kv;
-                kv.key = request.sort_keys[i];
+                kv.key = sort_key;
                 if (!request.no_value) {
-                    pegasus_extract_user_data(_pegasus_data_version, std::move(value), kv.value);
+                    // refer to the pinned memory (or the separated value) directly, which is
+                    // kept alive until the response is serialized
+                    user_data = vfilter.project(user_data);
+                    if (separated_value.length() > 0) {
+                        kv.value = separated_value.range(
+                            static_cast<int>(user_data.data() - separated_value.data()),
+                            static_cast<int>(user_data.length()));
+                    } else {
+                        kv.value.assign(user_data.data(), 0, user_data.length());
+                    }
                 }
                 count++;
                 size += kv.key.length() + kv.value.length();
@@ -1016,7 +1358,7 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
             "max_kv_count = {}, max_kv_size = {}, reverse = {}, "
             "result_count = {}, result_size = {}, iterate_count = {}, "
             "expire_count = {}, filter_count = {}, time_used = {} ns",
-            reply.to_address().to_string(),
+            from.to_string(),
             ::pegasus::utils::c_escape_string(request.hash_key),
             ::pegasus::utils::c_escape_string(request.start_sortkey),
             request.start_inclusive ? "inclusive" : "exclusive",
@@ -1042,15 +1384,28 @@ void pegasus_server_impl::on_multi_get(const ::dsn::apps::multi_get_request &req
     if (filter_count > 0) {
         _pfc_recent_filter_count->add(filter_count);
     }
+}
 
-    _cu_calculator->add_multi_get_cu(resp.error, request.hash_key, resp.kvs);
-    _pfc_multi_get_latency->set(dsn_now_ns() - start_time);
+void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
+                                           ::dsn::rpc_replier<::dsn::apps::count_response> &reply)
+{
+    dassert(_is_open, "");
+
+    ::dsn::apps::count_response resp;
+    resp.app_id = _gpid.get_app_id();
+    resp.partition_index = _gpid.get_partition_index();
+    resp.server = _primary_address;
+
+    exact_sortkey_count(hash_key, reply.to_address(), resp);
+
+    _cu_calculator->add_sortkey_count_cu(resp.error);
 
     reply(resp);
 }
 
-void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
-                                           ::dsn::rpc_replier<::dsn::apps::count_response> &reply)
+void pegasus_server_impl::on_sortkey_count_v2(
+    const ::dsn::apps::count_request &request,
+    ::dsn::rpc_replier<::dsn::apps::count_response> &reply)
 {
     dassert(_is_open, "");
 
@@ -1059,6 +1414,24 @@ void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
     resp.partition_index = _gpid.get_partition_index();
     resp.server = _primary_address;
 
+    if (request.mode == ::dsn::apps::count_mode::CM_APPROXIMATE &&
+        approximate_sortkey_count(request.hash_key, resp.count)) {
+        resp.error = rocksdb::Status::kOk;
+    } else {
+        // the statistics are incomplete if any sst of the hash key has not recorded it, which
+        // is usually a small hash key that is cheap to count exactly.
+        exact_sortkey_count(request.hash_key, reply.to_address(), resp);
+    }
+
+    _cu_calculator->add_sortkey_count_cu(resp.error);
+
+    reply(resp);
+}
+
+void pegasus_server_impl::exact_sortkey_count(const ::dsn::blob &hash_key,
+                                              const ::dsn::rpc_address &from,
+                                              ::dsn::apps::count_response &resp)
+{
     // scan
     ::dsn::blob start_key, stop_key;
     pegasus_generate_key(start_key, hash_key, ::dsn::blob());
@@ -1078,7 +1451,7 @@ void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
             if (_verbose_log) {
                 derror("%s: rocksdb data expired for sortkey_count from %s",
                        replica_name(),
-                       reply.to_address().to_string());
+                       from.to_string());
             }
         } else {
             resp.count++;
@@ -1096,21 +1469,62 @@ void pegasus_server_impl::on_sortkey_count(const ::dsn::blob &hash_key,
             derror("%s: rocksdb scan failed for sortkey_count from %s: "
                    "hash_key = \"%s\", error = %s",
                    replica_name(),
-                   reply.to_address().to_string(),
+                   from.to_string(),
                    ::pegasus::utils::c_escape_string(hash_key).c_str(),
                    it->status().ToString().c_str());
         } else {
             derror("%s: rocksdb scan failed for sortkey_count from %s: error = %s",
                    replica_name(),
-                   reply.to_address().to_string(),
+                   from.to_string(),
                    it->status().ToString().c_str());
         }
         resp.count = 0;
     }
+}
 
-    _cu_calculator->add_sortkey_count_cu(resp.error);
+bool pegasus_server_impl::approximate_sortkey_count(const ::dsn::blob &hash_key, int64_t &count)
+{
+    ::dsn::blob start_key, stop_key;
+    pegasus_generate_key(start_key, hash_key, ::dsn::blob());
+    pegasus_generate_next_blob(stop_key, hash_key);
+    rocksdb::Range range(rocksdb::Slice(start_key.data(), start_key.length()),
+                         rocksdb::Slice(stop_key.data(), stop_key.length()));
 
-    reply(resp);
+    // the properties of ssts are cached along with the table readers, so it is much cheaper than
+    // iterating when the hash key has lots of records.
+    rocksdb::TablePropertiesCollection props;
+    rocksdb::Status status = _db->GetPropertiesOfTablesInRange(_data_cf, &range, 1, &props);
+    if (!status.ok()) {
+        derror("%s: get properties of tables failed for sortkey_count: error = %s",
+               replica_name(),
+               status.ToString().c_str());
+        return false;
+    }
+
+    std::string property_name =
+        HashkeyStatsCollector::property_name(rocksdb::Slice(hash_key.data(), hash_key.length()));
+    uint64_t total = 0;
+    for (const auto &kv : props) {
+        // a sst overlapping the range without the statistics may hold some records of the hash
+        // key which are not recorded, so fall back to the exact count rather than undercount.
+        const auto &user_props = kv.second->user_collected_properties;
+        auto iter = user_props.find(property_name);
+        uint64_t sst_count = 0;
+        if (iter == user_props.end() ||
+            !HashkeyStatsCollector::parse_property(iter->second, sst_count)) {
+            return false;
+        }
+        total += sst_count;
+    }
+    if (props.empty()) {
+        return false;
+    }
+
+    uint64_t memtable_count = 0;
+    uint64_t memtable_size = 0;
+    _db->GetApproximateMemTableStats(_data_cf, range, &memtable_count, &memtable_size);
+    count = static_cast<int64_t>(total + memtable_count);
+    return true;
 }
 
 void pegasus_server_impl::on_ttl(const ::dsn::blob &key,
@@ -1212,6 +1626,23 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         reply(resp);
         return;
     }
+    value_filter vfilter;
+    std::string vfilter_err;
+    if (!vfilter.init(request.value_filter_type,
+                      request.value_filter_operand,
+                      request.value_offset,
+                      request.value_length,
+                      vfilter_err)) {
+        derror("%s: invalid argument for get_scanner from %s: %s",
+               replica_name(),
+               reply.to_address().to_string(),
+               vfilter_err.c_str());
+        resp.error = rocksdb::Status::kInvalidArgument;
+        _cu_calculator->add_scan_cu(resp.error, resp.kvs);
+        _pfc_scan_latency->set(dsn_now_ns() - start_time);
+        reply(resp);
+        return;
+    }
 
     rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
     if (_data_cf_opts.prefix_extractor) {
@@ -1224,6 +1655,12 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
             rd_opts.prefix_same_as_start = false;
         }
     }
+    if (request.bulk_scan) {
+        // large scans such as data export would pollute the block cache with blocks that are
+        // read only once, and benefit from reading ahead larger chunks of sst files.
+        rd_opts.fill_cache = false;
+        rd_opts.readahead_size = _bulk_scan_readahead_size;
+    }
     bool start_inclusive = request.start_inclusive;
     bool stop_inclusive = request.stop_inclusive;
     rocksdb::Slice start(request.start_key.data(), request.start_key.length());
@@ -1271,6 +1708,22 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         return;
     }
 
+    // bound the iterator to stop rocksdb from reading past the range, e.g. the tombstones of
+    // deleted sort keys when scanning a single hash key. The bound is held by the scan context
+    // along with the iterator.
+    auto upper_bound = dsn::make_unique<iterate_bound>();
+    upper_bound->assign_upper(stop, stop_inclusive);
+    rd_opts.iterate_upper_bound = &upper_bound->slice;
+
+    // the scan reads on a snapshot held by its context if the records may be separated, so
+    // that the separated values are kept until the scan finishes, see blob_read_snapshots
+    std::shared_ptr<const blob_read_snapshot> read_snapshot;
+    if (may_read_separated_values()) {
+        read_snapshot = _blob_read_snapshots.take(_db);
+        rd_opts.snapshot = read_snapshot->snapshot;
+    }
+
+    std::unique_ptr<pegasus_scan_context> context;
     std::unique_ptr<rocksdb::Iterator> it(_db->NewIterator(rd_opts, _data_cf));
     it->Seek(start);
     bool complete = false;
@@ -1279,6 +1732,7 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
     uint64_t expire_count = 0;
     uint64_t filter_count = 0;
     int32_t count = 0;
+    rocksdb::Status status;
     resp.kvs.reserve(request.batch_size);
     while (count < request.batch_size && it->Valid()) {
         int c = it->key().compare(stop);
@@ -1304,14 +1758,19 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
                                           request.hash_key_filter_pattern,
                                           request.sort_key_filter_type,
                                           request.sort_key_filter_pattern,
+                                          vfilter,
                                           epoch_now,
-                                          request.no_value);
+                                          request.no_value,
+                                          rd_opts.snapshot,
+                                          status);
         if (r == 1) {
             count++;
         } else if (r == 2) {
             expire_count++;
-        } else { // r == 3
+        } else if (r == 3) {
             filter_count++;
+        } else { // r == 4
+            break;
         }
 
         if (c == 0) {
@@ -1323,8 +1782,11 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
         it->Next();
     }
 
-    resp.error = it->status().code();
-    if (!it->status().ok()) {
+    if (status.ok()) {
+        status = it->status();
+    }
+    resp.error = status.code();
+    if (!status.ok()) {
         // error occur
         if (_verbose_log) {
             derror("%s: rocksdb scan failed for get_scanner from %s: "
@@ -1338,17 +1800,17 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
                    request.stop_inclusive ? "inclusive" : "exclusive",
                    request.batch_size,
                    count,
-                   it->status().ToString().c_str());
+                   status.ToString().c_str());
         } else {
             derror("%s: rocksdb scan failed for get_scanner from %s: error = %s",
                    replica_name(),
                    reply.to_address().to_string(),
-                   it->status().ToString().c_str());
+                   status.ToString().c_str());
         }
         resp.kvs.clear();
     } else if (it->Valid() && !complete) {
         // scan not completed
-        std::unique_ptr<pegasus_scan_context> context(
+        context.reset(
             new pegasus_scan_context(std::move(it),
                                      std::string(stop.data(), stop.size()),
                                      request.stop_inclusive,
@@ -1360,16 +1822,12 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
                                                  request.sort_key_filter_pattern.length()),
                                      request.batch_size,
                                      request.no_value));
-        int64_t handle = _context_cache.put(std::move(context));
-        resp.context_id = handle;
-        // if the context is used, it will be fetched and re-put into cache,
-        // which will change the handle,
-        // then the delayed task will fetch null context by old handle, and do nothing.
-        ::dsn::tasking::enqueue(LPC_PEGASUS_SERVER_DELAY,
-                                &_tracker,
-                                [this, handle]() { _context_cache.fetch(handle); },
-                                0,
-                                std::chrono::minutes(5));
+        context->read_snapshot = std::move(read_snapshot);
+        context->upper_bound = std::move(upper_bound);
+        context->vfilter = std::move(vfilter);
+        // if the context is used, it will be fetched and re-put into cache with a new handle.
+        // if not, it will be removed by the timer task after it is expired.
+        resp.context_id = _context_cache.alloc_handle();
     } else {
         // scan completed
         resp.context_id = pegasus::SCAN_CONTEXT_ID_COMPLETED;
@@ -1385,7 +1843,18 @@ void pegasus_server_impl::on_get_scanner(const ::dsn::apps::get_scanner_request
     _cu_calculator->add_scan_cu(resp.error, resp.kvs);
     _pfc_scan_latency->set(dsn_now_ns() - start_time);
 
+    // the context is put before the response is replied, so that the next request of the scan
+    // always finds it, even if it's processed concurrently with the rest of this request
+    bool context_cached = (context != nullptr);
+    if (context_cached) {
+        _context_cache.put(resp.context_id, std::move(context));
+    }
+
     reply(resp);
+
+    if (context_cached) {
+        recycle_scan_buffer(resp);
+    }
 }
 
 void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
@@ -1402,6 +1871,8 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
 
     std::unique_ptr<pegasus_scan_context> context = _context_cache.fetch(request.context_id);
     if (context) {
+        // reuse the response buffer of the last batch
+        resp.kvs.swap(context->kvs_buffer);
         rocksdb::Iterator *it = context->iterator.get();
         int32_t batch_size = context->batch_size;
         const rocksdb::Slice &stop = context->stop;
@@ -1410,12 +1881,16 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
         const ::dsn::blob &hash_key_filter_pattern = context->hash_key_filter_pattern;
         ::dsn::apps::filter_type::type sort_key_filter_type = context->sort_key_filter_type;
         const ::dsn::blob &sort_key_filter_pattern = context->sort_key_filter_pattern;
+        const value_filter &vfilter = context->vfilter;
         bool no_value = context->no_value;
+        const rocksdb::Snapshot *snapshot =
+            context->read_snapshot != nullptr ? context->read_snapshot->snapshot : nullptr;
         bool complete = false;
         uint32_t epoch_now = ::pegasus::utils::epoch_now();
         uint64_t expire_count = 0;
         uint64_t filter_count = 0;
         int32_t count = 0;
+        rocksdb::Status status;
 
         while (count < batch_size && it->Valid()) {
             int c = it->key().compare(stop);
@@ -1432,14 +1907,19 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
                                               hash_key_filter_pattern,
                                               sort_key_filter_type,
                                               sort_key_filter_pattern,
+                                              vfilter,
                                               epoch_now,
-                                              no_value);
+                                              no_value,
+                                              snapshot,
+                                              status);
             if (r == 1) {
                 count++;
             } else if (r == 2) {
                 expire_count++;
-            } else { // r == 3
+            } else if (r == 3) {
                 filter_count++;
+            } else { // r == 4
+                break;
             }
 
             if (c == 0) {
@@ -1451,8 +1931,11 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
             it->Next();
         }
 
-        resp.error = it->status().code();
-        if (!it->status().ok()) {
+        if (status.ok()) {
+            status = it->status();
+        }
+        resp.error = status.code();
+        if (!status.ok()) {
             // error occur
             if (_verbose_log) {
                 derror("%s: rocksdb scan failed for scan from %s: "
@@ -1465,26 +1948,22 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
                        stop_inclusive ? "inclusive" : "exclusive",
                        batch_size,
                        count,
-                       it->status().ToString().c_str());
+                       status.ToString().c_str());
             } else {
                 derror("%s: rocksdb scan failed for scan from %s: error = %s",
                        replica_name(),
                        reply.to_address().to_string(),
-                       it->status().ToString().c_str());
+                       status.ToString().c_str());
             }
             resp.kvs.clear();
+            context.reset();
         } else if (it->Valid() && !complete) {
             // scan not completed
-            int64_t handle = _context_cache.put(std::move(context));
-            resp.context_id = handle;
-            ::dsn::tasking::enqueue(LPC_PEGASUS_SERVER_DELAY,
-                                    &_tracker,
-                                    [this, handle]() { _context_cache.fetch(handle); },
-                                    0,
-                                    std::chrono::minutes(5));
+            resp.context_id = _context_cache.alloc_handle();
         } else {
             // scan completed
             resp.context_id = pegasus::SCAN_CONTEXT_ID_COMPLETED;
+            context.reset();
         }
 
         if (expire_count > 0) {
@@ -1500,11 +1979,134 @@ void pegasus_server_impl::on_scan(const ::dsn::apps::scan_request &request,
     _cu_calculator->add_scan_cu(resp.error, resp.kvs);
     _pfc_scan_latency->set(dsn_now_ns() - start_time);
 
+    // the context is put before the response is replied, so that the next request of the scan
+    // always finds it, even if it's processed concurrently with the rest of this request
+    bool context_cached = (context != nullptr);
+    if (context_cached) {
+        _context_cache.put(resp.context_id, std::move(context));
+    }
+
     reply(resp);
+
+    if (context_cached) {
+        recycle_scan_buffer(resp);
+    }
+}
+
+void pegasus_server_impl::recycle_scan_buffer(::dsn::apps::scan_response &resp)
+{
+    // the values are released out of the lock of the cache
+    resp.kvs.clear();
+    _context_cache.recycle_buffer(resp.context_id, resp.kvs);
 }
 
 void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache.fetch(args); }
 
+void pegasus_server_impl::on_get_split_keys(
+    const ::dsn::apps::get_split_keys_request &args,
+    ::dsn::rpc_replier<::dsn::apps::get_split_keys_response> &reply)
+{
+    dassert(_is_open, "");
+
+    ::dsn::apps::get_split_keys_response resp;
+    resp.app_id = _gpid.get_app_id();
+    resp.partition_index = _gpid.get_partition_index();
+    resp.server = _primary_address;
+
+    if (args.split_count <= 0) {
+        derror("%s: invalid argument for get_split_keys from %s: split_count = %d",
+               replica_name(),
+               reply.to_address().to_string(),
+               args.split_count);
+        resp.error = rocksdb::Status::kInvalidArgument;
+        reply(resp);
+        return;
+    }
+
+    std::vector<std::string> split_keys;
+    calc_split_keys(args.split_count, split_keys);
+    resp.split_keys.reserve(split_keys.size());
+    for (auto &key : split_keys) {
+        resp.split_keys.emplace_back(::dsn::blob::create_from_bytes(std::move(key)));
+    }
+    resp.error = rocksdb::Status::kOk;
+    reply(resp);
+}
+
+void pegasus_server_impl::calc_split_keys(int split_count, std::vector<std::string> &split_keys)
+{
+    split_keys.clear();
+    if (split_count > 0 && static_cast<uint32_t>(split_count) > _get_split_keys_max_split_count) {
+        dwarn_replica("split_count {} of get_split_keys is clamped to {}",
+                      split_count,
+                      _get_split_keys_max_split_count);
+        split_count = static_cast<int>(_get_split_keys_max_split_count);
+    }
+    if (split_count <= 1) {
+        return;
+    }
+
+    // the candidates of the split keys are the boundaries of the ssts, which are got from the
+    // metadata in memory without any io
+    rocksdb::ColumnFamilyMetaData meta;
+    _db->GetColumnFamilyMetaData(_data_cf, &meta);
+    std::vector<std::string> candidates;
+    for (const auto &level : meta.levels) {
+        for (const auto &file : level.files) {
+            candidates.emplace_back(file.smallestkey);
+            candidates.emplace_back(file.largestkey);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // sample the candidates evenly to bound the cost of the size approximation
+    const size_t max_candidate_count = static_cast<size_t>(split_count) * 16;
+    if (candidates.size() > max_candidate_count) {
+        std::vector<std::string> sampled;
+        sampled.reserve(max_candidate_count);
+        for (size_t i = 0; i < max_candidate_count; ++i) {
+            sampled.emplace_back(
+                std::move(candidates[i * (candidates.size() - 1) / (max_candidate_count - 1)]));
+        }
+        candidates = std::move(sampled);
+    }
+    if (candidates.size() < 3) {
+        return;
+    }
+
+    // approximate the size of the data between each two adjacent candidates, including the
+    // data in the memtables. the data out of the candidates are only in the memtables, which
+    // are ignored.
+    std::vector<rocksdb::Range> ranges;
+    ranges.reserve(candidates.size() - 1);
+    for (size_t i = 0; i + 1 < candidates.size(); ++i) {
+        ranges.emplace_back(candidates[i], candidates[i + 1]);
+    }
+    std::vector<uint64_t> sizes(ranges.size(), 0);
+    uint8_t include_flags = rocksdb::DB::SizeApproximationFlags::INCLUDE_FILES |
+                            rocksdb::DB::SizeApproximationFlags::INCLUDE_MEMTABLES;
+    _db->GetApproximateSizes(
+        _data_cf, ranges.data(), static_cast<int>(ranges.size()), sizes.data(), include_flags);
+    uint64_t total_size = 0;
+    for (uint64_t size : sizes) {
+        total_size += size;
+    }
+    if (total_size == 0) {
+        return;
+    }
+
+    // the end of a range becomes a split key once the data before it reaches the next share
+    uint64_t accumulated_size = 0;
+    const size_t max_split_key_count = static_cast<size_t>(split_count) - 1;
+    for (size_t i = 0; i + 1 < ranges.size() && split_keys.size() < max_split_key_count; ++i) {
+        accumulated_size += sizes[i];
+        if (accumulated_size * split_count >= total_size * (split_keys.size() + 1)) {
+            split_keys.emplace_back(candidates[i + 1]);
+        }
+    }
+}
+
 ::dsn::error_code pegasus_server_impl::start(int argc, char **argv)
 {
     dassert_replica(!_is_open, "replica is already opened.");
@@ -1616,20 +2218,34 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
         // data (meta column family).
         _db_opts.create_missing_column_families = true;
     }
+    bool need_create_blob_cf = true;
+    if (db_exist && check_blob_cf(path, &need_create_blob_cf) != ::dsn::ERR_OK) {
+        derror_replica("check blob column family failed");
+        return ::dsn::ERR_LOCAL_APP_FAILURE;
+    }
+    if (need_create_blob_cf) {
+        // If upgrade from an old Pegasus version without value separation, the blob column
+        // family is created empty.
+        _db_opts.create_missing_column_families = true;
+    }
 
     std::vector<rocksdb::ColumnFamilyDescriptor> column_families(
-        {{DATA_COLUMN_FAMILY_NAME, _data_cf_opts}, {META_COLUMN_FAMILY_NAME, _meta_cf_opts}});
+        {{DATA_COLUMN_FAMILY_NAME, _data_cf_opts},
+         {META_COLUMN_FAMILY_NAME, _meta_cf_opts},
+         {BLOB_COLUMN_FAMILY_NAME, _blob_cf_opts}});
     std::vector<rocksdb::ColumnFamilyHandle *> handles_opened;
     auto status = rocksdb::DB::Open(_db_opts, path, column_families, &handles_opened, &_db);
     if (!status.ok()) {
         derror_replica("rocksdb::DB::Open failed, error = {}", status.ToString());
         return ::dsn::ERR_LOCAL_APP_FAILURE;
     }
-    dcheck_eq_replica(2, handles_opened.size());
+    dcheck_eq_replica(3, handles_opened.size());
     dcheck_eq_replica(handles_opened[0]->GetName(), DATA_COLUMN_FAMILY_NAME);
     dcheck_eq_replica(handles_opened[1]->GetName(), META_COLUMN_FAMILY_NAME);
+    dcheck_eq_replica(handles_opened[2]->GetName(), BLOB_COLUMN_FAMILY_NAME);
     _data_cf = handles_opened[0];
     _meta_cf = handles_opened[1];
+    _blob_cf = handles_opened[2];
 
     // Create _meta_store which provide Pegasus meta data read and write.
     _meta_store = dsn::make_unique<meta_store>(this, _db, _meta_cf);
@@ -1656,6 +2272,9 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
     // only enable filter after correct pegasus_data_version set
     _key_ttl_compaction_filter_factory->SetPegasusDataVersion(_pegasus_data_version);
     _key_ttl_compaction_filter_factory->EnableFilter();
+    _incr_merge_operator->SetPegasusDataVersion(_pegasus_data_version);
+    _blob_compaction_filter_factory->SetDB(_db, _pegasus_data_version);
+    _blob_reference_collector_factory->SetPegasusDataVersion(_pegasus_data_version);
 
     // update LastManualCompactFinishTime
     _manual_compact_svc.init_last_finish_time_ms(last_manual_compact_finish_time);
@@ -1695,6 +2314,35 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
                                       [this]() { this->update_replica_rocksdb_statistics(); },
                                       _update_rdb_stat_interval);
 
+    _scan_context_gc_timer = ::dsn::tasking::enqueue_timer(
+        LPC_PEGASUS_SERVER_DELAY,
+        &_tracker,
+        [this]() {
+            size_t count = _context_cache.remove_expired(_scan_context_ttl_seconds * 1000ULL);
+            if (count > 0) {
+                ddebug_replica("removed {} expired scan contexts", count);
+            }
+        },
+        std::chrono::seconds(std::max(_scan_context_ttl_seconds / 10, 1u)));
+
+    if (_expired_file_drop_interval_seconds > 0) {
+        _expired_file_drop_timer = ::dsn::tasking::enqueue_timer(
+            LPC_REPLICATION_LONG_COMMON,
+            &_tracker,
+            [this]() { this->drop_expired_files(); },
+            std::chrono::seconds(_expired_file_drop_interval_seconds));
+    }
+
+    // whether the blob column family is empty is refreshed by the blob gc
+    _blob_cf_may_have_data.store(true, std::memory_order_relaxed);
+    if (_blob_gc_interval_seconds > 0) {
+        _blob_gc_timer = ::dsn::tasking::enqueue_timer(
+            LPC_REPLICATION_LONG_COMMON,
+            &_tracker,
+            [this]() { this->gc_blob_files(); },
+            std::chrono::seconds(_blob_gc_interval_seconds));
+    }
+
     // Block cache is a singleton on this server shared by all replicas, its metrics update task
     // should be scheduled once an interval on the server view.
     static std::once_flag flag;
@@ -1710,6 +2358,17 @@ void pegasus_server_impl::on_clear_scanner(const int64_t &args) { _context_cache
     // initialize cu calculator and write service after server being initialized.
     _cu_calculator = dsn::make_unique<capacity_unit_calculator>(this);
     _server_write = dsn::make_unique<pegasus_server_write>(this, _verbose_log);
+    _server_write->set_blind_incr(_blind_incr);
+    _server_write->set_value_separation_min_size(_value_separation_min_size);
+    {
+        // the memtables are empty after opened, so whether there are records with ttl is known
+        // from the ssts, and the records replayed from the log are checked when written
+        rocksdb::TablePropertiesCollection props;
+        rocksdb::Status s = _db->GetPropertiesOfAllTables(_data_cf, &props);
+        _server_write->set_may_contain_ttl_records(
+            !s.ok() ||
+            (!props.empty() && KeyWithTTLCompactionFilterFactory::may_contain_ttl_records(props)));
+    }
 
     return ::dsn::ERR_OK;
 }
@@ -1739,9 +2398,24 @@ void pegasus_server_impl::cancel_background_work(bool wait)
         _update_replica_rdb_stat->cancel(true);
         _update_replica_rdb_stat = nullptr;
     }
+    if (_scan_context_gc_timer != nullptr) {
+        _scan_context_gc_timer->cancel(true);
+        _scan_context_gc_timer = nullptr;
+    }
+    if (_expired_file_drop_timer != nullptr) {
+        _expired_file_drop_timer->cancel(true);
+        _expired_file_drop_timer = nullptr;
+    }
+    if (_blob_gc_timer != nullptr) {
+        _blob_gc_timer->cancel(true);
+        _blob_gc_timer = nullptr;
+    }
     _tracker.cancel_outstanding_tasks();
 
     _context_cache.clear();
+    if (_read_cache != nullptr) {
+        _read_cache->clear();
+    }
 
     _is_open = false;
     release_db();
@@ -2169,21 +2843,10 @@ bool pegasus_server_impl::validate_filter(::dsn::apps::filter_type::type filter_
         return true;
     case ::dsn::apps::filter_type::FT_MATCH_ANYWHERE:
     case ::dsn::apps::filter_type::FT_MATCH_PREFIX:
-    case ::dsn::apps::filter_type::FT_MATCH_POSTFIX: {
-        if (filter_pattern.length() == 0)
-            return true;
-        if (value.length() < filter_pattern.length())
-            return false;
-        if (filter_type == ::dsn::apps::filter_type::FT_MATCH_ANYWHERE) {
-            return dsn::string_view(value).find(filter_pattern) != dsn::string_view::npos;
-        } else if (filter_type == ::dsn::apps::filter_type::FT_MATCH_PREFIX) {
-            return ::memcmp(value.data(), filter_pattern.data(), filter_pattern.length()) == 0;
-        } else { // filter_type == ::dsn::apps::filter_type::FT_MATCH_POSTFIX
-            return ::memcmp(value.data() + value.length() - filter_pattern.length(),
-                            filter_pattern.data(),
-                            filter_pattern.length()) == 0;
-        }
-    }
+    case ::dsn::apps::filter_type::FT_MATCH_POSTFIX:
+        return match_pattern(to_pattern_match_type(filter_type),
+                             dsn::string_view(value),
+                             dsn::string_view(filter_pattern));
     default:
         dassert(false, "unsupported filter type: %d", filter_type);
     }
@@ -2198,8 +2861,11 @@ int pegasus_server_impl::append_key_value_for_scan(
     const ::dsn::blob &hash_key_filter_pattern,
     ::dsn::apps::filter_type::type sort_key_filter_type,
     const ::dsn::blob &sort_key_filter_pattern,
+    const value_filter &vfilter,
     uint32_t epoch_now,
-    bool no_value)
+    bool no_value,
+    const rocksdb::Snapshot *snapshot,
+    rocksdb::Status &status)
 {
     if (check_if_record_expired(epoch_now, value)) {
         if (_verbose_log) {
@@ -2231,14 +2897,37 @@ int pegasus_server_impl::append_key_value_for_scan(
             return 3;
         }
     }
-    std::shared_ptr<char> key_buf(::dsn::utils::make_shared_array<char>(raw_key.length()));
-    ::memcpy(key_buf.get(), raw_key.data(), raw_key.length());
-    kv.key.assign(std::move(key_buf), 0, raw_key.length());
-
-    // extract value
+    dsn::string_view user_data;
+    ::dsn::blob separated_value;
+    if (!no_value || vfilter.has_predicate()) {
+        user_data = pegasus_extract_user_data(_pegasus_data_version, utils::to_string_view(value));
+        status = read_separated_value(utils::to_string_view(key),
+                                      utils::to_string_view(value),
+                                      snapshot,
+                                      user_data,
+                                      separated_value);
+        if (!status.ok()) {
+            derror("%s: read separated value failed for scan: error = %s",
+                   replica_name(),
+                   status.ToString().c_str());
+            return 4;
+        }
+        if (!vfilter.match(user_data)) {
+            if (_verbose_log) {
+                derror("%s: value filtered for scan", replica_name());
+            }
+            return 3;
+        }
+        user_data = no_value ? dsn::string_view() : vfilter.project(user_data);
+    }
+    // copy the key and the user data into one buffer, to allocate only once for each record
+    std::shared_ptr<char> buf(
+        ::dsn::utils::make_shared_array<char>(raw_key.length() + user_data.length()));
+    ::memcpy(buf.get(), raw_key.data(), raw_key.length());
+    kv.key.assign(buf, 0, raw_key.length());
     if (!no_value) {
-        std::string value_buf(value.data(), value.size());
-        pegasus_extract_user_data(_pegasus_data_version, std::move(value_buf), kv.value);
+        ::memcpy(buf.get() + raw_key.length(), user_data.data(), user_data.length());
+        kv.value.assign(std::move(buf), raw_key.length(), user_data.length());
     }
 
     kvs.emplace_back(std::move(kv));
@@ -2247,13 +2936,17 @@ int pegasus_server_impl::append_key_value_for_scan(
 
 int pegasus_server_impl::append_key_value_for_multi_get(
     std::vector<::dsn::apps::key_value> &kvs,
-    const rocksdb::Slice &key,
-    const rocksdb::Slice &value,
+    const std::shared_ptr<rocksdb::Iterator> &it,
     ::dsn::apps::filter_type::type sort_key_filter_type,
     const ::dsn::blob &sort_key_filter_pattern,
+    const value_filter &vfilter,
     uint32_t epoch_now,
-    bool no_value)
+    bool no_value,
+    const rocksdb::Snapshot *snapshot,
+    rocksdb::Status &status)
 {
+    rocksdb::Slice key = it->key();
+    rocksdb::Slice value = it->value();
     if (check_if_record_expired(epoch_now, value)) {
         if (_verbose_log) {
             derror("%s: rocksdb data expired for multi get", replica_name());
@@ -2274,22 +2967,254 @@ int pegasus_server_impl::append_key_value_for_multi_get(
         }
         return 3;
     }
-    std::shared_ptr<char> sort_key_buf(::dsn::utils::make_shared_array<char>(sort_key.length()));
-    ::memcpy(sort_key_buf.get(), sort_key.data(), sort_key.length());
-    kv.key.assign(std::move(sort_key_buf), 0, sort_key.length());
+    dsn::string_view user_data;
+    ::dsn::blob separated_value;
+    if (!no_value || vfilter.has_predicate()) {
+        user_data = pegasus_extract_user_data(_pegasus_data_version, utils::to_string_view(value));
+        status = read_separated_value(utils::to_string_view(key),
+                                      utils::to_string_view(value),
+                                      snapshot,
+                                      user_data,
+                                      separated_value);
+        if (!status.ok()) {
+            derror("%s: read separated value failed for multi get: error = %s",
+                   replica_name(),
+                   status.ToString().c_str());
+            return 4;
+        }
+        if (!vfilter.match(user_data)) {
+            if (_verbose_log) {
+                derror("%s: value filtered for multi get", replica_name());
+            }
+            return 3;
+        }
+    }
+    if (is_iterator_data_pinned(it.get(), "rocksdb.iterator.is-key-pinned")) {
+        std::shared_ptr<char> sort_key_buf(it, const_cast<char *>(sort_key.data()));
+        kv.key.assign(std::move(sort_key_buf), 0, sort_key.length());
+    } else {
+        std::shared_ptr<char> sort_key_buf(
+            ::dsn::utils::make_shared_array<char>(sort_key.length()));
+        ::memcpy(sort_key_buf.get(), sort_key.data(), sort_key.length());
+        kv.key.assign(std::move(sort_key_buf), 0, sort_key.length());
+    }
 
     // extract value
     if (!no_value) {
-        std::string value_buf(value.data(), value.size());
-        pegasus_extract_user_data(_pegasus_data_version, std::move(value_buf), kv.value);
+        user_data = vfilter.project(user_data);
+        if (separated_value.length() > 0) {
+            kv.value = separated_value.range(
+                static_cast<int>(user_data.data() - separated_value.data()),
+                static_cast<int>(user_data.length()));
+        } else if (is_iterator_data_pinned(it.get(), "rocksdb.iterator.is-value-pinned")) {
+            std::shared_ptr<char> value_buf(it, const_cast<char *>(user_data.data()));
+            kv.value.assign(std::move(value_buf), 0, user_data.length());
+        } else {
+            // only the projected bytes are copied
+            std::shared_ptr<char> value_buf(
+                ::dsn::utils::make_shared_array<char>(user_data.length()));
+            ::memcpy(value_buf.get(), user_data.data(), user_data.length());
+            kv.value.assign(std::move(value_buf), 0, user_data.length());
+        }
     }
 
     kvs.emplace_back(std::move(kv));
     return 1;
 }
 
+void pegasus_server_impl::drop_expired_files()
+{
+    rocksdb::TablePropertiesCollection props;
+    rocksdb::Status s = _db->GetPropertiesOfAllTables(_data_cf, &props);
+    if (!s.ok()) {
+        derror_replica("GetPropertiesOfAllTables failed, error = {}", s.ToString());
+        return;
+    }
+
+    std::vector<rocksdb::LiveFileMetaData> files;
+    _db->GetLiveFilesMetaData(&files);
+
+    int bottommost_level = -1;
+    for (const auto &file : files) {
+        if (file.column_family_name == DATA_COLUMN_FAMILY_NAME) {
+            bottommost_level = std::max(bottommost_level, file.level);
+        }
+    }
+    if (bottommost_level <= 0) {
+        // the ssts in level 0 may overlap each other, leave them to compactions
+        return;
+    }
+
+    uint32_t epoch_now = utils::epoch_now();
+    int dropped_count = 0;
+    uint64_t dropped_size = 0;
+    for (const auto &file : files) {
+        if (file.column_family_name != DATA_COLUMN_FAMILY_NAME || file.level != bottommost_level ||
+            file.being_compacted) {
+            continue;
+        }
+        // the property collection is keyed by the full path of sst
+        auto find = props.find(file.db_path + file.name);
+        expire_stats stats;
+        if (find == props.end() ||
+            !ExpireStatsCollector::parse_properties(find->second->user_collected_properties,
+                                                    stats) ||
+            !stats.all_expired(epoch_now)) {
+            continue;
+        }
+        // rocksdb rejects it if the sst has been compacted or is not in the last level any more
+        s = _db->DeleteFile(file.name);
+        if (!s.ok()) {
+            dwarn_replica("drop expired sst {} failed, error = {}", file.name, s.ToString());
+            continue;
+        }
+        dropped_count++;
+        dropped_size += file.size;
+    }
+
+    if (dropped_count > 0) {
+        _pfc_recent_expired_file_drop_count->add(dropped_count);
+        ddebug_replica("dropped {} expired ssts in level {}, total size = {} bytes",
+                       dropped_count,
+                       bottommost_level,
+                       dropped_size);
+    }
+}
+
+void pegasus_server_impl::gc_blob_files()
+{
+    rocksdb::ColumnFamilyMetaData blob_meta;
+    _db->GetColumnFamilyMetaData(_blob_cf, &blob_meta);
+    uint64_t mem_entries = 0, imm_entries = 0;
+    bool may_have_data =
+        blob_meta.file_count > 0 ||
+        !_db->GetIntProperty(
+            _blob_cf, rocksdb::DB::Properties::kNumEntriesActiveMemTable, &mem_entries) ||
+        !_db->GetIntProperty(
+            _blob_cf, rocksdb::DB::Properties::kNumEntriesImmMemTables, &imm_entries) ||
+        mem_entries > 0 || imm_entries > 0;
+    _blob_cf_may_have_data.store(may_have_data, std::memory_order_relaxed);
+    if (blob_meta.file_count == 0) {
+        return;
+    }
+
+    rocksdb::TablePropertiesCollection data_props, blob_props;
+    rocksdb::Status s = _db->GetPropertiesOfAllTables(_data_cf, &data_props);
+    if (s.ok()) {
+        s = _db->GetPropertiesOfAllTables(_blob_cf, &blob_props);
+    }
+    if (!s.ok()) {
+        derror_replica("GetPropertiesOfAllTables failed, error = {}", s.ToString());
+        return;
+    }
+    std::vector<blob_reference_stats> references;
+    references.reserve(data_props.size());
+    for (const auto &kv : data_props) {
+        blob_reference_stats stats;
+        if (!BlobReferenceCollector::parse_properties(kv.second->user_collected_properties,
+                                                      stats)) {
+            // the references of the sst are unknown, so the garbage can't be estimated
+            return;
+        }
+        references.emplace_back(std::move(stats));
+    }
+
+    // compress as the blob ssts flushed into level 0
+    rocksdb::CompactionOptions compact_opts;
+    compact_opts.compression = _blob_cf_opts.compression_per_level.empty()
+                                   ? _blob_cf_opts.compression
+                                   : _blob_cf_opts.compression_per_level[0];
+    int compacted_count = 0;
+    uint64_t compacted_size = 0;
+    for (const auto &level : blob_meta.levels) {
+        for (const auto &file : level.files) {
+            // the property collection is keyed by the full path of sst
+            auto find = blob_props.find(file.db_path + file.name);
+            dsn::string_view raw_key;
+            int64_t first_decree = 0, last_decree = 0;
+            if (file.being_compacted || find == blob_props.end() ||
+                find->second->num_entries == 0 ||
+                !pegasus_value_separation::restore_blob_key(
+                    file.smallestkey, raw_key, first_decree) ||
+                !pegasus_value_separation::restore_blob_key(
+                    file.largestkey, raw_key, last_decree)) {
+                continue;
+            }
+            double referred_count = 0;
+            for (const auto &stats : references) {
+                referred_count += stats.count_in(first_decree, last_decree);
+            }
+            double garbage_ratio = 1 - referred_count / find->second->num_entries;
+            if (garbage_ratio < _blob_gc_garbage_ratio) {
+                continue;
+            }
+            // the blob keys of different ssts never overlap, so a single sst can be compacted
+            // in place. The unreferred blobs are removed by BlobCompactionFilter.
+            s = _db->CompactFiles(compact_opts, _blob_cf, {file.name}, level.level);
+            if (!s.ok()) {
+                dwarn_replica("compact blob sst {} failed, error = {}", file.name, s.ToString());
+                continue;
+            }
+            compacted_count++;
+            compacted_size += file.size;
+        }
+    }
+
+    if (compacted_count > 0) {
+        ddebug_replica("compacted {} blob ssts with much garbage, total size = {} bytes",
+                       compacted_count,
+                       compacted_size);
+    }
+}
+
+rocksdb::Status pegasus_server_impl::read_separated_value(dsn::string_view raw_key,
+                                                          dsn::string_view raw_value,
+                                                          const rocksdb::Snapshot *snapshot,
+                                                          dsn::string_view &user_data,
+                                                          ::dsn::blob &holder)
+{
+    if (!pegasus_value_separation::is_separated(_pegasus_data_version, raw_value)) {
+        return rocksdb::Status::OK();
+    }
+    int64_t decree = 0;
+    if (!pegasus_value_separation::extract_reference(user_data, decree)) {
+        return rocksdb::Status::Corruption("invalid reference of separated value");
+    }
+
+    std::string blob_key;
+    pegasus_value_separation::generate_blob_key(raw_key, decree, blob_key);
+    auto value = std::make_shared<std::string>();
+    rocksdb::ReadOptions rd_opts(_data_cf_rd_opts);
+    rd_opts.snapshot = snapshot;
+    rocksdb::Status s = _db->Get(rd_opts, _blob_cf, blob_key, value.get());
+    if (s.IsNotFound()) {
+        return rocksdb::Status::Corruption("separated value not found");
+    }
+    if (!s.ok()) {
+        return s;
+    }
+    std::shared_ptr<char> buf(value, const_cast<char *>(value->data()));
+    holder.assign(std::move(buf), 0, static_cast<unsigned int>(value->size()));
+    user_data = dsn::string_view(holder.data(), holder.length());
+    return s;
+}
+
+void pegasus_server_impl::update_may_contain_ttl_records()
+{
+    rocksdb::TablePropertiesCollection props;
+    rocksdb::Status s = _db->GetPropertiesOfAllTables(_data_cf, &props);
+    if (!s.ok()) {
+        derror_replica("GetPropertiesOfAllTables failed, error = {}", s.ToString());
+        return;
+    }
+    _key_ttl_compaction_filter_factory->SetMayContainTTLRecords(
+        KeyWithTTLCompactionFilterFactory::may_contain_ttl_records(props));
+}
+
 void pegasus_server_impl::update_replica_rocksdb_statistics()
 {
+    update_may_contain_ttl_records();
+
     std::string str_val;
     uint64_t val = 0;
     for (int i = 0; i < _data_cf_opts.num_levels; ++i) {
@@ -2395,6 +3320,8 @@ void pegasus_server_impl::update_app_envs(const std::map<std::string, std::strin
 {
     update_usage_scenario(envs);
     update_default_ttl(envs);
+    update_blind_incr(envs);
+    update_value_separation(envs);
     update_checkpoint_reserve(envs);
     update_slow_query_threshold(envs);
     _manual_compact_svc.start_manual_compact_if_needed(envs);
@@ -2410,6 +3337,8 @@ void pegasus_server_impl::update_app_envs_before_open_db(
 {
     // we do not update usage scenario because it depends on opened db.
     update_default_ttl(envs);
+    update_blind_incr(envs);
+    update_value_separation(envs);
     update_checkpoint_reserve(envs);
     update_slow_query_threshold(envs);
     _manual_compact_svc.start_manual_compact_if_needed(envs);
@@ -2454,6 +3383,41 @@ void pegasus_server_impl::update_default_ttl(const std::map<std::string, std::st
         }
         _server_write->set_default_ttl(static_cast<uint32_t>(ttl));
         _key_ttl_compaction_filter_factory->SetDefaultTTL(static_cast<uint32_t>(ttl));
+        if (_read_cache != nullptr) {
+            _read_cache->set_default_ttl(static_cast<uint32_t>(ttl));
+        }
+    }
+}
+
+void pegasus_server_impl::update_blind_incr(const std::map<std::string, std::string> &envs)
+{
+    bool blind_incr = false;
+    auto find = envs.find(TABLE_LEVEL_BLIND_INCR);
+    if (find != envs.end() && !dsn::buf2bool(find->second, blind_incr)) {
+        derror_replica("{}={} is invalid.", find->first, find->second);
+        return;
+    }
+    _blind_incr = blind_incr;
+    // the write service is not created yet when the db is being opened, the value is given to
+    // it once created
+    if (_server_write != nullptr) {
+        _server_write->set_blind_incr(blind_incr);
+    }
+}
+
+void pegasus_server_impl::update_value_separation(const std::map<std::string, std::string> &envs)
+{
+    int32_t min_size = 0;
+    auto find = envs.find(TABLE_LEVEL_VALUE_SEPARATION_MIN_SIZE);
+    if (find != envs.end() &&
+        (!dsn::buf2int32(find->second, min_size) || min_size < 0 ||
+         (min_size > 0 && min_size < pegasus_value_separation::MIN_SEPARATED_VALUE_SIZE))) {
+        derror_replica("{}={} is invalid.", find->first, find->second);
+        return;
+    }
+    _value_separation_min_size = static_cast<uint32_t>(min_size);
+    if (_server_write != nullptr) {
+        _server_write->set_value_separation_min_size(_value_separation_min_size);
     }
 }
 
@@ -2811,11 +3775,31 @@ void pegasus_server_impl::set_partition_version(int32_t partition_version)
     return ::dsn::ERR_OK;
 }
 
+::dsn::error_code pegasus_server_impl::check_blob_cf(const std::string &path,
+                                                     bool *need_create_blob_cf)
+{
+    *need_create_blob_cf = true;
+    std::vector<std::string> column_families;
+    auto s = rocksdb::DB::ListColumnFamilies(rocksdb::DBOptions(), path, &column_families);
+    if (!s.ok()) {
+        derror_replica("rocksdb::DB::ListColumnFamilies failed, error = {}", s.ToString());
+        return ::dsn::ERR_LOCAL_APP_FAILURE;
+    }
+
+    for (const auto &column_family : column_families) {
+        if (column_family == BLOB_COLUMN_FAMILY_NAME) {
+            *need_create_blob_cf = false;
+            break;
+        }
+    }
+    return ::dsn::ERR_OK;
+}
+
 ::dsn::error_code pegasus_server_impl::flush_all_family_columns(bool wait)
 {
     rocksdb::FlushOptions options;
     options.wait = wait;
-    rocksdb::Status status = _db->Flush(options, {_meta_cf, _data_cf});
+    rocksdb::Status status = _db->Flush(options, {_meta_cf, _data_cf, _blob_cf});
     if (!status.ok()) {
         derror_replica("flush failed, error = {}", status.ToString());
         return ::dsn::ERR_LOCAL_APP_FAILURE;
@@ -2829,6 +3813,9 @@ void pegasus_server_impl::release_db()
     _data_cf = nullptr;
     _db->DestroyColumnFamilyHandle(_meta_cf);
     _meta_cf = nullptr;
+    _db->DestroyColumnFamilyHandle(_blob_cf);
+    _blob_cf = nullptr;
+    _blob_compaction_filter_factory->SetDB(nullptr, _pegasus_data_version);
     delete _db;
     _db = nullptr;
 }
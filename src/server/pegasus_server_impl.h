@@ -16,9 +16,13 @@
 #include <gtest/gtest_prod.h>
 
 #include "key_ttl_compaction_filter.h"
+#include "pegasus_incr_merge_operator.h"
+#include "pegasus_value_separation.h"
+#include "blob_reference_collector.h"
 #include "pegasus_scan_context.h"
 #include "pegasus_manual_compact_service.h"
 #include "pegasus_write_service.h"
+#include "read_cache.h"
 
 namespace pegasus {
 namespace server {
@@ -45,8 +49,14 @@ public:
                         ::dsn::rpc_replier<::dsn::apps::read_response> &reply) override;
     virtual void on_multi_get(const ::dsn::apps::multi_get_request &args,
                               ::dsn::rpc_replier<::dsn::apps::multi_get_response> &reply) override;
+    virtual void on_batch_multi_get(
+        const ::dsn::apps::batch_multi_get_request &args,
+        ::dsn::rpc_replier<::dsn::apps::batch_multi_get_response> &reply) override;
     virtual void on_sortkey_count(const ::dsn::blob &args,
                                   ::dsn::rpc_replier<::dsn::apps::count_response> &reply) override;
+    virtual void
+    on_sortkey_count_v2(const ::dsn::apps::count_request &args,
+                        ::dsn::rpc_replier<::dsn::apps::count_response> &reply) override;
     virtual void on_ttl(const ::dsn::blob &key,
                         ::dsn::rpc_replier<::dsn::apps::ttl_response> &reply) override;
     virtual void on_get_scanner(const ::dsn::apps::get_scanner_request &args,
@@ -54,6 +64,9 @@ public:
     virtual void on_scan(const ::dsn::apps::scan_request &args,
                          ::dsn::rpc_replier<::dsn::apps::scan_response> &reply) override;
     virtual void on_clear_scanner(const int64_t &args) override;
+    virtual void on_get_split_keys(
+        const ::dsn::apps::get_split_keys_request &args,
+        ::dsn::rpc_replier<::dsn::apps::get_split_keys_response> &reply) override;
 
     // input:
     //  - argc = 0 : re-open the db
@@ -175,9 +188,65 @@ private:
 
     void set_last_durable_decree(int64_t decree) { _last_durable_decree.store(decree); }
 
+    // give the kvs vector of a replied response back to the scan context of resp.context_id,
+    // as the response buffer of its next batch
+    void recycle_scan_buffer(::dsn::apps::scan_response &resp);
+
+    // the rocksdb read resources shared by the multi_get requests served together
+    struct multi_get_context
+    {
+        explicit multi_get_context(const rocksdb::ReadOptions &opts) : rd_opts(opts)
+        {
+            // pin the blocks loaded by the iterators until they are deleted, so that the
+            // returned keys and values can refer to them without copy. The iterators are held
+            // by the kvs of responses, which are bounded by max_kv_count and max_kv_size.
+            rd_opts.pin_data = true;
+        }
+
+        // read all the records and their separated values on the snapshot
+        void set_read_snapshot(std::shared_ptr<const blob_read_snapshot> &&snapshot)
+        {
+            read_snapshot = std::move(snapshot);
+            rd_opts.snapshot = read_snapshot->snapshot;
+        }
+
+        rocksdb::ReadOptions rd_opts;
+        std::shared_ptr<const blob_read_snapshot> read_snapshot;
+        // the bounds of the iterators, reassigned for each range read
+        iterate_bound lower_bound;
+        iterate_bound upper_bound;
+        // created on demand and reused by the range reads
+        std::shared_ptr<rocksdb::Iterator> forward_it;
+        std::shared_ptr<rocksdb::Iterator> reverse_it;
+        std::shared_ptr<rocksdb::Iterator> reverse_total_order_it;
+        // values pinned by the batched MultiGet, must be alive until the response is replied
+        std::vector<std::unique_ptr<rocksdb::PinnableSlice[]>> pinned_values;
+    };
+
+    // serve a multi_get request with the read resources in `context`, set resp.error and resp.kvs
+    void do_multi_get(const ::dsn::apps::multi_get_request &request,
+                      const ::dsn::rpc_address &from,
+                      multi_get_context &context,
+                      ::dsn::apps::multi_get_response &resp);
+
+    // calculate at most `split_count - 1` sorted keys, which split the data of this partition
+    // into key ranges of roughly equal size, `split_count` is clamped to
+    // `_get_split_keys_max_split_count`
+    void calc_split_keys(int split_count, std::vector<std::string> &split_keys);
+
+    // count the sortkeys of `hash_key` by iterating all its records, set resp.error and resp.count
+    void exact_sortkey_count(const ::dsn::blob &hash_key,
+                             const ::dsn::rpc_address &from,
+                             ::dsn::apps::count_response &resp);
+
+    // estimate the sortkey count of `hash_key` by the hash key statistics of ssts and memtables,
+    // return false if any sst overlapping the hash key has no statistics of it
+    bool approximate_sortkey_count(const ::dsn::blob &hash_key, int64_t &count);
+
     // return 1 if value is appended
     // return 2 if value is expired
     // return 3 if value is filtered
+    // return 4 if the separated value is failed to read, with the error in `status`
     int append_key_value_for_scan(std::vector<::dsn::apps::key_value> &kvs,
                                   const rocksdb::Slice &key,
                                   const rocksdb::Slice &value,
@@ -185,19 +254,37 @@ private:
                                   const ::dsn::blob &hash_key_filter_pattern,
                                   ::dsn::apps::filter_type::type sort_key_filter_type,
                                   const ::dsn::blob &sort_key_filter_pattern,
+                                  const value_filter &vfilter,
                                   uint32_t epoch_now,
-                                  bool no_value);
+                                  bool no_value,
+                                  const rocksdb::Snapshot *snapshot,
+                                  /*out*/ rocksdb::Status &status);
 
     // return 1 if value is appended
     // return 2 if value is expired
     // return 3 if value is filtered
+    // return 4 if the separated value is failed to read, with the error in `status`
+    // the key and value are referred directly from `it` if they are pinned by it
     int append_key_value_for_multi_get(std::vector<::dsn::apps::key_value> &kvs,
-                                       const rocksdb::Slice &key,
-                                       const rocksdb::Slice &value,
+                                       const std::shared_ptr<rocksdb::Iterator> &it,
                                        ::dsn::apps::filter_type::type sort_key_filter_type,
                                        const ::dsn::blob &sort_key_filter_pattern,
+                                       const value_filter &vfilter,
                                        uint32_t epoch_now,
-                                       bool no_value);
+                                       bool no_value,
+                                       const rocksdb::Snapshot *snapshot,
+                                       /*out*/ rocksdb::Status &status);
+
+    // If the record `raw_value` of `raw_key` is separated, see pegasus_value_separation, reads
+    // the separated value into `holder` and refers `user_data` to it.
+    // `snapshot` is the one `raw_value` is read on, taken from _blob_read_snapshots.
+    // A separated record without blob is a Corruption, since the blob is kept as long as the
+    // record refers to it.
+    rocksdb::Status read_separated_value(dsn::string_view raw_key,
+                                         dsn::string_view raw_value,
+                                         const rocksdb::Snapshot *snapshot,
+                                         dsn::string_view &user_data,
+                                         ::dsn::blob &holder);
 
     // return true if the filter type is supported
     bool is_filter_type_supported(::dsn::apps::filter_type::type filter_type)
@@ -211,8 +298,32 @@ private:
                          const ::dsn::blob &filter_pattern,
                          const ::dsn::blob &value);
 
+    // It also refreshes whether the compactions need KeyWithTTLCompactionFilter, since the
+    // statistics timer is always running.
     void update_replica_rocksdb_statistics();
 
+    // refresh whether the compactions need KeyWithTTLCompactionFilter by the ssts of the data
+    // column family
+    void update_may_contain_ttl_records();
+
+    // drop the ssts of the data column family of which all the records have expired, see
+    // ExpireStatsCollector. Only the ssts in the bottommost non-empty level are dropped, since
+    // there is no older version of their keys to be exposed.
+    void drop_expired_files();
+
+    // compact the ssts of the blob column family of which the estimated ratio of unreferred
+    // blobs reaches _blob_gc_garbage_ratio, one by one, see BlobReferenceCollector.
+    // It also refreshes _blob_cf_may_have_data.
+    void gc_blob_files();
+
+    // return true if a read may meet separated values, so it should read on a snapshot of
+    // _blob_read_snapshots
+    bool may_read_separated_values() const
+    {
+        return _value_separation_min_size > 0 ||
+               _blob_cf_may_have_data.load(std::memory_order_relaxed);
+    }
+
     static void update_server_rocksdb_statistics();
 
     // get the absolute path of restore directory and the flag whether force restore from env
@@ -228,6 +339,10 @@ private:
 
     void update_default_ttl(const std::map<std::string, std::string> &envs);
 
+    void update_blind_incr(const std::map<std::string, std::string> &envs);
+
+    void update_value_separation(const std::map<std::string, std::string> &envs);
+
     void update_checkpoint_reserve(const std::map<std::string, std::string> &envs);
 
     void update_slow_query_threshold(const std::map<std::string, std::string> &envs);
@@ -270,6 +385,14 @@ private:
             _pegasus_data_version, epoch_now, utils::to_string_view(raw_value));
     }
 
+    // return true if the data of the current entry is pinned by the iterator,
+    // which means it is valid until the iterator is deleted
+    static bool is_iterator_data_pinned(rocksdb::Iterator *it, const std::string &property)
+    {
+        std::string prop;
+        return it->GetProperty(property, &prop).ok() && prop == "1";
+    }
+
     bool is_multi_get_abnormal(uint64_t time_used, uint64_t size, uint64_t iterate_count)
     {
         if (_abnormal_multi_get_size_threshold && size >= _abnormal_multi_get_size_threshold) {
@@ -300,6 +423,8 @@ private:
 
     ::dsn::error_code check_meta_cf(const std::string &path, bool *need_create_meta_cf);
 
+    ::dsn::error_code check_blob_cf(const std::string &path, bool *need_create_blob_cf);
+
     void release_db();
 
     ::dsn::error_code flush_all_family_columns(bool wait);
@@ -309,6 +434,7 @@ private:
     // Column family names.
     static const std::string DATA_COLUMN_FAMILY_NAME;
     static const std::string META_COLUMN_FAMILY_NAME;
+    static const std::string BLOB_COLUMN_FAMILY_NAME;
 
     dsn::gpid _gpid;
     std::string _primary_address;
@@ -316,21 +442,29 @@ private:
     uint64_t _abnormal_get_size_threshold;
     uint64_t _abnormal_multi_get_size_threshold;
     uint64_t _abnormal_multi_get_iterate_count_threshold;
+    uint64_t _abnormal_batch_write_time_threshold_ns;
     // slow query time threshold. exceed this threshold will be logged.
     uint64_t _slow_query_threshold_ns;
     uint64_t _slow_query_threshold_ns_in_config;
 
+    // referred by _blob_compaction_filter_factory, declared before it to outlive it
+    blob_read_snapshots _blob_read_snapshots;
     std::shared_ptr<KeyWithTTLCompactionFilterFactory> _key_ttl_compaction_filter_factory;
+    std::shared_ptr<pegasus_incr_merge_operator> _incr_merge_operator;
+    std::shared_ptr<BlobCompactionFilterFactory> _blob_compaction_filter_factory;
+    std::shared_ptr<BlobReferenceCollectorFactory> _blob_reference_collector_factory;
     std::shared_ptr<rocksdb::Statistics> _statistics;
     rocksdb::DBOptions _db_opts;
     rocksdb::ColumnFamilyOptions _data_cf_opts;
     rocksdb::ColumnFamilyOptions _meta_cf_opts;
+    rocksdb::ColumnFamilyOptions _blob_cf_opts;
     rocksdb::ReadOptions _data_cf_rd_opts;
     std::string _usage_scenario;
 
     rocksdb::DB *_db;
     rocksdb::ColumnFamilyHandle *_data_cf;
     rocksdb::ColumnFamilyHandle *_meta_cf;
+    rocksdb::ColumnFamilyHandle *_blob_cf;
     static std::shared_ptr<rocksdb::Cache> _s_block_cache;
     volatile bool _is_open;
     uint32_t _pegasus_data_version;
@@ -339,6 +473,9 @@ private:
     std::unique_ptr<meta_store> _meta_store;
     std::unique_ptr<capacity_unit_calculator> _cu_calculator;
     std::unique_ptr<pegasus_server_write> _server_write;
+    // the app envs given to the write service, which may be updated before it's created
+    bool _blind_incr{false};
+    uint32_t _value_separation_min_size{0};
 
     uint32_t _checkpoint_reserve_min_count_in_config;
     uint32_t _checkpoint_reserve_time_seconds_in_config;
@@ -349,6 +486,20 @@ private:
     std::deque<int64_t> _checkpoints;           // ordered checkpoints
 
     pegasus_context_cache _context_cache;
+    uint32_t _scan_context_ttl_seconds;
+    ::dsn::task_ptr _scan_context_gc_timer;
+    uint32_t _expired_file_drop_interval_seconds;
+    ::dsn::task_ptr _expired_file_drop_timer;
+    uint32_t _blob_gc_interval_seconds;
+    double _blob_gc_garbage_ratio;
+    ::dsn::task_ptr _blob_gc_timer;
+    // false only if the blob column family is found empty by the blob gc
+    std::atomic<bool> _blob_cf_may_have_data{true};
+    uint64_t _bulk_scan_readahead_size;
+    uint32_t _get_split_keys_max_split_count;
+
+    // cache of hot keys for GET requests, nullptr if disabled
+    std::unique_ptr<read_cache> _read_cache;
 
     std::chrono::seconds _update_rdb_stat_interval;
     ::dsn::task_ptr _update_replica_rdb_stat;
@@ -363,15 +514,21 @@ private:
     // perf counters
     ::dsn::perf_counter_wrapper _pfc_get_qps;
     ::dsn::perf_counter_wrapper _pfc_multi_get_qps;
+    ::dsn::perf_counter_wrapper _pfc_batch_multi_get_qps;
     ::dsn::perf_counter_wrapper _pfc_scan_qps;
 
     ::dsn::perf_counter_wrapper _pfc_get_latency;
     ::dsn::perf_counter_wrapper _pfc_multi_get_latency;
+    ::dsn::perf_counter_wrapper _pfc_batch_multi_get_latency;
     ::dsn::perf_counter_wrapper _pfc_scan_latency;
 
     ::dsn::perf_counter_wrapper _pfc_recent_expire_count;
     ::dsn::perf_counter_wrapper _pfc_recent_filter_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_expired_file_drop_count;
     ::dsn::perf_counter_wrapper _pfc_recent_abnormal_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_read_cache_hit_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_read_cache_miss_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_read_cache_evict_count;
 
     // rocksdb internal statistics
     // server level
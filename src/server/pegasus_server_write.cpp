@@ -36,35 +36,20 @@ int pegasus_server_write::on_batched_write_requests(dsn::message_ex **requests,
     }
 
     dsn::task_code rpc_code(requests[0]->rpc_code());
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT) {
-        dassert(count == 1, "count = %d", count);
-        auto rpc = multi_put_rpc::auto_reply(requests[0]);
-        return _write_svc->multi_put(_write_ctx, rpc.request(), rpc.response());
-    }
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE) {
-        dassert(count == 1, "count = %d", count);
-        auto rpc = multi_remove_rpc::auto_reply(requests[0]);
-        return _write_svc->multi_remove(_decree, rpc.request(), rpc.response());
-    }
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_INCR) {
-        dassert(count == 1, "count = %d", count);
-        auto rpc = incr_rpc::auto_reply(requests[0]);
-        return _write_svc->incr(_decree, rpc.request(), rpc.response());
-    }
     if (rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE) {
         dassert(count == 1, "count = %d", count);
         auto rpc = duplicate_rpc::auto_reply(requests[0]);
         return _write_svc->duplicate(_decree, rpc.request(), rpc.response());
     }
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET) {
+    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE) {
         dassert(count == 1, "count = %d", count);
-        auto rpc = check_and_set_rpc::auto_reply(requests[0]);
-        return _write_svc->check_and_set(_decree, rpc.request(), rpc.response());
+        auto rpc = delete_range_rpc::auto_reply(requests[0]);
+        return _write_svc->delete_range(_decree, rpc.request(), rpc.response());
     }
-    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_MUTATE) {
+    if (rpc_code == dsn::apps::RPC_RRDB_RRDB_INGEST) {
         dassert(count == 1, "count = %d", count);
-        auto rpc = check_and_mutate_rpc::auto_reply(requests[0]);
-        return _write_svc->check_and_mutate(_decree, rpc.request(), rpc.response());
+        auto rpc = ingest_rpc::auto_reply(requests[0]);
+        return _write_svc->ingest(_decree, rpc.request(), rpc.response());
     }
 
     return on_batched_writes(requests, count);
@@ -72,11 +57,26 @@ int pegasus_server_write::on_batched_write_requests(dsn::message_ex **requests,
 
 void pegasus_server_write::set_default_ttl(uint32_t ttl) { _write_svc->set_default_ttl(ttl); }
 
+void pegasus_server_write::set_blind_incr(bool blind_incr)
+{
+    _write_svc->set_blind_incr(blind_incr);
+}
+
+void pegasus_server_write::set_may_contain_ttl_records(bool may_contain)
+{
+    _write_svc->set_may_contain_ttl_records(may_contain);
+}
+
+void pegasus_server_write::set_value_separation_min_size(uint32_t min_size)
+{
+    _write_svc->set_value_separation_min_size(min_size);
+}
+
 int pegasus_server_write::on_batched_writes(dsn::message_ex **requests, int count)
 {
     int err = 0;
     {
-        _write_svc->batch_prepare(_decree);
+        _write_svc->batch_prepare(_decree, _write_ctx.timestamp);
 
         for (int i = 0; i < count; ++i) {
             dassert(requests[i] != nullptr, "request[%d] is null", i);
@@ -95,11 +95,33 @@ int pegasus_server_write::on_batched_writes(dsn::message_ex **requests, int coun
                 auto rpc = remove_rpc::auto_reply(requests[i]);
                 local_err = on_single_remove_in_batch(rpc);
                 _remove_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT) {
+                auto rpc = multi_put_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_multi_put(_write_ctx, rpc.request(), rpc.response());
+                _multi_put_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE) {
+                auto rpc = multi_remove_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_multi_remove(_decree, rpc.request(), rpc.response());
+                _multi_remove_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_INCR) {
+                auto rpc = incr_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_incr(_decree, rpc.request(), rpc.response());
+                _incr_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET ||
+                       rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET_V2) {
+                auto rpc = check_and_set_rpc::auto_reply(requests[i]);
+                local_err = _write_svc->batch_check_and_set(_decree, rpc.request(), rpc.response());
+                _check_and_set_rpc_batch.emplace_back(std::move(rpc));
+            } else if (rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_MUTATE ||
+                       rpc_code == dsn::apps::RPC_RRDB_RRDB_CHECK_AND_MUTATE_V2) {
+                auto rpc = check_and_mutate_rpc::auto_reply(requests[i]);
+                local_err =
+                    _write_svc->batch_check_and_mutate(_decree, rpc.request(), rpc.response());
+                _check_and_mutate_rpc_batch.emplace_back(std::move(rpc));
             } else {
-                if (rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_PUT ||
-                    rpc_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE ||
-                    rpc_code == dsn::apps::RPC_RRDB_RRDB_INCR ||
-                    rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE) {
+                if (rpc_code == dsn::apps::RPC_RRDB_RRDB_DUPLICATE ||
+                    rpc_code == dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE ||
+                    rpc_code == dsn::apps::RPC_RRDB_RRDB_INGEST) {
                     dfatal("rpc code not allow batch: %s", rpc_code.to_string());
                 } else {
                     dfatal("rpc code not handled: %s", rpc_code.to_string());
@@ -121,6 +143,11 @@ int pegasus_server_write::on_batched_writes(dsn::message_ex **requests, int coun
     // reply the batched RPCs
     _put_rpc_batch.clear();
     _remove_rpc_batch.clear();
+    _multi_put_rpc_batch.clear();
+    _multi_remove_rpc_batch.clear();
+    _incr_rpc_batch.clear();
+    _check_and_set_rpc_batch.clear();
+    _check_and_mutate_rpc_batch.clear();
     return err;
 }
 
@@ -33,8 +33,15 @@ public:
 
     void set_default_ttl(uint32_t ttl);
 
+    void set_blind_incr(bool blind_incr);
+
+    void set_may_contain_ttl_records(bool may_contain);
+
+    void set_value_separation_min_size(uint32_t min_size);
+
 private:
     /// Delay replying for the batched requests until all of them complete.
+    /// The requests of any kinds (except DUPLICATE) are committed in one rocksdb write.
     int on_batched_writes(dsn::message_ex **requests, int count);
 
     int on_single_put_in_batch(put_rpc &rpc)
@@ -63,6 +70,11 @@ private:
     std::unique_ptr<pegasus_write_service> _write_svc;
     std::vector<put_rpc> _put_rpc_batch;
     std::vector<remove_rpc> _remove_rpc_batch;
+    std::vector<multi_put_rpc> _multi_put_rpc_batch;
+    std::vector<multi_remove_rpc> _multi_remove_rpc_batch;
+    std::vector<incr_rpc> _incr_rpc_batch;
+    std::vector<check_and_set_rpc> _check_and_set_rpc_batch;
+    std::vector<check_and_mutate_rpc> _check_and_mutate_rpc_batch;
 
     db_write_context _write_ctx;
     int64_t _decree;
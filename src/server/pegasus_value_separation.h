@@ -0,0 +1,302 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <rocksdb/compaction_filter.h>
+#include <rocksdb/db.h>
+
+#include "base/pegasus_utils.h"
+#include "base/pegasus_value_schema.h"
+
+namespace pegasus {
+namespace server {
+
+/// Key-value separation of the large values.
+///
+/// If the user data of a write is not smaller than the threshold of the table, it is
+/// separated into the blob column family, and the record in the data column family keeps the
+/// header with a reference to the blob instead of the user data:
+///
+///   data cf: raw_key                  -> [expire_ts] [timetag | SEPARATED_TAG] [decree(8)]
+///   blob cf: [decree(8)] [raw_key]    -> [user_data]
+///
+/// So the header stays in the data column family: the ttl of a separated record is checked
+/// and updated without reading the blob, and the compactions of the data column family
+/// rewrite only the small references. The decree of the write identifies the version of the
+/// key, so a reference never reads the blob of another version.
+///
+/// A separated record is marked by the lowest bit of its timetag, which is the deleted tag of
+/// the duplicated writes and never set in a stored record, since a deleted record is removed
+/// instead. So the values are separated only by data version 1, which has the timetag.
+///
+/// The blob column family is append-only: it has no automatic compaction, and the blob keys
+/// lead with the increasing decree, so each flushed sst covers its own range of decrees. The
+/// ssts with much garbage are compacted one by one by the blob gc of the replica, see
+/// BlobReferenceCollector, and the compaction removes the blobs which are not referred by the
+/// data column family any more, see BlobCompactionFilter.
+///
+/// A read gets the reference and the blob on the same snapshot taken from
+/// blob_read_snapshots, so the blob of a reference it has read is never removed under it.
+class pegasus_value_separation
+{
+public:
+    // the flag in the timetag of a separated record
+    static const uint64_t SEPARATED_TAG = 1;
+
+    // the length of the reference in the data column family
+    static const size_t REFERENCE_LENGTH = sizeof(uint64_t);
+
+    // the minimal threshold, to make sure the separated values are much larger than references
+    static const uint32_t MIN_SEPARATED_VALUE_SIZE = 64;
+
+    // \return true if `raw_value` is a record of the data column family whose user data is
+    // separated into the blob column family.
+    static bool is_separated(uint32_t pegasus_data_version, dsn::string_view raw_value)
+    {
+        return pegasus_data_version >= 1 &&
+               raw_value.length() >= sizeof(uint32_t) + sizeof(uint64_t) &&
+               (pegasus_extract_timetag(pegasus_data_version, raw_value) & SEPARATED_TAG) != 0;
+    }
+
+    static void generate_reference(int64_t decree, std::string &reference)
+    {
+        reference.resize(REFERENCE_LENGTH);
+        dsn::data_output(&reference[0], REFERENCE_LENGTH).write_u64(static_cast<uint64_t>(decree));
+    }
+
+    // \return false if `user_data` of a separated record is corrupted.
+    static bool extract_reference(dsn::string_view user_data, int64_t &decree)
+    {
+        if (user_data.length() != REFERENCE_LENGTH) {
+            return false;
+        }
+        decree = static_cast<int64_t>(dsn::data_input(user_data).read_u64());
+        return true;
+    }
+
+    static void generate_blob_key(dsn::string_view raw_key, int64_t decree, std::string &blob_key)
+    {
+        blob_key.resize(sizeof(uint64_t) + raw_key.length());
+        dsn::data_output(&blob_key[0], sizeof(uint64_t)).write_u64(static_cast<uint64_t>(decree));
+        memcpy(&blob_key[sizeof(uint64_t)], raw_key.data(), raw_key.length());
+    }
+
+    static bool
+    restore_blob_key(dsn::string_view blob_key, dsn::string_view &raw_key, int64_t &decree)
+    {
+        if (blob_key.length() < sizeof(uint64_t)) {
+            return false;
+        }
+        decree =
+            static_cast<int64_t>(dsn::data_input(blob_key.substr(0, sizeof(uint64_t))).read_u64());
+        raw_key = blob_key.substr(sizeof(uint64_t));
+        return true;
+    }
+};
+
+/// A snapshot of the db registered in blob_read_snapshots.
+struct blob_read_snapshot
+{
+    const rocksdb::Snapshot *snapshot;
+    // the writes up to this decree are all visible in the snapshot
+    int64_t max_decree;
+};
+
+/// The snapshots of the reads which may read separated values.
+///
+/// BlobCompactionFilter keeps all the blobs which may be referred in the oldest of them, so a
+/// read on a snapshot of this registry can always get the blob of a reference it has read.
+class blob_read_snapshots
+{
+public:
+    // `last_committed_decree` returns the last decree written into the db.
+    explicit blob_read_snapshots(std::function<int64_t()> last_committed_decree)
+        : _last_committed_decree(std::move(last_committed_decree))
+    {
+    }
+
+    // Takes a snapshot of `db`, which is released once the returned pointer and all of its
+    // copies are destroyed, so they must be destroyed before `db` is closed.
+    std::shared_ptr<const blob_read_snapshot> take(rocksdb::DB *db)
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        return take_locked(db);
+    }
+
+    // eturn the oldest snapshot in use, or a new one if there is none.
+    std::shared_ptr<const blob_read_snapshot> oldest_or_take(rocksdb::DB *db)
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        for (const auto &kv : _snapshots) {
+            // expired if it's being released
+            std::shared_ptr<const blob_read_snapshot> snapshot = kv.second.lock();
+            if (snapshot != nullptr) {
+                return snapshot;
+            }
+        }
+        return take_locked(db);
+    }
+
+private:
+    std::shared_ptr<const blob_read_snapshot> take_locked(rocksdb::DB *db)
+    {
+        // the decree is got before the snapshot, so all the writes up to it are in the snapshot
+        auto *snapshot = new blob_read_snapshot{nullptr, _last_committed_decree()};
+        snapshot->snapshot = db->GetSnapshot();
+        auto iter = _snapshots.emplace(snapshot->snapshot->GetSequenceNumber(),
+                                       std::weak_ptr<const blob_read_snapshot>());
+        std::shared_ptr<const blob_read_snapshot> ptr(
+            snapshot, [this, db, iter](const blob_read_snapshot *snapshot) {
+                {
+                    std::lock_guard<std::mutex> l(_lock);
+                    _snapshots.erase(iter);
+                }
+                db->ReleaseSnapshot(snapshot->snapshot);
+                delete snapshot;
+            });
+        iter->second = ptr;
+        return ptr;
+    }
+
+    const std::function<int64_t()> _last_committed_decree;
+    std::mutex _lock;
+    // ordered by the sequence number of the snapshot
+    std::multimap<rocksdb::SequenceNumber, std::weak_ptr<const blob_read_snapshot>> _snapshots;
+};
+
+/// Removes the blobs which are not referred by the data column family, that is, the record is
+/// removed, expired or overwritten. The blob is decided by its key, the value is never parsed.
+///
+/// The filter holds the oldest snapshot of blob_read_snapshots when it's created. A blob is
+/// removed only if it's written before the snapshot and not referred in it, so its reference
+/// was removed before the snapshot, and no read on the snapshot or a newer one can refer to it.
+class BlobCompactionFilter : public rocksdb::CompactionFilter
+{
+public:
+    BlobCompactionFilter(rocksdb::DB *db,
+                         uint32_t pegasus_data_version,
+                         std::shared_ptr<const blob_read_snapshot> &&snapshot)
+        : _db(db), _pegasus_data_version(pegasus_data_version), _snapshot(std::move(snapshot))
+    {
+    }
+
+    bool Filter(int /*level*/,
+                const rocksdb::Slice &key,
+                const rocksdb::Slice & /*existing_value*/,
+                std::string * /*new_value*/,
+                bool * /*value_changed*/) const override
+    {
+        return !is_referred(key);
+    }
+
+    const char *Name() const override { return "BlobCompactionFilter"; }
+
+private:
+    bool is_referred(const rocksdb::Slice &blob_key) const
+    {
+        if (_db == nullptr) {
+            // the db is not opened completely
+            return true;
+        }
+
+        dsn::string_view raw_key;
+        int64_t decree = 0;
+        if (!pegasus_value_separation::restore_blob_key(
+                utils::to_string_view(blob_key), raw_key, decree)) {
+            return false;
+        }
+        if (decree > _snapshot->max_decree) {
+            // may be referred in a newer snapshot
+            return true;
+        }
+
+        // the ttl is not checked in the snapshot, since a read may have checked it just before
+        // the record expires
+        rocksdb::ReadOptions rd_opts;
+        rd_opts.snapshot = _snapshot->snapshot;
+        if (is_referred(rd_opts, raw_key, decree, false)) {
+            return true;
+        }
+
+        // the flushed records are also checked, because the records in memtable are lost on
+        // restart, and a checkpoint must not refer to a removed blob.
+        rd_opts = rocksdb::ReadOptions();
+        rd_opts.read_tier = rocksdb::kPersistedTier;
+        return is_referred(rd_opts, raw_key, decree, true);
+    }
+
+    bool is_referred(const rocksdb::ReadOptions &rd_opts,
+                     dsn::string_view raw_key,
+                     int64_t decree,
+                     bool check_ttl) const
+    {
+        std::string raw_value;
+        // the data column family is the default column family
+        rocksdb::Status s = _db->Get(rd_opts, utils::to_rocksdb_slice(raw_key), &raw_value);
+        if (s.IsNotFound()) {
+            return false;
+        }
+        if (!s.ok()) {
+            // keep it since it's unknown
+            return true;
+        }
+        if (check_ttl &&
+            check_if_record_expired(_pegasus_data_version, utils::epoch_now(), raw_value)) {
+            return false;
+        }
+        int64_t referred_decree = 0;
+        return pegasus_value_separation::is_separated(_pegasus_data_version, raw_value) &&
+               pegasus_value_separation::extract_reference(
+                   pegasus_extract_user_data(_pegasus_data_version, raw_value), referred_decree) &&
+               referred_decree == decree;
+    }
+
+    rocksdb::DB *_db;
+    uint32_t _pegasus_data_version;
+    std::shared_ptr<const blob_read_snapshot> _snapshot;
+};
+
+class BlobCompactionFilterFactory : public rocksdb::CompactionFilterFactory
+{
+public:
+    explicit BlobCompactionFilterFactory(blob_read_snapshots *snapshots)
+        : _snapshots(snapshots), _db(nullptr), _pegasus_data_version(0)
+    {
+    }
+
+    std::unique_ptr<rocksdb::CompactionFilter>
+    CreateCompactionFilter(const rocksdb::CompactionFilter::Context & /*context*/) override
+    {
+        rocksdb::DB *db = _db.load(std::memory_order_acquire);
+        std::shared_ptr<const blob_read_snapshot> snapshot;
+        if (db != nullptr) {
+            snapshot = _snapshots->oldest_or_take(db);
+        }
+        return std::unique_ptr<BlobCompactionFilter>(
+            new BlobCompactionFilter(db, _pegasus_data_version.load(), std::move(snapshot)));
+    }
+
+    const char *Name() const override { return "BlobCompactionFilterFactory"; }
+
+    // The blobs are kept until the db is set, since the data column family can't be read.
+    void SetDB(rocksdb::DB *db, uint32_t pegasus_data_version)
+    {
+        _pegasus_data_version.store(pegasus_data_version, std::memory_order_release);
+        _db.store(db, std::memory_order_release);
+    }
+
+private:
+    blob_read_snapshots *const _snapshots;
+    std::atomic<rocksdb::DB *> _db;
+    std::atomic<uint32_t> _pegasus_data_version;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -16,6 +16,7 @@ pegasus_write_service::pegasus_write_service(pegasus_server_impl *server)
     : _server(server),
       _impl(new impl(server)),
       _batch_start_time(0),
+      _batch_mutation_timestamp_us(0),
       _cu_calculator(server->_cu_calculator.get())
 {
     std::string str_gpid = fmt::format("{}", server->get_gpid());
@@ -40,6 +41,16 @@ pegasus_write_service::pegasus_write_service(pegasus_server_impl *server)
                                            COUNTER_TYPE_RATE,
                                            "statistic the qps of MULTI_REMOVE request");
 
+    name = fmt::format("delete_range_qps@{}", str_gpid);
+    _pfc_delete_range_qps.init_app_counter("app.pegasus",
+                                           name.c_str(),
+                                           COUNTER_TYPE_RATE,
+                                           "statistic the qps of DELETE_RANGE request");
+
+    name = fmt::format("ingest_qps@{}", str_gpid);
+    _pfc_ingest_qps.init_app_counter(
+        "app.pegasus", name.c_str(), COUNTER_TYPE_RATE, "statistic the qps of INGEST request");
+
     name = fmt::format("incr_qps@{}", str_gpid);
     _pfc_incr_qps.init_app_counter(
         "app.pegasus", name.c_str(), COUNTER_TYPE_RATE, "statistic the qps of INCR request");
@@ -80,6 +91,18 @@ pegasus_write_service::pegasus_write_service(pegasus_server_impl *server)
                                                COUNTER_TYPE_NUMBER_PERCENTILES,
                                                "statistic the latency of MULTI_REMOVE request");
 
+    name = fmt::format("delete_range_latency@{}", str_gpid);
+    _pfc_delete_range_latency.init_app_counter("app.pegasus",
+                                               name.c_str(),
+                                               COUNTER_TYPE_NUMBER_PERCENTILES,
+                                               "statistic the latency of DELETE_RANGE request");
+
+    name = fmt::format("ingest_latency@{}", str_gpid);
+    _pfc_ingest_latency.init_app_counter("app.pegasus",
+                                         name.c_str(),
+                                         COUNTER_TYPE_NUMBER_PERCENTILES,
+                                         "statistic the latency of INGEST request");
+
     name = fmt::format("incr_latency@{}", str_gpid);
     _pfc_incr_latency.init_app_counter("app.pegasus",
                                        name.c_str(),
@@ -99,6 +122,42 @@ pegasus_write_service::pegasus_write_service(pegasus_server_impl *server)
         COUNTER_TYPE_NUMBER_PERCENTILES,
         "statistic the latency of CHECK_AND_MUTATE request");
 
+    name = fmt::format("batch_write_replication_latency@{}", str_gpid);
+    _pfc_batch_write_replication_latency.init_app_counter(
+        "app.pegasus",
+        name.c_str(),
+        COUNTER_TYPE_NUMBER_PERCENTILES,
+        "statistic the latency of batched writes from prepared on primary to applied");
+
+    name = fmt::format("batch_write_apply_latency@{}", str_gpid);
+    _pfc_batch_write_apply_latency.init_app_counter(
+        "app.pegasus",
+        name.c_str(),
+        COUNTER_TYPE_NUMBER_PERCENTILES,
+        "statistic the latency of batched writes to build the write batch");
+
+    name = fmt::format("batch_write_rocksdb_latency@{}", str_gpid);
+    _pfc_batch_write_rocksdb_latency.init_app_counter(
+        "app.pegasus",
+        name.c_str(),
+        COUNTER_TYPE_NUMBER_PERCENTILES,
+        "statistic the latency of batched writes to write rocksdb");
+
+    name = fmt::format("write_key_buffer_alloc_count@{}", str_gpid);
+    _pfc_write_key_buffer_alloc_count.init_app_counter(
+        "app.pegasus",
+        name.c_str(),
+        COUNTER_TYPE_NUMBER_PERCENTILES,
+        "statistic the allocation count of the reused key buffers of each batched write, the "
+        "allocations of the write batch and the values are not counted");
+
+    name = fmt::format("recent.abnormal.batch.write.count@{}", str_gpid);
+    _pfc_recent_abnormal_batch_write_count.init_app_counter(
+        "app.pegasus",
+        name.c_str(),
+        COUNTER_TYPE_VOLATILE_NUMBER,
+        "statistic the recent abnormal batched write count");
+
     _pfc_duplicate_qps.init_app_counter("app.pegasus",
                                         fmt::format("duplicate_qps@{}", str_gpid).c_str(),
                                         COUNTER_TYPE_RATE,
@@ -141,6 +200,33 @@ int pegasus_write_service::multi_remove(int64_t decree,
     return err;
 }
 
+int pegasus_write_service::delete_range(int64_t decree,
+                                        const dsn::apps::delete_range_request &update,
+                                        dsn::apps::update_response &resp)
+{
+    uint64_t start_time = dsn_now_ns();
+    _pfc_delete_range_qps->increment();
+    int err = _impl->delete_range(decree, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_remove_cu(resp.error, update.hash_key);
+    }
+
+    _pfc_delete_range_latency->set(dsn_now_ns() - start_time);
+    return err;
+}
+
+int pegasus_write_service::ingest(int64_t decree,
+                                  const dsn::apps::ingest_request &update,
+                                  dsn::apps::update_response &resp)
+{
+    uint64_t start_time = dsn_now_ns();
+    _pfc_ingest_qps->increment();
+    int err = _impl->ingest(decree, update, resp);
+    _pfc_ingest_latency->set(dsn_now_ns() - start_time);
+    return err;
+}
+
 int pegasus_write_service::incr(int64_t decree,
                                 const dsn::apps::incr_request &update,
                                 dsn::apps::incr_response &resp)
@@ -170,7 +256,8 @@ int pegasus_write_service::check_and_set(int64_t decree,
                                              update.hash_key,
                                              update.check_sort_key,
                                              update.set_sort_key,
-                                             update.set_value);
+                                             update.set_value,
+                                             update.extra_conditions.size());
     }
 
     _pfc_check_and_set_latency->set(dsn_now_ns() - start_time);
@@ -186,20 +273,24 @@ int pegasus_write_service::check_and_mutate(int64_t decree,
     int err = _impl->check_and_mutate(decree, update, resp);
 
     if (_server->is_primary()) {
-        _cu_calculator->add_check_and_mutate_cu(
-            resp.error, update.hash_key, update.check_sort_key, update.mutate_list);
+        _cu_calculator->add_check_and_mutate_cu(resp.error,
+                                                update.hash_key,
+                                                update.check_sort_key,
+                                                update.mutate_list,
+                                                update.extra_conditions.size());
     }
 
     _pfc_check_and_mutate_latency->set(dsn_now_ns() - start_time);
     return err;
 }
 
-void pegasus_write_service::batch_prepare(int64_t decree)
+void pegasus_write_service::batch_prepare(int64_t decree, uint64_t mutation_timestamp_us)
 {
     dassert(_batch_start_time == 0,
             "batch_prepare and batch_commit/batch_abort must be called in pair");
 
     _batch_start_time = dsn_now_ns();
+    _batch_mutation_timestamp_us = mutation_timestamp_us;
 }
 
 int pegasus_write_service::batch_put(const db_write_context &ctx,
@@ -236,11 +327,108 @@ int pegasus_write_service::batch_remove(int64_t decree,
     return err;
 }
 
+int pegasus_write_service::batch_multi_put(const db_write_context &ctx,
+                                           const dsn::apps::multi_put_request &update,
+                                           dsn::apps::update_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_multi_put must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_multi_put_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_multi_put_latency.get());
+    int err = _impl->batch_multi_put(ctx, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_multi_put_cu(resp.error, update.hash_key, update.kvs);
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_multi_remove(int64_t decree,
+                                              const dsn::apps::multi_remove_request &update,
+                                              dsn::apps::multi_remove_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_multi_remove must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_multi_remove_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_multi_remove_latency.get());
+    int err = _impl->batch_multi_remove(decree, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_multi_remove_cu(resp.error, update.sort_keys);
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_incr(int64_t decree,
+                                      const dsn::apps::incr_request &update,
+                                      dsn::apps::incr_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_incr must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_incr_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_incr_latency.get());
+    int err = _impl->batch_incr(decree, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_incr_cu(resp.error);
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_check_and_set(int64_t decree,
+                                               const dsn::apps::check_and_set_request &update,
+                                               dsn::apps::check_and_set_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_check_and_set must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_check_and_set_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_check_and_set_latency.get());
+    int err = _impl->batch_check_and_set(decree, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_check_and_set_cu(resp.error,
+                                             update.hash_key,
+                                             update.check_sort_key,
+                                             update.set_sort_key,
+                                             update.set_value,
+                                             update.extra_conditions.size());
+    }
+
+    return err;
+}
+
+int pegasus_write_service::batch_check_and_mutate(
+    int64_t decree,
+    const dsn::apps::check_and_mutate_request &update,
+    dsn::apps::check_and_mutate_response &resp)
+{
+    dassert(_batch_start_time != 0, "batch_check_and_mutate must be called after batch_prepare");
+
+    _batch_qps_perfcounters.push_back(_pfc_check_and_mutate_qps.get());
+    _batch_latency_perfcounters.push_back(_pfc_check_and_mutate_latency.get());
+    int err = _impl->batch_check_and_mutate(decree, update, resp);
+
+    if (_server->is_primary()) {
+        _cu_calculator->add_check_and_mutate_cu(resp.error,
+                                                update.hash_key,
+                                                update.check_sort_key,
+                                                update.mutate_list,
+                                                update.extra_conditions.size());
+    }
+
+    return err;
+}
+
 int pegasus_write_service::batch_commit(int64_t decree)
 {
     dassert(_batch_start_time != 0, "batch_commit must be called after batch_prepare");
 
+    uint64_t commit_start_time = dsn_now_ns();
     int err = _impl->batch_commit(decree);
+    trace_batch_latency(decree, commit_start_time, dsn_now_ns(), true);
     clear_up_batch_states();
     return err;
 }
@@ -250,12 +438,66 @@ void pegasus_write_service::batch_abort(int64_t decree, int err)
     dassert(_batch_start_time != 0, "batch_abort must be called after batch_prepare");
     dassert(err, "must abort on non-zero err");
 
+    uint64_t abort_start_time = dsn_now_ns();
     _impl->batch_abort(decree, err);
+    trace_batch_latency(decree, abort_start_time, dsn_now_ns(), false);
     clear_up_batch_states();
 }
 
 void pegasus_write_service::set_default_ttl(uint32_t ttl) { _impl->set_default_ttl(ttl); }
 
+void pegasus_write_service::set_blind_incr(bool blind_incr) { _impl->set_blind_incr(blind_incr); }
+
+void pegasus_write_service::set_may_contain_ttl_records(bool may_contain)
+{
+    _impl->set_may_contain_ttl_records(may_contain);
+}
+
+void pegasus_write_service::set_value_separation_min_size(uint32_t min_size)
+{
+    _impl->set_value_separation_min_size(min_size);
+}
+
+void pegasus_write_service::trace_batch_latency(int64_t decree,
+                                                uint64_t commit_start_time,
+                                                uint64_t commit_end_time,
+                                                bool committed)
+{
+    uint64_t apply_latency = commit_start_time - _batch_start_time;
+    uint64_t rocksdb_latency = 0;
+    _pfc_batch_write_apply_latency->set(apply_latency);
+    if (committed) {
+        rocksdb_latency = commit_end_time - commit_start_time;
+        _pfc_batch_write_rocksdb_latency->set(rocksdb_latency);
+    }
+
+    // the mutation timestamp is generated by the clock of primary, so it's comparable only
+    // on primary
+    uint64_t replication_latency = 0;
+    if (_batch_mutation_timestamp_us > 0 && _server->is_primary()) {
+        uint64_t start_time_us = _batch_start_time / 1000;
+        if (start_time_us > _batch_mutation_timestamp_us) {
+            replication_latency = (start_time_us - _batch_mutation_timestamp_us) * 1000;
+        }
+        _pfc_batch_write_replication_latency->set(replication_latency);
+    }
+
+    uint64_t total_latency = replication_latency + apply_latency + rocksdb_latency;
+    if (_server->_abnormal_batch_write_time_threshold_ns > 0 &&
+        total_latency >= _server->_abnormal_batch_write_time_threshold_ns) {
+        dwarn_f("{}: rocksdb abnormal batched write: decree = {}, request_count = {}, "
+                "committed = {}, replication = {} ns, apply = {} ns, rocksdb_write = {} ns",
+                _server->replica_name(),
+                decree,
+                _batch_qps_perfcounters.size(),
+                committed,
+                replication_latency,
+                apply_latency,
+                rocksdb_latency);
+        _pfc_recent_abnormal_batch_write_count->increment();
+    }
+}
+
 void pegasus_write_service::clear_up_batch_states()
 {
     uint64_t latency = dsn_now_ns() - _batch_start_time;
@@ -263,6 +505,7 @@ void pegasus_write_service::clear_up_batch_states()
         pfc->increment();
     for (dsn::perf_counter *pfc : _batch_latency_perfcounters)
         pfc->set(latency);
+    _pfc_write_key_buffer_alloc_count->set(_impl->reset_key_buffer_alloc_count());
 
     _batch_qps_perfcounters.clear();
     _batch_latency_perfcounters.clear();
@@ -288,7 +531,8 @@ int pegasus_write_service::duplicate(int64_t decree,
     _pfc_duplicate_qps->increment();
     dsn::message_ex *write = dsn::from_blob_to_received_msg(request.task_code, request.raw_message);
     bool is_delete = request.task_code == dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE ||
-                     request.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE;
+                     request.task_code == dsn::apps::RPC_RRDB_RRDB_REMOVE ||
+                     request.task_code == dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE;
     auto remote_timetag = generate_timetag(request.timestamp, request.cluster_id, is_delete);
     auto ctx = db_write_context::create_duplicate(decree, remote_timetag, request.verify_timetag);
 
@@ -302,6 +546,11 @@ int pegasus_write_service::duplicate(int64_t decree,
         resp.__set_error(_impl->multi_remove(ctx.decree, rpc.request(), rpc.response()));
         return resp.error;
     }
+    if (request.task_code == dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE) {
+        delete_range_rpc rpc(write);
+        resp.__set_error(_impl->delete_range(ctx.decree, rpc.request(), rpc.response()));
+        return resp.error;
+    }
     put_rpc put;
     remove_rpc remove;
     if (request.task_code == dsn::apps::RPC_RRDB_RRDB_PUT ||
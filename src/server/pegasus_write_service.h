@@ -107,6 +107,20 @@ public:
                      const dsn::apps::multi_remove_request &update,
                      dsn::apps::multi_remove_response &resp);
 
+    // Write DELETE_RANGE record.
+    // DELETE_RANGE is not batched with the other writes, because the range deletion can't be
+    // read by the read-modify-write operations in the same batch, see write_batch_overlay.
+    int delete_range(int64_t decree,
+                     const dsn::apps::delete_range_request &update,
+                     dsn::apps::update_response &resp);
+
+    // Ingest the bulk load sst files of this partition.
+    // INGEST is not batched with the other writes, since the files are ingested into the db
+    // directly rather than by a write batch.
+    int ingest(int64_t decree,
+               const dsn::apps::ingest_request &update,
+               dsn::apps::update_response &resp);
+
     // Write INCR record.
     int incr(int64_t decree, const dsn::apps::incr_request &update, dsn::apps::incr_response &resp);
 
@@ -128,7 +142,9 @@ public:
     /// For batch write.
 
     // Prepare batch write.
-    void batch_prepare(int64_t decree);
+    // `mutation_timestamp_us` is the time when the mutation of this batch is prepared on the
+    // primary, which is used to trace the replication latency. 0 means unknown.
+    void batch_prepare(int64_t decree, uint64_t mutation_timestamp_us = 0);
 
     // Add PUT record in batch write.
     // \returns 0 if success, non-0 if failure.
@@ -142,6 +158,30 @@ public:
     // NOTE that `resp` should not be moved or freed while the batch is not committed.
     int batch_remove(int64_t decree, const dsn::blob &key, dsn::apps::update_response &resp);
 
+    // Add MULTI_PUT, MULTI_REMOVE, INCR, CHECK_AND_SET or CHECK_AND_MUTATE record in batch write.
+    // The read-modify-write operations see the records added earlier in the same batch.
+    // \returns 0 if success, non-0 if failure.
+    // NOTE that `resp` should not be moved or freed while the batch is not committed.
+    int batch_multi_put(const db_write_context &ctx,
+                        const dsn::apps::multi_put_request &update,
+                        dsn::apps::update_response &resp);
+
+    int batch_multi_remove(int64_t decree,
+                           const dsn::apps::multi_remove_request &update,
+                           dsn::apps::multi_remove_response &resp);
+
+    int batch_incr(int64_t decree,
+                   const dsn::apps::incr_request &update,
+                   dsn::apps::incr_response &resp);
+
+    int batch_check_and_set(int64_t decree,
+                            const dsn::apps::check_and_set_request &update,
+                            dsn::apps::check_and_set_response &resp);
+
+    int batch_check_and_mutate(int64_t decree,
+                               const dsn::apps::check_and_mutate_request &update,
+                               dsn::apps::check_and_mutate_response &resp);
+
     // Commit batch write.
     // \returns 0 if success, non-0 if failure.
     // NOTE that if the batch contains no updates, 0 is returned.
@@ -152,9 +192,38 @@ public:
 
     void set_default_ttl(uint32_t ttl);
 
+    // If true, incr is written as a merge operand without reading the old value.
+    void set_blind_incr(bool blind_incr);
+
+    // Whether the data may contain records with ttl, under which incr is not written blindly.
+    // It's set automatically once a record with ttl is written.
+    void set_may_contain_ttl_records(bool may_contain);
+
+    // The user data not smaller than `min_size` is separated into the blob column family.
+    // 0 means no separation.
+    void set_value_separation_min_size(uint32_t min_size);
+
 private:
     void clear_up_batch_states();
 
+    // Records the latency of each stage of the batch, and logs it if the batch is abnormal.
+    //   replication:   from the mutation prepared on primary to batch_prepare, which includes
+    //                  the two phase commit and the queueing before applying
+    //   apply:         from batch_prepare to batch_commit, which builds the write batch
+    //                  (including the reads of the read-modify-write operations)
+    //   rocksdb write: the rocksdb write of batch_commit, which includes the write stall and
+    //                  the memtable insert
+    // The stages are timed per batch, not per request: all the requests of a mutation share
+    // the same latencies. The time before the mutation is prepared on primary (receiving the
+    // rpc and queueing in the replica) and the time to reply are not covered, since the
+    // requests carry no receive time.
+    // An aborted batch (`committed` is false) records the replication and apply stages up to
+    // batch_abort, but no rocksdb write, since nothing is written.
+    void trace_batch_latency(int64_t decree,
+                             uint64_t commit_start_time,
+                             uint64_t commit_end_time,
+                             bool committed);
+
 private:
     friend class pegasus_write_service_test;
     friend class pegasus_write_service_impl_test;
@@ -166,6 +235,7 @@ private:
     std::unique_ptr<impl> _impl;
 
     uint64_t _batch_start_time;
+    uint64_t _batch_mutation_timestamp_us;
 
     capacity_unit_calculator *_cu_calculator;
 
@@ -173,6 +243,8 @@ private:
     ::dsn::perf_counter_wrapper _pfc_multi_put_qps;
     ::dsn::perf_counter_wrapper _pfc_remove_qps;
     ::dsn::perf_counter_wrapper _pfc_multi_remove_qps;
+    ::dsn::perf_counter_wrapper _pfc_delete_range_qps;
+    ::dsn::perf_counter_wrapper _pfc_ingest_qps;
     ::dsn::perf_counter_wrapper _pfc_incr_qps;
     ::dsn::perf_counter_wrapper _pfc_check_and_set_qps;
     ::dsn::perf_counter_wrapper _pfc_check_and_mutate_qps;
@@ -182,10 +254,18 @@ private:
     ::dsn::perf_counter_wrapper _pfc_multi_put_latency;
     ::dsn::perf_counter_wrapper _pfc_remove_latency;
     ::dsn::perf_counter_wrapper _pfc_multi_remove_latency;
+    ::dsn::perf_counter_wrapper _pfc_delete_range_latency;
+    ::dsn::perf_counter_wrapper _pfc_ingest_latency;
     ::dsn::perf_counter_wrapper _pfc_incr_latency;
     ::dsn::perf_counter_wrapper _pfc_check_and_set_latency;
     ::dsn::perf_counter_wrapper _pfc_check_and_mutate_latency;
 
+    ::dsn::perf_counter_wrapper _pfc_batch_write_replication_latency;
+    ::dsn::perf_counter_wrapper _pfc_batch_write_apply_latency;
+    ::dsn::perf_counter_wrapper _pfc_batch_write_rocksdb_latency;
+    ::dsn::perf_counter_wrapper _pfc_write_key_buffer_alloc_count;
+    ::dsn::perf_counter_wrapper _pfc_recent_abnormal_batch_write_count;
+
     // Records all requests.
     std::vector<::dsn::perf_counter *> _batch_qps_perfcounters;
     std::vector<::dsn::perf_counter *> _batch_latency_perfcounters;
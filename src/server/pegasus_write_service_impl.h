@@ -9,7 +9,11 @@
 #include "logging_utils.h"
 
 #include "base/pegasus_key_schema.h"
+#include "base/pegasus_bulk_load.h"
 #include "meta_store.h"
+#include "pegasus_incr_merge_operator.h"
+#include "write_batch_overlay.h"
+#include "value_filter.h"
 
 #include <dsn/utility/fail_point.h>
 #include <dsn/utility/string_conv.h>
@@ -56,15 +60,22 @@ public:
         : replica_base(server),
           _primary_address(server->_primary_address),
           _pegasus_data_version(server->_pegasus_data_version),
+          _batch_overlay({server->_data_cf->GetID(), server->_blob_cf->GetID()}),
           _db(server->_db),
           _data_cf(server->_data_cf),
           _meta_cf(server->_meta_cf),
+          _blob_cf(server->_blob_cf),
           _rd_opts(server->_data_cf_rd_opts),
           _default_ttl(0),
+          _blind_incr(false),
+          _may_contain_ttl_records(true),
+          _value_separation_min_size(0),
+          _read_cache(server->_read_cache.get()),
           _pfc_recent_expire_count(server->_pfc_recent_expire_count)
     {
         // disable write ahead logging as replication handles logging instead now
         _wt_opts.disableWAL = true;
+        _incr_merge_operator.SetPegasusDataVersion(_pegasus_data_version);
     }
 
     int empty_put(int64_t decree)
@@ -84,6 +95,250 @@ public:
     int multi_put(const db_write_context &ctx,
                   const dsn::apps::multi_put_request &update,
                   dsn::apps::update_response &resp)
+    {
+        int err = batch_multi_put(ctx, update, resp);
+        if (err) {
+            batch_abort(ctx.decree, err);
+            return err;
+        }
+        return batch_commit(ctx.decree);
+    }
+
+    int multi_remove(int64_t decree,
+                     const dsn::apps::multi_remove_request &update,
+                     dsn::apps::multi_remove_response &resp)
+    {
+        int err = batch_multi_remove(decree, update, resp);
+        if (err) {
+            batch_abort(decree, err);
+            return err;
+        }
+        return batch_commit(decree);
+    }
+
+    int delete_range(int64_t decree,
+                     const dsn::apps::delete_range_request &update,
+                     dsn::apps::update_response &resp)
+    {
+        resp.app_id = get_gpid().get_app_id();
+        resp.partition_index = get_gpid().get_partition_index();
+        resp.decree = decree;
+        resp.server = _primary_address;
+
+        std::string start_key, stop_key;
+        if (update.clear_partition) {
+            if (update.partition_index != get_gpid().get_partition_index()) {
+                derror_replica("invalid argument for delete_range: decree = {}, error = "
+                               "partition_index {} mismatches",
+                               decree,
+                               update.partition_index);
+                resp.error = rocksdb::Status::kInvalidArgument;
+                return empty_put(decree);
+            }
+            // the 2-byte hash key length of any key is less than 0xFFFF
+            start_key.clear();
+            stop_key.assign(2, '\xFF');
+        } else {
+            dsn::blob start = composite_raw_key(update.hash_key, update.start_sort_key);
+            start_key.assign(start.data(), start.length());
+            if (!update.start_inclusive) {
+                start_key.push_back('\0');
+            }
+            dsn::blob stop;
+            if (update.stop_sort_key.length() == 0) {
+                pegasus_generate_next_blob(stop, update.hash_key);
+                stop_key.assign(stop.data(), stop.length());
+            } else {
+                stop = composite_raw_key(update.hash_key, update.stop_sort_key);
+                stop_key.assign(stop.data(), stop.length());
+                if (update.stop_inclusive) {
+                    stop_key.push_back('\0');
+                }
+            }
+        }
+        if (start_key >= stop_key) {
+            // nothing to delete
+            resp.error = rocksdb::Status::kOk;
+            return empty_put(decree);
+        }
+
+        // the range deletion is not indexed by the batch overlay, which is fine since there is no
+        // other write in this batch to read it.
+        rocksdb::Status s = _batch.DeleteRange(_data_cf, start_key, stop_key);
+        if (s.ok() && update.clear_partition) {
+            // the blobs of the other ranges are removed by the compaction of the blob column
+            // family once their records are removed
+            s = _batch.DeleteRange(_blob_cf, start_key, stop_key);
+        }
+        if (dsn_unlikely(!s.ok())) {
+            derror_rocksdb("WriteBatchDeleteRange",
+                           s.ToString(),
+                           "decree: {}, hash_key: {}, clear_partition: {}",
+                           decree,
+                           utils::c_escape_string(update.hash_key),
+                           update.clear_partition);
+            resp.error = s.code();
+            clear_up_batch_states(decree, resp.error);
+            return resp.error;
+        }
+
+        resp.error = db_write(decree);
+        if (resp.error == 0 && _read_cache != nullptr) {
+            // the deleted keys are unknown, so the whole cache is invalidated
+            _read_cache->clear();
+        }
+        clear_up_batch_states(decree, resp.error);
+        return resp.error;
+    }
+
+    int ingest(int64_t decree,
+               const dsn::apps::ingest_request &update,
+               dsn::apps::update_response &resp)
+    {
+        resp.app_id = get_gpid().get_app_id();
+        resp.partition_index = get_gpid().get_partition_index();
+        resp.decree = decree;
+        resp.server = _primary_address;
+
+        if (update.partition_index != get_gpid().get_partition_index()) {
+            derror_replica("invalid argument for ingest: decree = {}, error = "
+                           "partition_index {} mismatches",
+                           decree,
+                           update.partition_index);
+            resp.error = rocksdb::Status::kInvalidArgument;
+            return empty_put(decree);
+        }
+        // The directory is checked by the client before the request is sent, so it can only be
+        // missing here if it is removed before this mutation is replayed, e.g. by a learner.
+        // Skipping the ingestion would make this replica silently lack the data of the others,
+        // so the write fails, which fails the replica and makes it learn the data again.
+        bulk_load_info info;
+        if (!info.load(update.dir)) {
+            derror_replica("ingest failed: decree = {}, error = load bulk load info from {} "
+                           "failed",
+                           decree,
+                           update.dir);
+            resp.error = rocksdb::Status::kIOError;
+            clear_up_batch_states(decree, resp.error);
+            return resp.error;
+        }
+        if (info.data_version != _pegasus_data_version) {
+            derror_replica("invalid argument for ingest: decree = {}, error = "
+                           "data version {} of {} mismatches {}",
+                           decree,
+                           info.data_version,
+                           update.dir,
+                           _pegasus_data_version);
+            resp.error = rocksdb::Status::kInvalidArgument;
+            return empty_put(decree);
+        }
+        std::vector<std::string> files;
+        if (!bulk_load_info::get_sst_files(update.dir, update.partition_index, files)) {
+            derror_replica("ingest failed: decree = {}, error = list sst files in {} failed",
+                           decree,
+                           bulk_load_info::partition_dir(update.dir, update.partition_index));
+            resp.error = rocksdb::Status::kIOError;
+            clear_up_batch_states(decree, resp.error);
+            return resp.error;
+        }
+
+        if (!files.empty()) {
+            // the files are copied rather than moved, since they are shared by all the replicas,
+            // and are ingested again if this mutation is replayed.
+            rocksdb::IngestExternalFileOptions ifo;
+            ifo.move_files = false;
+            ifo.allow_global_seqno = true;
+            ifo.allow_blocking_flush = true;
+            // the key ranges of the files don't overlap, so they are ingested at once, and are
+            // placed into the lowest possible levels
+            rocksdb::Status s = _db->IngestExternalFile(_data_cf, files, ifo);
+            if (dsn_unlikely(!s.ok())) {
+                derror_rocksdb("IngestExternalFile",
+                               s.ToString(),
+                               "decree: {}, dir: {}",
+                               decree,
+                               bulk_load_info::partition_dir(update.dir, update.partition_index));
+                if (s.IsInvalidArgument() || s.IsNotSupported()) {
+                    // the files are invalid, e.g. their key ranges overlap, which is the same on
+                    // all the replicas
+                    resp.error = rocksdb::Status::kInvalidArgument;
+                    return empty_put(decree);
+                }
+                resp.error = s.code();
+                clear_up_batch_states(decree, resp.error);
+                return resp.error;
+            }
+            if (_read_cache != nullptr) {
+                // the ingested keys are unknown, so the whole cache is invalidated
+                _read_cache->clear();
+            }
+            // the ingested records may have ttl
+            _may_contain_ttl_records = true;
+            ddebug_replica("ingest {} sst files from {} succeed, decree = {}",
+                           files.size(),
+                           update.dir,
+                           decree);
+        }
+
+        // the last flushed decree is advanced along with the ingested data by an empty write
+        resp.error = rocksdb::Status::kOk;
+        int err = empty_put(decree);
+        if (err == 0 && !files.empty()) {
+            // the decree is flushed at once, so that this replica doesn't replay the ingestion
+            // after restarted, which needs the directory again
+            rocksdb::FlushOptions options;
+            options.wait = true;
+            rocksdb::Status s = _db->Flush(options, {_meta_cf, _data_cf, _blob_cf});
+            if (dsn_unlikely(!s.ok())) {
+                derror_rocksdb("Flush", s.ToString(), "decree: {}", decree);
+            }
+        }
+        return err;
+    }
+
+    int incr(int64_t decree, const dsn::apps::incr_request &update, dsn::apps::incr_response &resp)
+    {
+        int err = batch_incr(decree, update, resp);
+        if (err) {
+            batch_abort(decree, err);
+            return err;
+        }
+        return batch_commit(decree);
+    }
+
+    int check_and_set(int64_t decree,
+                      const dsn::apps::check_and_set_request &update,
+                      dsn::apps::check_and_set_response &resp)
+    {
+        int err = batch_check_and_set(decree, update, resp);
+        if (err) {
+            batch_abort(decree, err);
+            return err;
+        }
+        return batch_commit(decree);
+    }
+
+    int check_and_mutate(int64_t decree,
+                         const dsn::apps::check_and_mutate_request &update,
+                         dsn::apps::check_and_mutate_response &resp)
+    {
+        int err = batch_check_and_mutate(decree, update, resp);
+        if (err) {
+            batch_abort(decree, err);
+            return err;
+        }
+        return batch_commit(decree);
+    }
+
+    /// For batch write.
+    /// The read-modify-write operations read the records by `db_get`, which sees the writes
+    /// added earlier in the same batch, so any kinds of writes can be committed in one batch.
+    /// If an operation is rejected (e.g. invalid argument or check not passed), nothing is
+    /// added into the batch, and 0 is returned with the error set in the response.
+
+    int batch_multi_put(const db_write_context &ctx,
+                        const dsn::apps::multi_put_request &update,
+                        dsn::apps::update_response &resp)
     {
         int64_t decree = ctx.decree;
         resp.app_id = get_gpid().get_app_id();
@@ -96,30 +351,29 @@ public:
                            decree,
                            "request.kvs is empty");
             resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+            return 0;
         }
 
-        for (auto &kv : update.kvs) {
+        composite_raw_keys(update.hash_key, update.kvs, [](const dsn::apps::key_value &kv) {
+            return dsn::string_view(kv.key.data(), kv.key.length());
+        });
+        for (size_t i = 0; i < update.kvs.size(); ++i) {
             resp.error = db_write_batch_put_ctx(ctx,
-                                                composite_raw_key(update.hash_key, kv.key),
-                                                kv.value,
+                                                _raw_keys[i],
+                                                update.kvs[i].value,
                                                 static_cast<uint32_t>(update.expire_ts_seconds));
             if (resp.error) {
-                clear_up_batch_states(decree, resp.error);
                 return resp.error;
             }
         }
 
-        resp.error = db_write(decree);
-
-        clear_up_batch_states(decree, resp.error);
-        return resp.error;
+        _batch_errors.emplace_back(&resp.error);
+        return 0;
     }
 
-    int multi_remove(int64_t decree,
-                     const dsn::apps::multi_remove_request &update,
-                     dsn::apps::multi_remove_response &resp)
+    int batch_multi_remove(int64_t decree,
+                           const dsn::apps::multi_remove_request &update,
+                           dsn::apps::multi_remove_response &resp)
     {
         resp.app_id = get_gpid().get_app_id();
         resp.partition_index = get_gpid().get_partition_index();
@@ -131,40 +385,42 @@ public:
                            decree,
                            "request.sort_keys is empty");
             resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+            return 0;
         }
 
-        for (auto &sort_key : update.sort_keys) {
-            resp.error =
-                db_write_batch_delete(decree, composite_raw_key(update.hash_key, sort_key));
+        composite_raw_keys(update.hash_key, update.sort_keys, [](const dsn::blob &sort_key) {
+            return dsn::string_view(sort_key.data(), sort_key.length());
+        });
+        for (dsn::string_view raw_key : _raw_keys) {
+            resp.error = db_write_batch_delete(decree, raw_key);
             if (resp.error) {
-                clear_up_batch_states(decree, resp.error);
                 return resp.error;
             }
         }
 
-        resp.error = db_write(decree);
-        if (resp.error == 0) {
-            resp.count = update.sort_keys.size();
-        }
-
-        clear_up_batch_states(decree, resp.error);
-        return resp.error;
+        resp.count = update.sort_keys.size();
+        _batch_errors.emplace_back(&resp.error);
+        return 0;
     }
 
-    int incr(int64_t decree, const dsn::apps::incr_request &update, dsn::apps::incr_response &resp)
+    int batch_incr(int64_t decree,
+                   const dsn::apps::incr_request &update,
+                   dsn::apps::incr_response &resp)
     {
         resp.app_id = get_gpid().get_app_id();
         resp.partition_index = get_gpid().get_partition_index();
         resp.decree = decree;
         resp.server = _primary_address;
 
+        if (can_blind_incr(update)) {
+            return batch_blind_incr(decree, update, resp);
+        }
+
         rocksdb::Slice raw_key(update.key.data(), update.key.length());
         std::string raw_value;
         int64_t new_value = 0;
         uint32_t new_expire_ts = 0;
-        rocksdb::Status s = _db->Get(_rd_opts, raw_key, &raw_value);
+        rocksdb::Status s = db_get_from_batch_and_db(_data_cf, raw_key, &raw_value);
         if (s.ok()) {
             uint32_t old_expire_ts = pegasus_extract_expire_ts(_pegasus_data_version, raw_value);
             if (check_if_ts_expired(utils::epoch_now(), old_expire_ts)) {
@@ -173,6 +429,9 @@ public:
                 new_value = update.increment;
                 new_expire_ts = update.expire_ts_seconds > 0 ? update.expire_ts_seconds : 0;
             } else {
+                // a separated value is too large to be an integer
+                bool separated =
+                    pegasus_value_separation::is_separated(_pegasus_data_version, raw_value);
                 ::dsn::blob old_value;
                 pegasus_extract_user_data(_pegasus_data_version, std::move(raw_value), old_value);
                 if (old_value.length() == 0) {
@@ -180,15 +439,14 @@ public:
                     new_value = update.increment;
                 } else {
                     int64_t old_value_int;
-                    if (!dsn::buf2int64(old_value, old_value_int)) {
+                    if (separated || !dsn::buf2int64(old_value, old_value_int)) {
                         // invalid old value
                         derror_replica("incr failed: decree = {}, error = "
                                        "old value \"{}\" is not an integer or out of range",
                                        decree,
                                        utils::c_escape_string(old_value));
                         resp.error = rocksdb::Status::kInvalidArgument;
-                        // we should write empty record to update rocksdb's last flushed decree
-                        return empty_put(decree);
+                        return 0;
                     }
                     new_value = old_value_int + update.increment;
                     if ((update.increment > 0 && new_value < old_value_int) ||
@@ -201,8 +459,7 @@ public:
                                        update.increment);
                         resp.error = rocksdb::Status::kInvalidArgument;
                         resp.new_value = old_value_int;
-                        // we should write empty record to update rocksdb's last flushed decree
-                        return empty_put(decree);
+                        return 0;
                     }
                 }
                 // set new ttl
@@ -234,128 +491,71 @@ public:
         resp.error =
             db_write_batch_put(decree, update.key, std::to_string(new_value), new_expire_ts);
         if (resp.error) {
-            clear_up_batch_states(decree, resp.error);
             return resp.error;
         }
 
-        resp.error = db_write(decree);
-        if (resp.error == 0) {
-            resp.new_value = new_value;
-        }
-
-        clear_up_batch_states(decree, resp.error);
-        return resp.error;
+        resp.new_value = new_value;
+        _batch_errors.emplace_back(&resp.error);
+        return 0;
     }
 
-    int check_and_set(int64_t decree,
-                      const dsn::apps::check_and_set_request &update,
-                      dsn::apps::check_and_set_response &resp)
+    int batch_check_and_set(int64_t decree,
+                            const dsn::apps::check_and_set_request &update,
+                            dsn::apps::check_and_set_response &resp)
     {
         resp.app_id = get_gpid().get_app_id();
         resp.partition_index = get_gpid().get_partition_index();
         resp.decree = decree;
         resp.server = _primary_address;
 
-        if (!is_check_type_supported(update.check_type)) {
+        if (!collect_check_conditions(update)) {
             derror_replica("invalid argument for check_and_set: decree = {}, error = {}",
                            decree,
-                           "check type {} not supported",
-                           update.check_type);
+                           "check type not supported");
             resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+            return 0;
         }
 
-        ::dsn::blob check_key;
-        pegasus_generate_key(check_key, update.hash_key, update.check_sort_key);
-        rocksdb::Slice check_raw_key(check_key.data(), check_key.length());
-        std::string check_raw_value;
-        rocksdb::Status check_status = _db->Get(_rd_opts, check_raw_key, &check_raw_value);
-        if (check_status.ok()) {
-            // read check value succeed
-            if (check_if_record_expired(
-                    _pegasus_data_version, utils::epoch_now(), check_raw_value)) {
-                // check value ttl timeout
-                _pfc_recent_expire_count->increment();
-                check_status = rocksdb::Status::NotFound();
-            }
-        } else if (!check_status.IsNotFound()) {
-            // read check value failed
-            derror_rocksdb("GetCheckValue for CheckAndSet",
-                           check_status.ToString(),
-                           "decree: {}, hash_key: {}, check_sort_key: {}",
-                           decree,
-                           utils::c_escape_string(update.hash_key),
-                           utils::c_escape_string(update.check_sort_key));
-            resp.error = check_status.code();
+        bool passed = false;
+        bool invalid_argument = false;
+        int err = evaluate_check_conditions(
+            decree, "CheckAndSet", update.hash_key, passed, invalid_argument);
+        if (err) {
+            resp.error = err;
             return resp.error;
         }
-        dassert_f(check_status.ok() || check_status.IsNotFound(),
-                  "status = %s",
-                  check_status.ToString().c_str());
-
-        ::dsn::blob check_value;
-        if (check_status.ok()) {
-            pegasus_extract_user_data(
-                _pegasus_data_version, std::move(check_raw_value), check_value);
-        }
 
         if (update.return_check_value) {
-            resp.check_value_returned = true;
-            if (check_status.ok()) {
-                resp.check_value_exist = true;
-                resp.check_value = check_value;
-            }
+            return_check_values(resp);
         }
 
-        bool invalid_argument = false;
-        bool passed = validate_check(decree,
-                                     update.check_type,
-                                     update.check_operand,
-                                     check_status.ok(),
-                                     check_value,
-                                     invalid_argument);
-
         if (passed) {
             // check passed, write new value
             ::dsn::blob set_key;
-            if (update.set_diff_sort_key) {
-                pegasus_generate_key(set_key, update.hash_key, update.set_sort_key);
-            } else {
-                set_key = check_key;
-            }
+            pegasus_generate_key(set_key,
+                                 update.hash_key,
+                                 update.set_diff_sort_key ? update.set_sort_key
+                                                          : update.check_sort_key);
             resp.error = db_write_batch_put(decree,
                                             set_key,
                                             update.set_value,
                                             static_cast<uint32_t>(update.set_expire_ts_seconds));
+            if (resp.error) {
+                return resp.error;
+            }
         } else {
-            // check not passed, write empty record to update rocksdb's last flushed decree
-            resp.error = db_write_batch_put(decree, dsn::string_view(), dsn::string_view(), 0);
-        }
-        if (resp.error) {
-            clear_up_batch_states(decree, resp.error);
-            return resp.error;
-        }
-
-        resp.error = db_write(decree);
-        if (resp.error) {
-            clear_up_batch_states(decree, resp.error);
-            return resp.error;
-        }
-
-        if (!passed) {
             // check not passed, return proper error code to user
             resp.error =
                 invalid_argument ? rocksdb::Status::kInvalidArgument : rocksdb::Status::kTryAgain;
         }
 
-        clear_up_batch_states(decree, resp.error);
+        _batch_errors.emplace_back(&resp.error);
         return 0;
     }
 
-    int check_and_mutate(int64_t decree,
-                         const dsn::apps::check_and_mutate_request &update,
-                         dsn::apps::check_and_mutate_response &resp)
+    int batch_check_and_mutate(int64_t decree,
+                               const dsn::apps::check_and_mutate_request &update,
+                               dsn::apps::check_and_mutate_response &resp)
     {
         resp.app_id = get_gpid().get_app_id();
         resp.partition_index = get_gpid().get_partition_index();
@@ -367,8 +567,7 @@ public:
                            decree,
                            "mutate list is empty");
             resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+            return 0;
         }
 
         for (int i = 0; i < update.mutate_list.size(); ++i) {
@@ -381,75 +580,39 @@ public:
                                i,
                                mu.operation);
                 resp.error = rocksdb::Status::kInvalidArgument;
-                // we should write empty record to update rocksdb's last flushed decree
-                return empty_put(decree);
+                return 0;
             }
         }
 
-        if (!is_check_type_supported(update.check_type)) {
+        if (!collect_check_conditions(update)) {
             derror_replica("invalid argument for check_and_mutate: decree = {}, error = {}",
                            decree,
-                           "check type {} not supported",
-                           update.check_type);
+                           "check type not supported");
             resp.error = rocksdb::Status::kInvalidArgument;
-            // we should write empty record to update rocksdb's last flushed decree
-            return empty_put(decree);
+            return 0;
         }
 
-        ::dsn::blob check_key;
-        pegasus_generate_key(check_key, update.hash_key, update.check_sort_key);
-        rocksdb::Slice check_raw_key(check_key.data(), check_key.length());
-        std::string check_raw_value;
-        rocksdb::Status check_status = _db->Get(_rd_opts, check_raw_key, &check_raw_value);
-        if (check_status.ok()) {
-            // read check value succeed
-            if (check_if_record_expired(
-                    _pegasus_data_version, utils::epoch_now(), check_raw_value)) {
-                // check value ttl timeout
-                _pfc_recent_expire_count->increment();
-                check_status = rocksdb::Status::NotFound();
-            }
-        } else if (!check_status.IsNotFound()) {
-            // read check value failed
-            derror_rocksdb("GetCheckValue for CheckAndMutate",
-                           check_status.ToString(),
-                           "decree: {}, hash_key: {}, check_sort_key: {}",
-                           decree,
-                           utils::c_escape_string(update.hash_key),
-                           utils::c_escape_string(update.check_sort_key));
-            resp.error = check_status.code();
+        bool passed = false;
+        bool invalid_argument = false;
+        int err = evaluate_check_conditions(
+            decree, "CheckAndMutate", update.hash_key, passed, invalid_argument);
+        if (err) {
+            resp.error = err;
             return resp.error;
         }
-        dassert_f(check_status.ok() || check_status.IsNotFound(),
-                  "status = %s",
-                  check_status.ToString().c_str());
-
-        ::dsn::blob check_value;
-        if (check_status.ok()) {
-            pegasus_extract_user_data(
-                _pegasus_data_version, std::move(check_raw_value), check_value);
-        }
 
         if (update.return_check_value) {
-            resp.check_value_returned = true;
-            if (check_status.ok()) {
-                resp.check_value_exist = true;
-                resp.check_value = check_value;
-            }
+            return_check_values(resp);
         }
 
-        bool invalid_argument = false;
-        bool passed = validate_check(decree,
-                                     update.check_type,
-                                     update.check_operand,
-                                     check_status.ok(),
-                                     check_value,
-                                     invalid_argument);
-
         if (passed) {
-            for (auto &m : update.mutate_list) {
-                ::dsn::blob key;
-                pegasus_generate_key(key, update.hash_key, m.sort_key);
+            composite_raw_keys(
+                update.hash_key, update.mutate_list, [](const ::dsn::apps::mutate &m) {
+                    return dsn::string_view(m.sort_key.data(), m.sort_key.length());
+                });
+            for (size_t i = 0; i < update.mutate_list.size(); ++i) {
+                const ::dsn::apps::mutate &m = update.mutate_list[i];
+                dsn::string_view key = _raw_keys[i];
                 if (m.operation == ::dsn::apps::mutate_operation::MO_PUT) {
                     resp.error = db_write_batch_put(
                         decree, key, m.value, static_cast<uint32_t>(m.set_expire_ts_seconds));
@@ -460,38 +623,21 @@ public:
                     resp.error = db_write_batch_delete(decree, key);
                 }
 
-                // in case of failure, cancel mutations
-                if (resp.error)
-                    break;
+                // in case of failure, the whole batch is aborted
+                if (resp.error) {
+                    return resp.error;
+                }
             }
         } else {
-            // check not passed, write empty record to update rocksdb's last flushed decree
-            resp.error = db_write_batch_put(decree, dsn::string_view(), dsn::string_view(), 0);
-        }
-
-        if (resp.error) {
-            clear_up_batch_states(decree, resp.error);
-            return resp.error;
-        }
-
-        resp.error = db_write(decree);
-        if (resp.error) {
-            clear_up_batch_states(decree, resp.error);
-            return resp.error;
-        }
-
-        if (!passed) {
             // check not passed, return proper error code to user
             resp.error =
                 invalid_argument ? rocksdb::Status::kInvalidArgument : rocksdb::Status::kTryAgain;
         }
 
-        clear_up_batch_states(decree, resp.error);
+        _batch_errors.emplace_back(&resp.error);
         return 0;
     }
 
-    /// For batch write.
-
     int batch_put(const db_write_context &ctx,
                   const dsn::apps::update_request &update,
                   dsn::apps::update_response &resp)
@@ -511,7 +657,15 @@ public:
 
     int batch_commit(int64_t decree)
     {
-        int err = db_write(decree);
+        int err = 0;
+        if (_batch.Count() == 0) {
+            // all the writes are rejected, we should write empty record to update rocksdb's
+            // last flushed decree
+            err = db_write_batch_put(decree, dsn::string_view(), dsn::string_view(), 0);
+        }
+        if (!err) {
+            err = db_write(decree);
+        }
         clear_up_batch_states(decree, err);
         return err;
     }
@@ -526,7 +680,79 @@ public:
         }
     }
 
+    void set_blind_incr(bool blind_incr)
+    {
+        if (_blind_incr != blind_incr) {
+            _blind_incr = blind_incr;
+            ddebug_replica("update _blind_incr to {}.", blind_incr);
+        }
+    }
+
+    void set_may_contain_ttl_records(bool may_contain)
+    {
+        if (_may_contain_ttl_records != may_contain) {
+            _may_contain_ttl_records = may_contain;
+            ddebug_replica("update _may_contain_ttl_records to {}.", may_contain);
+        }
+    }
+
+    void set_value_separation_min_size(uint32_t min_size)
+    {
+        if (_value_separation_min_size != min_size) {
+            _value_separation_min_size = min_size;
+            ddebug_replica("update _value_separation_min_size to {}.", min_size);
+        }
+    }
+
 private:
+    // An expired record is physically removed by the compaction filter or by dropping the
+    // expired ssts, at a time depending on compaction. A blind increment on such a record would
+    // be merged either onto the record or onto nothing, giving different values on different
+    // replicas, so the increments fall back to read-modify-write once any record with ttl may
+    // exist, or if the increment itself sets a ttl.
+    bool can_blind_incr(const dsn::apps::incr_request &update) const
+    {
+        return _blind_incr && !_may_contain_ttl_records && _default_ttl == 0 &&
+               update.expire_ts_seconds <= 0;
+    }
+
+    // appends the increment as a merge operand, which is applied by pegasus_incr_merge_operator
+    // when the record is read or compacted, so the old value is not read and `new_value` of the
+    // response is always 0.
+    int batch_blind_incr(int64_t decree,
+                         const dsn::apps::incr_request &update,
+                         dsn::apps::incr_response &resp)
+    {
+        incr_merge_operand op;
+        op.increment = update.increment;
+        op.expire_ts_seconds = update.expire_ts_seconds;
+        op.default_expire_ts = db_expire_ts(0);
+        op.epoch_now = utils::epoch_now();
+        op.timetag = generate_timetag(
+            db_write_context::empty(decree).timestamp, get_cluster_id_if_exists(), false);
+        op.encode(_merge_operand_buf);
+
+        rocksdb::Slice raw_key(update.key.data(), update.key.length());
+        rocksdb::Status s = _batch.Merge(raw_key, _merge_operand_buf);
+        if (dsn_unlikely(!s.ok())) {
+            ::dsn::blob hash_key, sort_key;
+            pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
+            derror_rocksdb("WriteBatchMerge",
+                           s.ToString(),
+                           "decree: {}, hash_key: {}, sort_key: {}",
+                           decree,
+                           utils::c_escape_string(hash_key),
+                           utils::c_escape_string(sort_key));
+            resp.error = s.code();
+            return resp.error;
+        }
+        record_written_key(utils::to_string_view(raw_key));
+
+        resp.new_value = 0;
+        _batch_errors.emplace_back(&resp.error);
+        return 0;
+    }
+
     int db_write_batch_put(int64_t decree,
                            dsn::string_view raw_key,
                            dsn::string_view value,
@@ -559,8 +785,10 @@ private:
             }
             // if record exists and is not expired.
             if (get_ctx.found && !get_ctx.expired) {
+                // the flag of separation is not a part of the version
                 uint64_t local_timetag =
-                    pegasus_extract_timetag(_pegasus_data_version, get_ctx.raw_value);
+                    pegasus_extract_timetag(_pegasus_data_version, get_ctx.raw_value) &
+                    ~pegasus_value_separation::SEPARATED_TAG;
 
                 if (local_timetag >= new_timetag) {
                     // ignore this stale update with lower timetag,
@@ -570,11 +798,29 @@ private:
             }
         }
 
+        rocksdb::Status s;
+        if (_value_separation_min_size > 0 && _pegasus_data_version >= 1 && !raw_key.empty() &&
+            value.length() >= _value_separation_min_size) {
+            // separate the value into the blob column family, and keep a reference to it in the
+            // record tagged as separated, see pegasus_value_separation
+            pegasus_value_separation::generate_blob_key(raw_key, ctx.decree, _blob_key_buf);
+            s = _batch.Put(_blob_cf, _blob_key_buf, utils::to_rocksdb_slice(value));
+            pegasus_value_separation::generate_reference(ctx.decree, _reference_buf);
+            value = _reference_buf;
+            new_timetag |= pegasus_value_separation::SEPARATED_TAG;
+        }
+
+        uint32_t expire_ts = db_expire_ts(expire_sec);
+        if (expire_ts > 0 && !raw_key.empty()) {
+            _may_contain_ttl_records = true;
+        }
         rocksdb::Slice skey = utils::to_rocksdb_slice(raw_key);
         rocksdb::SliceParts skey_parts(&skey, 1);
-        rocksdb::SliceParts svalue = _value_generator.generate_value(
-            _pegasus_data_version, value, db_expire_ts(expire_sec), new_timetag);
-        rocksdb::Status s = _batch.Put(skey_parts, svalue);
+        rocksdb::SliceParts svalue =
+            _value_generator.generate_value(_pegasus_data_version, value, expire_ts, new_timetag);
+        if (s.ok()) {
+            s = _batch.Put(skey_parts, svalue);
+        }
         if (dsn_unlikely(!s.ok())) {
             ::dsn::blob hash_key, sort_key;
             pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
@@ -585,6 +831,8 @@ private:
                            utils::c_escape_string(hash_key),
                            utils::c_escape_string(sort_key),
                            expire_sec);
+        } else {
+            record_written_key(raw_key);
         }
         return s.code();
     }
@@ -604,6 +852,8 @@ private:
                            decree,
                            utils::c_escape_string(hash_key),
                            utils::c_escape_string(sort_key));
+        } else {
+            record_written_key(raw_key);
         }
         return s.code();
     }
@@ -630,16 +880,136 @@ private:
         if (dsn_unlikely(!status.ok())) {
             derror_rocksdb("Write", status.ToString(), "write rocksdb error, decree: {}", decree);
         }
+
+        // invalidate after the batch is committed, so that the read cache can't be refilled
+        // with the old values, see read_cache.
+        for (size_t i = 0; i < _written_key_count; ++i) {
+            _read_cache->invalidate(_written_keys[i]);
+        }
+        _written_key_count = 0;
         return status.code();
     }
 
+    // Replaces `user_data` of `raw_value` with the separated value if the record is separated,
+    // see pegasus_value_separation.
+    int db_read_separated_value(int64_t decree,
+                                dsn::string_view raw_key,
+                                dsn::string_view raw_value,
+                                ::dsn::blob &user_data)
+    {
+        if (!pegasus_value_separation::is_separated(_pegasus_data_version, raw_value)) {
+            return 0;
+        }
+
+        rocksdb::Status s;
+        int64_t value_decree = 0;
+        auto value = std::make_shared<std::string>();
+        if (!pegasus_value_separation::extract_reference(
+                dsn::string_view(user_data.data(), user_data.length()), value_decree)) {
+            s = rocksdb::Status::Corruption("invalid reference of separated value");
+        } else {
+            pegasus_value_separation::generate_blob_key(raw_key, value_decree, _blob_key_buf);
+            s = db_get_from_batch_and_db(_blob_cf, _blob_key_buf, value.get());
+            if (s.IsNotFound()) {
+                // the blob must be kept as long as the record refers to it
+                s = rocksdb::Status::Corruption("separated value not found");
+            }
+        }
+        if (dsn_unlikely(!s.ok())) {
+            ::dsn::blob hash_key, sort_key;
+            pegasus_restore_key(::dsn::blob(raw_key.data(), 0, raw_key.size()), hash_key, sort_key);
+            derror_rocksdb("GetSeparatedValue",
+                           s.ToString(),
+                           "decree: {}, hash_key: {}, sort_key: {}",
+                           decree,
+                           utils::c_escape_string(hash_key),
+                           utils::c_escape_string(sort_key));
+            return s.code();
+        }
+        std::shared_ptr<char> buf(value, const_cast<char *>(value->data()));
+        user_data.assign(std::move(buf), 0, static_cast<unsigned int>(value->size()));
+        return 0;
+    }
+
+    // Reads the record of `key` from the write batch and the db, so the writes added earlier in
+    // the same batch are seen.
+    rocksdb::Status db_get_from_batch_and_db(rocksdb::ColumnFamilyHandle *cf,
+                                             const rocksdb::Slice &key,
+                                             rocksdb::PinnableSlice *value)
+    {
+        const write_batch_overlay::record *r = _batch_overlay.lookup(_batch, cf->GetID(), key);
+        if (r == nullptr) {
+            return _db->Get(_rd_opts, cf, key, value);
+        }
+        return read_batch_record(cf, key, *r, value);
+    }
+
+    rocksdb::Status db_get_from_batch_and_db(rocksdb::ColumnFamilyHandle *cf,
+                                             const rocksdb::Slice &key,
+                                             std::string *value)
+    {
+        rocksdb::PinnableSlice pinnable_value(value);
+        rocksdb::Status s = db_get_from_batch_and_db(cf, key, &pinnable_value);
+        if (s.ok() && pinnable_value.IsPinned()) {
+            value->assign(pinnable_value.data(), pinnable_value.size());
+        }
+        return s;
+    }
+
+    // Reads the value of the record `r` of `key` in the write batch.
+    rocksdb::Status read_batch_record(rocksdb::ColumnFamilyHandle *cf,
+                                      const rocksdb::Slice &key,
+                                      const write_batch_overlay::record &r,
+                                      rocksdb::PinnableSlice *value)
+    {
+        if (r.type == write_batch_overlay::record_type::PUT) {
+            value->PinSelf(r.value);
+            return rocksdb::Status::OK();
+        }
+        if (r.type == write_batch_overlay::record_type::DELETE) {
+            return rocksdb::Status::NotFound();
+        }
+
+        // apply the merge operands of the blind increments on the base record, which is in the
+        // batch or in the db, just like the merge operator does when the record is read
+        dassert(r.type == write_batch_overlay::record_type::MERGE, "");
+        std::string base_value;
+        const std::string *existing_value = nullptr;
+        if (r.has_base_value) {
+            existing_value = &r.value;
+        } else if (!r.base_deleted) {
+            rocksdb::Status s = _db->Get(_rd_opts, cf, key, &base_value);
+            if (s.ok()) {
+                existing_value = &base_value;
+            } else if (!s.IsNotFound()) {
+                return s;
+            }
+        }
+        rocksdb::Slice existing_slice;
+        if (existing_value != nullptr) {
+            existing_slice = *existing_value;
+        }
+        std::vector<rocksdb::Slice> operands(r.merge_operands.begin(), r.merge_operands.end());
+        rocksdb::MergeOperator::MergeOperationInput merge_in(
+            key, existing_value != nullptr ? &existing_slice : nullptr, operands, nullptr);
+        rocksdb::Slice existing_operand;
+        rocksdb::MergeOperator::MergeOperationOutput merge_out(*value->GetSelf(),
+                                                               existing_operand);
+        if (!_incr_merge_operator.FullMergeV2(merge_in, &merge_out)) {
+            return rocksdb::Status::Corruption("invalid merge operand of blind increment");
+        }
+        value->PinSelf();
+        return rocksdb::Status::OK();
+    }
+
     // The resulted `expire_ts` is -1 if record is expired.
     int db_get(dsn::string_view raw_key,
                /*out*/ db_get_context *ctx)
     {
         FAIL_POINT_INJECT_F("db_get", [](dsn::string_view) -> int { return FAIL_DB_GET; });
 
-        rocksdb::Status s = _db->Get(_rd_opts, utils::to_rocksdb_slice(raw_key), &(ctx->raw_value));
+        rocksdb::Status s =
+            db_get_from_batch_and_db(_data_cf, utils::to_rocksdb_slice(raw_key), &(ctx->raw_value));
         if (dsn_likely(s.ok())) {
             // success
             ctx->found = true;
@@ -678,8 +1048,111 @@ private:
             }
             _update_responses.clear();
         }
+        if (err) {
+            for (int32_t *error : _batch_errors) {
+                *error = err;
+            }
+        }
+        _batch_errors.clear();
 
+        // the capacity of the write batch and the buffers is kept for the next batch
         _batch.Clear();
+        _batch_overlay.clear();
+        _written_key_count = 0;
+        shrink_buffers_if_needed();
+    }
+
+    void record_written_key(dsn::string_view raw_key)
+    {
+        // empty key is written only to update the last flushed decree
+        if (_read_cache != nullptr && !raw_key.empty()) {
+            // the strings are reused to keep their capacity
+            if (_written_key_count == _written_keys.size()) {
+                if (_written_keys.size() == _written_keys.capacity()) {
+                    _key_buffer_alloc_count++;
+                }
+                _written_keys.emplace_back();
+            }
+            std::string &key = _written_keys[_written_key_count++];
+            reserve_buffer(key, raw_key.size());
+            key.assign(raw_key.data(), raw_key.size());
+        }
+    }
+
+    // Composes the raw keys of the sort keys of `items` into `_key_arena` in one pass, which are
+    // referred by `_raw_keys` until the next call. Nothing is allocated once the arena is large
+    // enough for the recent batches.
+    template <typename T, typename SortKeyOf>
+    void composite_raw_keys(dsn::string_view hash_key,
+                            const std::vector<T> &items,
+                            const SortKeyOf &sort_key_of)
+    {
+        dassert(hash_key.length() < UINT16_MAX, "hash key length must be less than UINT16_MAX");
+
+        size_t total_size = 0;
+        for (const T &item : items) {
+            total_size += 2 + hash_key.length() + sort_key_of(item).length();
+        }
+        // the arena must not be reallocated after the keys are referred
+        reserve_buffer(_key_arena, total_size);
+        reserve_buffer(_raw_keys, items.size());
+        _key_arena.resize(total_size);
+        _raw_keys.clear();
+        _recent_peak_key_arena_size = std::max(_recent_peak_key_arena_size, total_size);
+
+        // hash_key_len is in big endian
+        uint16_t hash_key_len = htobe16(static_cast<uint16_t>(hash_key.length()));
+        char *p = &_key_arena[0];
+        for (const T &item : items) {
+            dsn::string_view sort_key = sort_key_of(item);
+            char *key = p;
+            memcpy(p, &hash_key_len, sizeof(hash_key_len));
+            p += sizeof(hash_key_len);
+            if (!hash_key.empty()) {
+                memcpy(p, hash_key.data(), hash_key.length());
+                p += hash_key.length();
+            }
+            if (!sort_key.empty()) {
+                memcpy(p, sort_key.data(), sort_key.length());
+                p += sort_key.length();
+            }
+            _raw_keys.emplace_back(key, p - key);
+        }
+    }
+
+    template <typename Buffer>
+    void reserve_buffer(Buffer &buffer, size_t size)
+    {
+        if (buffer.capacity() < size) {
+            buffer.reserve(size);
+            _key_buffer_alloc_count++;
+        }
+    }
+
+    // Releases the key arena if it's much larger than the peak usage of the recent batches,
+    // e.g. after a huge multi_put.
+    void shrink_buffers_if_needed()
+    {
+        static const size_t SHRINK_CHECK_BATCH_COUNT = 1024;
+        static const size_t MIN_SHRINK_CAPACITY = 1 << 20;
+        if (++_batch_count_since_shrink_check < SHRINK_CHECK_BATCH_COUNT) {
+            return;
+        }
+        if (_key_arena.capacity() > MIN_SHRINK_CAPACITY &&
+            _key_arena.capacity() > 4 * _recent_peak_key_arena_size) {
+            std::string().swap(_key_arena);
+            reserve_buffer(_key_arena, _recent_peak_key_arena_size);
+        }
+        _batch_count_since_shrink_check = 0;
+        _recent_peak_key_arena_size = 0;
+    }
+
+    // Returns the count of the allocations of the reused key buffers since the last call.
+    uint64_t reset_key_buffer_alloc_count()
+    {
+        uint64_t count = _key_buffer_alloc_count;
+        _key_buffer_alloc_count = 0;
+        return count;
     }
 
     static dsn::blob composite_raw_key(dsn::string_view hash_key, dsn::string_view sort_key)
@@ -689,6 +1162,136 @@ private:
         return raw_key;
     }
 
+    // Collects the check of check_and_set or check_and_mutate and its extra conditions into
+    // `_check_conditions`, of which the first one is the check of the request itself.
+    // \returns false if any check type is not supported.
+    template <typename TRequest>
+    bool collect_check_conditions(const TRequest &update)
+    {
+        _check_conditions.resize(update.extra_conditions.size() + 1);
+        _check_conditions[0].check_sort_key = update.check_sort_key;
+        _check_conditions[0].check_type = update.check_type;
+        _check_conditions[0].check_operand = update.check_operand;
+        std::copy(update.extra_conditions.begin(),
+                  update.extra_conditions.end(),
+                  _check_conditions.begin() + 1);
+        for (const ::dsn::apps::cas_condition &cond : _check_conditions) {
+            if (!is_check_type_supported(cond.check_type)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Evaluates the conjunction of `_check_conditions` on the sort keys of `hash_key`.
+    // The check values are read by one batched MultiGet from the db, and the records added
+    // earlier in the same batch are read from the batch, so all the conditions see the same
+    // records.
+    // The check value of `_check_conditions[i]` is kept in `_check_values[i]`.
+    // \returns 0 if the conditions are evaluated, and `passed` and `invalid_argument` are set
+    // like validate_check, non-0 if failed to read the check values.
+    int evaluate_check_conditions(int64_t decree,
+                                  const char *op_name,
+                                  const ::dsn::blob &hash_key,
+                                  bool &passed,
+                                  bool &invalid_argument)
+    {
+        size_t count = _check_conditions.size();
+        composite_raw_keys(hash_key, _check_conditions, [](const ::dsn::apps::cas_condition &c) {
+            return dsn::string_view(c.check_sort_key.data(), c.check_sort_key.length());
+        });
+        std::vector<rocksdb::Slice> raw_keys;
+        raw_keys.reserve(count);
+        for (dsn::string_view raw_key : _raw_keys) {
+            raw_keys.emplace_back(utils::to_rocksdb_slice(raw_key));
+        }
+        // the pinned values are shared with the check values by the aliasing constructor
+        std::shared_ptr<rocksdb::PinnableSlice> raw_values(
+            new rocksdb::PinnableSlice[count], std::default_delete<rocksdb::PinnableSlice[]>());
+        std::vector<rocksdb::Status> statuses(count);
+        _db->MultiGet(_rd_opts,
+                      _data_cf,
+                      count,
+                      raw_keys.data(),
+                      raw_values.get(),
+                      statuses.data(),
+                      false);
+        // the keys written earlier in the same batch are read from the batch instead, which is
+        // rare, so they are read from the db needlessly to keep the MultiGet in one batch
+        for (size_t i = 0; i < count && _batch.Count() != 0; ++i) {
+            const write_batch_overlay::record *r =
+                _batch_overlay.lookup(_batch, _data_cf->GetID(), raw_keys[i]);
+            if (r != nullptr) {
+                raw_values.get()[i].Reset();
+                statuses[i] = read_batch_record(_data_cf, raw_keys[i], *r, raw_values.get() + i);
+            }
+        }
+
+        uint32_t epoch_now = utils::epoch_now();
+        _check_values.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const rocksdb::PinnableSlice &raw_value = raw_values.get()[i];
+            ::dsn::apps::cas_check_value &check_value = _check_values[i];
+            check_value.exist = false;
+            check_value.value = ::dsn::blob();
+            if (statuses[i].IsNotFound()) {
+                continue;
+            }
+            if (dsn_unlikely(!statuses[i].ok())) {
+                // read check value failed
+                derror_rocksdb(fmt::format("GetCheckValue for {}", op_name),
+                               statuses[i].ToString(),
+                               "decree: {}, hash_key: {}, check_sort_key: {}",
+                               decree,
+                               utils::c_escape_string(hash_key),
+                               utils::c_escape_string(_check_conditions[i].check_sort_key));
+                return statuses[i].code();
+            }
+            if (check_if_record_expired(
+                    _pegasus_data_version, epoch_now, utils::to_string_view(raw_value))) {
+                // check value ttl timeout
+                _pfc_recent_expire_count->increment();
+                continue;
+            }
+
+            check_value.exist = true;
+            pegasus_extract_user_data(
+                _pegasus_data_version,
+                std::shared_ptr<rocksdb::PinnableSlice>(raw_values, raw_values.get() + i),
+                check_value.value);
+            int err = db_read_separated_value(
+                decree, _raw_keys[i], utils::to_string_view(raw_value), check_value.value);
+            if (err) {
+                return err;
+            }
+        }
+
+        passed = true;
+        invalid_argument = false;
+        for (size_t i = 0; i < count && passed; ++i) {
+            passed = validate_check(decree,
+                                    _check_conditions[i].check_type,
+                                    _check_conditions[i].check_operand,
+                                    _check_values[i].exist,
+                                    _check_values[i].value,
+                                    invalid_argument);
+        }
+        return 0;
+    }
+
+    // Returns `_check_values` of the evaluated conditions in the response of check_and_set or
+    // check_and_mutate.
+    template <typename TResponse>
+    void return_check_values(TResponse &resp)
+    {
+        resp.check_value_returned = true;
+        if (_check_values[0].exist) {
+            resp.check_value_exist = true;
+            resp.check_value = _check_values[0].value;
+        }
+        resp.extra_check_values.assign(_check_values.begin() + 1, _check_values.end());
+    }
+
     // return true if the check type is supported
     static bool is_check_type_supported(::dsn::apps::cas_check_type::type check_type)
     {
@@ -723,19 +1326,9 @@ private:
         case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_POSTFIX: {
             if (!value_exist)
                 return false;
-            if (check_operand.length() == 0)
-                return true;
-            if (value.length() < check_operand.length())
-                return false;
-            if (check_type == ::dsn::apps::cas_check_type::CT_VALUE_MATCH_ANYWHERE) {
-                return dsn::string_view(value).find(check_operand) != dsn::string_view::npos;
-            } else if (check_type == ::dsn::apps::cas_check_type::CT_VALUE_MATCH_PREFIX) {
-                return ::memcmp(value.data(), check_operand.data(), check_operand.length()) == 0;
-            } else { // check_type == ::dsn::apps::cas_check_type::CT_VALUE_MATCH_POSTFIX
-                return ::memcmp(value.data() + value.length() - check_operand.length(),
-                                check_operand.data(),
-                                check_operand.length()) == 0;
-            }
+            return match_pattern(to_pattern_match_type(check_type),
+                                 dsn::string_view(value),
+                                 dsn::string_view(check_operand));
         }
         case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS:
         case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS_OR_EQUAL:
@@ -744,15 +1337,8 @@ private:
         case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_GREATER: {
             if (!value_exist)
                 return false;
-            int c = dsn::string_view(value).compare(dsn::string_view(check_operand));
-            if (c < 0) {
-                return check_type <= ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS_OR_EQUAL;
-            } else if (c == 0) {
-                return check_type >= ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS_OR_EQUAL &&
-                       check_type <= ::dsn::apps::cas_check_type::CT_VALUE_BYTES_GREATER_OR_EQUAL;
-            } else { // c > 0
-                return check_type >= ::dsn::apps::cas_check_type::CT_VALUE_BYTES_GREATER_OR_EQUAL;
-            }
+            return match_compare_result(
+                check_type, dsn::string_view(value).compare(dsn::string_view(check_operand)));
         }
         case ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS:
         case ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS_OR_EQUAL:
@@ -781,14 +1367,9 @@ private:
                 invalid_argument = true;
                 return false;
             }
-            if (check_value_int < check_operand_int) {
-                return check_type <= ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS_OR_EQUAL;
-            } else if (check_value_int == check_operand_int) {
-                return check_type >= ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS_OR_EQUAL &&
-                       check_type <= ::dsn::apps::cas_check_type::CT_VALUE_INT_GREATER_OR_EQUAL;
-            } else { // check_value_int > check_operand_int
-                return check_type >= ::dsn::apps::cas_check_type::CT_VALUE_INT_GREATER_OR_EQUAL;
-            }
+            return match_compare_result(check_type,
+                                        (check_value_int > check_operand_int) -
+                                            (check_value_int < check_operand_int));
         }
         default:
             dassert(false, "unsupported check type: %d", check_type);
@@ -817,17 +1398,48 @@ private:
     const uint32_t _pegasus_data_version;
 
     rocksdb::WriteBatch _batch;
+    // to let the read-modify-write operations read the writes in the same batch
+    write_batch_overlay _batch_overlay;
     rocksdb::DB *_db;
     rocksdb::ColumnFamilyHandle *_data_cf;
     rocksdb::ColumnFamilyHandle *_meta_cf;
+    rocksdb::ColumnFamilyHandle *_blob_cf;
     rocksdb::WriteOptions _wt_opts;
     rocksdb::ReadOptions &_rd_opts;
     volatile uint32_t _default_ttl;
+    volatile bool _blind_incr;
+    // whether the data may contain records with ttl, which is set once such a record is written,
+    // see can_blind_incr()
+    volatile bool _may_contain_ttl_records;
+    volatile uint32_t _value_separation_min_size;
+    // the keys written in current batch, which are invalidated in read cache after committed
+    read_cache *_read_cache;
+    std::vector<std::string> _written_keys;
+    size_t _written_key_count{0};
     ::dsn::perf_counter_wrapper &_pfc_recent_expire_count;
     pegasus_value_generator _value_generator;
+    std::string _merge_operand_buf;
+    // to resolve the blind increments in the batch for the read-modify-write operations
+    pegasus_incr_merge_operator _incr_merge_operator;
+    std::string _blob_key_buf;
+    std::string _reference_buf;
+    // the conditions of check_and_set or check_and_mutate, and their check values
+    std::vector<::dsn::apps::cas_condition> _check_conditions;
+    std::vector<::dsn::apps::cas_check_value> _check_values;
+    // the raw keys of multi_put or multi_remove, composed in `_key_arena`
+    std::string _key_arena;
+    std::vector<dsn::string_view> _raw_keys;
+    size_t _recent_peak_key_arena_size{0};
+    size_t _batch_count_since_shrink_check{0};
+    // count of the allocations of the reused key buffers (`_key_arena`, `_raw_keys` and
+    // `_written_keys`), which is 0 in the steady state. The write batch, the encoded values and
+    // the values read by the read-modify-write operations are not counted.
+    uint64_t _key_buffer_alloc_count{0};
 
     // for setting update_response.error after committed.
     std::vector<dsn::apps::update_response *> _update_responses;
+    // for setting the error of the other responses if the batch failed to commit.
+    std::vector<int32_t *> _batch_errors;
 };
 
 } // namespace server
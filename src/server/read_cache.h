@@ -0,0 +1,172 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <dsn/utility/blob.h>
+#include <dsn/utility/string_view.h>
+#include <dsn/utility/synchronize.h>
+
+#include "base/pegasus_value_schema.h"
+
+namespace pegasus {
+namespace server {
+
+// read_cache is a LRU cache of the decoded user values of a replica, keyed by the raw rocksdb
+// key, which serves the hot keys of `get` without reading and decoding them from rocksdb.
+//
+// The keys written by the write service are invalidated after the write batch is committed.
+// To prevent a concurrent read from filling the cache with the value read before the commit,
+// every invalidation bumps a version, and the value is only filled if the version is not
+// changed since it is read from rocksdb.
+class read_cache
+{
+public:
+    explicit read_cache(uint64_t capacity_in_bytes)
+        : _capacity(capacity_in_bytes), _size(0), _version(0), _default_ttl(0)
+    {
+    }
+
+    // returns true and sets `value` if `raw_key` is cached and not expired.
+    bool get(dsn::string_view raw_key, uint32_t epoch_now, dsn::blob &value)
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        auto iter = _index.find(std::string(raw_key.data(), raw_key.size()));
+        if (iter == _index.end()) {
+            return false;
+        }
+        if (check_if_ts_expired(epoch_now, iter->second->expire_ts)) {
+            erase(iter);
+            return false;
+        }
+        // move to the front as the most recently used
+        _lru.splice(_lru.begin(), _lru, iter->second);
+        value = iter->second->value;
+        return true;
+    }
+
+    // get the version before reading the value from rocksdb, and pass it to put().
+    uint64_t version() const
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        return _version;
+    }
+
+    // puts a copy of `value` into cache if no key is invalidated since `version` was got.
+    // returns the count of the evicted entries.
+    int put(dsn::string_view raw_key,
+            dsn::string_view value,
+            uint32_t expire_ts,
+            uint32_t epoch_now,
+            uint64_t version)
+    {
+        size_t charge = entry_charge(raw_key.size(), value.size());
+        // too large values would flush out the hot ones
+        if (charge > _capacity / 16) {
+            return 0;
+        }
+
+        std::string key(raw_key.data(), raw_key.size());
+        dsn::blob value_copy = dsn::blob::create_from_bytes(value.data(), value.size());
+
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        if (version != _version) {
+            return 0;
+        }
+        if (expire_ts == 0 && _default_ttl > 0) {
+            // the record will be given an expire_ts no earlier than this by the compaction filter
+            expire_ts = epoch_now + _default_ttl;
+        }
+
+        auto iter = _index.find(key);
+        if (iter != _index.end()) {
+            erase(iter);
+        }
+        _lru.push_front(entry{key, std::move(value_copy), expire_ts});
+        _index.emplace(std::move(key), _lru.begin());
+        _size += charge;
+
+        int evicted = 0;
+        while (_size > _capacity) {
+            erase(_index.find(_lru.back().key));
+            evicted++;
+        }
+        return evicted;
+    }
+
+    void invalidate(dsn::string_view raw_key)
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        _version++;
+        auto iter = _index.find(std::string(raw_key.data(), raw_key.size()));
+        if (iter != _index.end()) {
+            erase(iter);
+        }
+    }
+
+    void set_default_ttl(uint32_t ttl)
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        if (_default_ttl != ttl) {
+            _default_ttl = ttl;
+            clear_unlocked();
+        }
+    }
+
+    void clear()
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        clear_unlocked();
+    }
+
+    size_t count() const
+    {
+        ::dsn::utils::auto_lock<::dsn::utils::ex_lock_nr_spin> l(_lock);
+        return _index.size();
+    }
+
+private:
+    struct entry
+    {
+        std::string key;
+        dsn::blob value;
+        uint32_t expire_ts;
+    };
+    typedef std::unordered_map<std::string, std::list<entry>::iterator> index_map;
+
+    // the key is stored twice, in the entry and in the index
+    static size_t entry_charge(size_t key_size, size_t value_size)
+    {
+        return key_size * 2 + value_size + sizeof(entry);
+    }
+
+    void erase(index_map::iterator iter)
+    {
+        _size -= entry_charge(iter->second->key.size(), iter->second->value.length());
+        _lru.erase(iter->second);
+        _index.erase(iter);
+    }
+
+    void clear_unlocked()
+    {
+        _version++;
+        _index.clear();
+        _lru.clear();
+        _size = 0;
+    }
+
+    const uint64_t _capacity;
+    mutable ::dsn::utils::ex_lock_nr_spin _lock;
+    std::list<entry> _lru;
+    index_map _index;
+    uint64_t _size;
+    uint64_t _version;
+    uint32_t _default_ttl;
+};
+
+} // namespace server
+} // namespace pegasus
@@ -0,0 +1,111 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/blob_reference_collector.h"
+
+#include <gtest/gtest.h>
+
+using pegasus::server::BlobReferenceCollector;
+using pegasus::server::blob_reference_stats;
+using pegasus::server::pegasus_value_separation;
+
+namespace {
+
+void add(BlobReferenceCollector &collector,
+         int64_t decree,
+         bool separated,
+         rocksdb::EntryType type = rocksdb::kEntryPut)
+{
+    std::string reference;
+    pegasus_value_separation::generate_reference(decree, reference);
+    uint64_t timetag = pegasus::generate_timetag(1000, 1, false);
+    if (separated) {
+        timetag |= pegasus_value_separation::SEPARATED_TAG;
+    }
+    pegasus::pegasus_value_generator gen;
+    rocksdb::SliceParts parts = gen.generate_value(1, reference, 0, timetag);
+    std::string raw_value;
+    for (int i = 0; i < parts.num_parts; ++i) {
+        raw_value.append(parts.parts[i].data(), parts.parts[i].size());
+    }
+    ASSERT_TRUE(collector.AddUserKey("key", raw_value, type, 0, 0).ok());
+}
+
+blob_reference_stats finish(BlobReferenceCollector &collector)
+{
+    rocksdb::UserCollectedProperties props;
+    EXPECT_TRUE(collector.Finish(&props).ok());
+    blob_reference_stats stats;
+    EXPECT_TRUE(BlobReferenceCollector::parse_properties(props, stats));
+    return stats;
+}
+
+} // anonymous namespace
+
+TEST(BlobReferenceCollectorTest, Count)
+{
+    BlobReferenceCollector collector(1);
+    add(collector, 1, true);
+    add(collector, 2, true);
+    add(collector, 3000, true);
+    // the records which are not separated, and the tombstones or merge operands are ignored
+    add(collector, 4, false);
+    add(collector, 5, true, rocksdb::kEntryDelete);
+    add(collector, 6, true, rocksdb::kEntryMerge);
+
+    blob_reference_stats stats = finish(collector);
+    ASSERT_EQ(BlobReferenceCollector::MIN_BUCKET_BITS, stats.bucket_bits);
+    ASSERT_EQ(2, stats.counts.size());
+    ASSERT_EQ(2, stats.counts[0]);
+    ASSERT_EQ(1, stats.counts[3000 >> stats.bucket_bits]);
+
+    // the whole buckets
+    ASSERT_DOUBLE_EQ(3, stats.count_in(0, 4095));
+    ASSERT_DOUBLE_EQ(2, stats.count_in(0, 1023));
+    // part of a bucket
+    ASSERT_DOUBLE_EQ(1, stats.count_in(0, 511));
+    ASSERT_DOUBLE_EQ(0, stats.count_in(1024, 2047));
+    ASSERT_DOUBLE_EQ(0, stats.count_in(4096, 10000));
+}
+
+TEST(BlobReferenceCollectorTest, WidenBuckets)
+{
+    BlobReferenceCollector collector(1);
+    size_t count = BlobReferenceCollector::MAX_BUCKET_COUNT * 4;
+    for (size_t i = 0; i < count; ++i) {
+        add(collector, static_cast<int64_t>(i << BlobReferenceCollector::MIN_BUCKET_BITS), true);
+    }
+
+    blob_reference_stats stats = finish(collector);
+    ASSERT_LE(stats.counts.size(), BlobReferenceCollector::MAX_BUCKET_COUNT);
+    ASSERT_EQ(BlobReferenceCollector::MIN_BUCKET_BITS + 2, stats.bucket_bits);
+    ASSERT_DOUBLE_EQ(count, stats.count_in(0, UINT64_MAX >> 1));
+}
+
+TEST(BlobReferenceCollectorTest, UnknownDataVersion)
+{
+    // nothing is recorded before the data version is known
+    BlobReferenceCollector collector(0);
+    add(collector, 1, true);
+    rocksdb::UserCollectedProperties props;
+    ASSERT_TRUE(collector.Finish(&props).ok());
+    blob_reference_stats stats;
+    ASSERT_FALSE(BlobReferenceCollector::parse_properties(props, stats));
+}
+
+TEST(BlobReferenceCollectorTest, Malformed)
+{
+    blob_reference_stats stats;
+    ASSERT_TRUE(BlobReferenceCollector::parse_properties(
+        {{BlobReferenceCollector::bucket_bits_property(), "10"},
+         {BlobReferenceCollector::counts_property(), ""}},
+        stats));
+    ASSERT_TRUE(stats.counts.empty());
+    ASSERT_FALSE(BlobReferenceCollector::parse_properties(
+        {{BlobReferenceCollector::bucket_bits_property(), "10"},
+         {BlobReferenceCollector::counts_property(), "1-2"}},
+        stats));
+    ASSERT_FALSE(BlobReferenceCollector::parse_properties(
+        {{BlobReferenceCollector::counts_property(), "1:2"}}, stats));
+}
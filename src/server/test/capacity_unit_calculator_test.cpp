@@ -376,6 +376,13 @@ TEST_F(capacity_unit_calculator_test, check_and_mutate)
     ASSERT_EQ(_cal->write_cu, 0);
     _cal->reset();
 
+    // each extra condition reads one more record
+    _cal->add_check_and_mutate_cu(
+        rocksdb::Status::kTryAgain, hash_key, check_sort_key, mutate_list, 2);
+    ASSERT_EQ(_cal->read_cu, 3);
+    ASSERT_EQ(_cal->write_cu, 0);
+    _cal->reset();
+
     _cal->add_check_and_mutate_cu(
         rocksdb::Status::kCorruption, hash_key, check_sort_key, mutate_list);
     ASSERT_EQ(_cal->read_cu, 0);
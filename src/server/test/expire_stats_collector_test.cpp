@@ -0,0 +1,78 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/expire_stats_collector.h"
+
+#include <gtest/gtest.h>
+
+using pegasus::server::ExpireStatsCollector;
+using pegasus::server::expire_stats;
+
+namespace {
+
+void add(ExpireStatsCollector &collector, uint32_t expire_ts, rocksdb::EntryType type)
+{
+    pegasus::pegasus_value_generator gen;
+    rocksdb::SliceParts parts = gen.generate_value(1, "value", expire_ts, 0);
+    std::string raw_value;
+    for (int i = 0; i < parts.num_parts; ++i) {
+        raw_value.append(parts.parts[i].data(), parts.parts[i].size());
+    }
+    ASSERT_TRUE(collector.AddUserKey("key", raw_value, type, 0, 0).ok());
+}
+
+expire_stats finish(ExpireStatsCollector &collector)
+{
+    rocksdb::UserCollectedProperties props;
+    EXPECT_TRUE(collector.Finish(&props).ok());
+    expire_stats stats;
+    EXPECT_TRUE(ExpireStatsCollector::parse_properties(props, stats));
+    return stats;
+}
+
+} // anonymous namespace
+
+TEST(ExpireStatsCollectorTest, AllWithTTL)
+{
+    ExpireStatsCollector collector;
+    add(collector, 300, rocksdb::kEntryPut);
+    add(collector, 100, rocksdb::kEntryPut);
+    add(collector, 200, rocksdb::kEntryPut);
+
+    expire_stats stats = finish(collector);
+    ASSERT_EQ(100, stats.min_expire_ts);
+    ASSERT_EQ(300, stats.max_expire_ts);
+    ASSERT_EQ(0, stats.no_ttl_count);
+    ASSERT_FALSE(stats.all_expired(299));
+    ASSERT_TRUE(stats.all_expired(300));
+}
+
+TEST(ExpireStatsCollectorTest, NoTTL)
+{
+    ExpireStatsCollector collector;
+    add(collector, 100, rocksdb::kEntryPut);
+    add(collector, 0, rocksdb::kEntryPut);
+    // tombstones and merge operands never expire
+    add(collector, 100, rocksdb::kEntryDelete);
+    add(collector, 100, rocksdb::kEntryMerge);
+
+    expire_stats stats = finish(collector);
+    ASSERT_EQ(100, stats.min_expire_ts);
+    ASSERT_EQ(100, stats.max_expire_ts);
+    ASSERT_EQ(3, stats.no_ttl_count);
+    ASSERT_FALSE(stats.all_expired(1000));
+}
+
+TEST(ExpireStatsCollectorTest, Empty)
+{
+    ExpireStatsCollector collector;
+    expire_stats stats = finish(collector);
+    ASSERT_EQ(0, stats.min_expire_ts);
+    ASSERT_EQ(0, stats.max_expire_ts);
+    ASSERT_EQ(0, stats.no_ttl_count);
+    ASSERT_FALSE(stats.all_expired(1000));
+
+    // the ssts generated without the collector
+    ASSERT_FALSE(ExpireStatsCollector::parse_properties({}, stats));
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/hashkey_stats_collector.h"
+
+#include <gtest/gtest.h>
+
+#include "base/pegasus_key_schema.h"
+
+TEST(HashkeyStatsCollectorTest, Basic)
+{
+    pegasus::server::HashkeyStatsCollector collector(3);
+
+    auto add = [&collector](const std::string &hash_key, int count, rocksdb::EntryType type) {
+        for (int i = 0; i < count; ++i) {
+            dsn::blob key;
+            pegasus::pegasus_generate_key(key, hash_key, "s" + std::to_string(i));
+            ASSERT_TRUE(collector
+                            .AddUserKey(rocksdb::Slice(key.data(), key.size()),
+                                        rocksdb::Slice(),
+                                        type,
+                                        0,
+                                        0)
+                            .ok());
+        }
+    };
+    add("h1", 2, rocksdb::kEntryPut);    // the first one is always recorded
+    add("h2", 2, rocksdb::kEntryPut);    // small hash key
+    add("h3", 3, rocksdb::kEntryPut);    // large hash key
+    add("h4", 5, rocksdb::kEntryDelete); // tombstones are not counted
+    add("h5", 1, rocksdb::kEntryPut);    // the last one is always recorded
+
+    rocksdb::UserCollectedProperties props;
+    ASSERT_TRUE(collector.Finish(&props).ok());
+    ASSERT_EQ(3, props.size());
+
+    using pegasus::server::HashkeyStatsCollector;
+    auto check = [&props](const std::string &hash_key, uint64_t expected) {
+        uint64_t count = 0;
+        ASSERT_TRUE(HashkeyStatsCollector::parse_property(
+            props[HashkeyStatsCollector::property_name(hash_key)], count));
+        ASSERT_EQ(expected, count);
+    };
+    check("h1", 2);
+    ASSERT_EQ(props.end(), props.find(HashkeyStatsCollector::property_name("h2")));
+    check("h3", 3);
+    ASSERT_EQ(props.end(), props.find(HashkeyStatsCollector::property_name("h4")));
+    check("h5", 1);
+
+    ASSERT_EQ("3", collector.GetReadableProperties()["pegasus.large_hashkey_count"]);
+}
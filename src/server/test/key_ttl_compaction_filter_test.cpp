@@ -0,0 +1,104 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/key_ttl_compaction_filter.h"
+
+#include <gtest/gtest.h>
+
+using pegasus::server::ExpireStatsCollector;
+using pegasus::server::KeyWithTTLCompactionFilter;
+using pegasus::server::KeyWithTTLCompactionFilterFactory;
+
+namespace {
+
+const uint32_t data_version = 1;
+
+std::string generate_value(uint32_t expire_ts)
+{
+    pegasus::pegasus_value_generator gen;
+    rocksdb::SliceParts parts = gen.generate_value(data_version, "value", expire_ts, 0);
+    std::string raw_value;
+    for (int i = 0; i < parts.num_parts; ++i) {
+        raw_value.append(parts.parts[i].data(), parts.parts[i].size());
+    }
+    return raw_value;
+}
+
+std::shared_ptr<const rocksdb::TableProperties> sst_with_expire_ts(uint32_t expire_ts)
+{
+    ExpireStatsCollector collector;
+    EXPECT_TRUE(
+        collector.AddUserKey("key", generate_value(expire_ts), rocksdb::kEntryPut, 0, 0).ok());
+    auto props = std::make_shared<rocksdb::TableProperties>();
+    EXPECT_TRUE(collector.Finish(&props->user_collected_properties).ok());
+    return props;
+}
+
+} // anonymous namespace
+
+TEST(KeyWithTTLCompactionFilterTest, Filter)
+{
+    const uint32_t epoch_now = 1000;
+    std::string new_value;
+    bool value_changed = false;
+
+    KeyWithTTLCompactionFilter filter(data_version, 0, epoch_now);
+    ASSERT_TRUE(filter.Filter(0, "key", generate_value(500), &new_value, &value_changed));
+    ASSERT_TRUE(filter.Filter(0, "key", generate_value(epoch_now), &new_value, &value_changed));
+    ASSERT_FALSE(filter.Filter(0, "key", generate_value(2000), &new_value, &value_changed));
+    ASSERT_FALSE(filter.Filter(0, "key", generate_value(0), &new_value, &value_changed));
+    ASSERT_FALSE(value_changed);
+
+    // the default ttl is set to the records without ttl
+    KeyWithTTLCompactionFilter default_ttl_filter(data_version, 100, epoch_now);
+    ASSERT_FALSE(
+        default_ttl_filter.Filter(0, "key", generate_value(0), &new_value, &value_changed));
+    ASSERT_TRUE(value_changed);
+    ASSERT_EQ(epoch_now + 100, pegasus::pegasus_extract_expire_ts(data_version, new_value));
+}
+
+TEST(KeyWithTTLCompactionFilterTest, MayContainTTLRecords)
+{
+    rocksdb::TablePropertiesCollection ssts;
+    // the input ssts are unknown
+    ASSERT_TRUE(KeyWithTTLCompactionFilterFactory::may_contain_ttl_records(ssts));
+
+    ssts.emplace("1.sst", sst_with_expire_ts(0));
+    ASSERT_FALSE(KeyWithTTLCompactionFilterFactory::may_contain_ttl_records(ssts));
+
+    ssts.emplace("2.sst", sst_with_expire_ts(2000));
+    ASSERT_TRUE(KeyWithTTLCompactionFilterFactory::may_contain_ttl_records(ssts));
+
+    // the ssts generated without ExpireStatsCollector
+    ssts.erase("2.sst");
+    ssts.emplace("3.sst", std::make_shared<rocksdb::TableProperties>());
+    ASSERT_TRUE(KeyWithTTLCompactionFilterFactory::may_contain_ttl_records(ssts));
+}
+
+TEST(KeyWithTTLCompactionFilterTest, CreateCompactionFilter)
+{
+    KeyWithTTLCompactionFilterFactory factory;
+    rocksdb::CompactionFilter::Context context;
+    context.is_full_compaction = false;
+    context.is_manual_compaction = false;
+    context.column_family_id = 0;
+    // not enabled until the db is opened
+    ASSERT_EQ(nullptr, factory.CreateCompactionFilter(context));
+
+    factory.SetPegasusDataVersion(data_version);
+    factory.EnableFilter();
+    ASSERT_NE(nullptr, factory.CreateCompactionFilter(context));
+
+    // no record with ttl
+    factory.SetMayContainTTLRecords(false);
+    ASSERT_EQ(nullptr, factory.CreateCompactionFilter(context));
+
+    // the default ttl is set to the records without ttl
+    factory.SetDefaultTTL(100);
+    ASSERT_NE(nullptr, factory.CreateCompactionFilter(context));
+    factory.SetDefaultTTL(0);
+
+    factory.SetMayContainTTLRecords(true);
+    ASSERT_NE(nullptr, factory.CreateCompactionFilter(context));
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/pegasus_incr_merge_operator.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+class incr_merge_operator_test : public ::testing::TestWithParam<uint32_t>
+{
+public:
+    incr_merge_operator_test() { _op.SetPegasusDataVersion(GetParam()); }
+
+    std::string value(dsn::string_view user_data, uint32_t expire_ts, uint64_t timetag = 0)
+    {
+        rocksdb::SliceParts parts = _gen.generate_value(GetParam(), user_data, expire_ts, timetag);
+        std::string raw_value;
+        for (int i = 0; i < parts.num_parts; ++i) {
+            raw_value.append(parts.parts[i].data(), parts.parts[i].size());
+        }
+        return raw_value;
+    }
+
+    void add_operand(int64_t increment,
+                     int32_t expire_ts_seconds = 0,
+                     uint32_t epoch_now = 100,
+                     uint32_t default_expire_ts = 0,
+                     uint64_t timetag = 0)
+    {
+        incr_merge_operand op;
+        op.increment = increment;
+        op.expire_ts_seconds = expire_ts_seconds;
+        op.default_expire_ts = default_expire_ts;
+        op.epoch_now = epoch_now;
+        op.timetag = timetag;
+        std::string buf;
+        op.encode(buf);
+        _operands.emplace_back(std::move(buf));
+    }
+
+    // merges the added operands on `existing_value`, and returns the merged user data.
+    std::string merge(const std::string *existing_value, uint32_t &expire_ts)
+    {
+        rocksdb::Slice existing;
+        if (existing_value != nullptr) {
+            existing = *existing_value;
+        }
+        std::vector<rocksdb::Slice> operand_list(_operands.begin(), _operands.end());
+        rocksdb::MergeOperator::MergeOperationInput merge_in(
+            "key", existing_value != nullptr ? &existing : nullptr, operand_list, nullptr);
+        std::string new_value;
+        rocksdb::Slice existing_operand;
+        rocksdb::MergeOperator::MergeOperationOutput merge_out(new_value, existing_operand);
+        EXPECT_TRUE(_op.FullMergeV2(merge_in, &merge_out));
+        _operands.clear();
+
+        _merged = std::move(new_value);
+        expire_ts = pegasus_extract_expire_ts(GetParam(), _merged);
+        return std::string(pegasus_extract_user_data(GetParam(), _merged));
+    }
+
+protected:
+    pegasus_incr_merge_operator _op;
+    pegasus_value_generator _gen;
+    std::vector<std::string> _operands;
+    std::string _merged;
+};
+
+TEST_P(incr_merge_operator_test, not_exist)
+{
+    uint32_t expire_ts = 0;
+    add_operand(1);
+    add_operand(2);
+    ASSERT_EQ("3", merge(nullptr, expire_ts));
+    ASSERT_EQ(0, expire_ts);
+
+    // set ttl on an absent record
+    add_operand(1, 200);
+    ASSERT_EQ("1", merge(nullptr, expire_ts));
+    ASSERT_EQ(200, expire_ts);
+
+    // the table level default ttl
+    add_operand(1, 0, 100, 300);
+    ASSERT_EQ("1", merge(nullptr, expire_ts));
+    ASSERT_EQ(300, expire_ts);
+}
+
+TEST_P(incr_merge_operator_test, exist)
+{
+    uint32_t expire_ts = 0;
+    std::string existing = value("10", 200);
+    add_operand(5);
+    add_operand(-20);
+    ASSERT_EQ("-5", merge(&existing, expire_ts));
+    ASSERT_EQ(200, expire_ts);
+
+    // clear ttl
+    add_operand(1, -1);
+    ASSERT_EQ("11", merge(&existing, expire_ts));
+    ASSERT_EQ(0, expire_ts);
+
+    // reset ttl
+    add_operand(1, 500);
+    ASSERT_EQ("11", merge(&existing, expire_ts));
+    ASSERT_EQ(500, expire_ts);
+
+    // empty value is taken as 0
+    existing = value("", 0);
+    add_operand(7);
+    ASSERT_EQ("7", merge(&existing, expire_ts));
+}
+
+TEST_P(incr_merge_operator_test, expired)
+{
+    uint32_t expire_ts = 0;
+    std::string existing = value("10", 200);
+    add_operand(1, 0, 150);
+    // expired after the first increment
+    add_operand(1, 0, 250);
+    ASSERT_EQ("1", merge(&existing, expire_ts));
+    ASSERT_EQ(0, expire_ts);
+}
+
+TEST_P(incr_merge_operator_test, skip_invalid_increment)
+{
+    uint32_t expire_ts = 0;
+    std::string existing = value("abc", 0);
+    add_operand(1);
+    ASSERT_EQ("abc", merge(&existing, expire_ts));
+
+    existing = value(std::to_string(INT64_MAX - 1), 0);
+    add_operand(1);
+    add_operand(1); // out of range
+    add_operand(-2);
+    ASSERT_EQ(std::to_string(INT64_MAX - 2), merge(&existing, expire_ts));
+}
+
+TEST_P(incr_merge_operator_test, timetag)
+{
+    if (GetParam() == 0) {
+        return;
+    }
+    uint32_t expire_ts = 0;
+    std::string existing = value("1", 0, 1000);
+    add_operand(1, 0, 100, 0, 2000);
+    merge(&existing, expire_ts);
+    ASSERT_EQ(2000, pegasus_extract_timetag(GetParam(), _merged));
+}
+
+TEST_P(incr_merge_operator_test, corrupted_operand)
+{
+    std::vector<rocksdb::Slice> operand_list{"abc"};
+    rocksdb::MergeOperator::MergeOperationInput merge_in("key", nullptr, operand_list, nullptr);
+    std::string new_value;
+    rocksdb::Slice existing_operand;
+    rocksdb::MergeOperator::MergeOperationOutput merge_out(new_value, existing_operand);
+    ASSERT_FALSE(_op.FullMergeV2(merge_in, &merge_out));
+}
+
+INSTANTIATE_TEST_CASE_P(, incr_merge_operator_test, ::testing::Values(0, 1));
+
+} // namespace server
+} // namespace pegasus
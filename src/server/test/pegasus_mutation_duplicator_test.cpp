@@ -237,6 +237,23 @@ TEST_F(pegasus_mutation_duplicator_test, get_hash_from_request)
         ASSERT_EQ(hash, get_hash_from_request(dsn::apps::RPC_RRDB_RRDB_MULTI_REMOVE, data));
     }
 
+    {
+        dsn::apps::delete_range_request request;
+        request.hash_key.assign(hash_key.data(), 0, hash_key.length());
+        dsn::message_ptr msg = dsn::from_thrift_request_to_received_message(
+            request, dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE);
+        auto data = dsn::move_message_to_blob(msg.get());
+        ASSERT_EQ(hash, get_hash_from_request(dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE, data));
+
+        // clearing a partition is routed by the partition index
+        request.clear_partition = true;
+        request.partition_index = 3;
+        msg = dsn::from_thrift_request_to_received_message(
+            request, dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE);
+        data = dsn::move_message_to_blob(msg.get());
+        ASSERT_EQ(3, get_hash_from_request(dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE, data));
+    }
+
     {
         dsn::apps::update_request request;
         pegasus::pegasus_generate_key(request.key, hash_key, sort_key);
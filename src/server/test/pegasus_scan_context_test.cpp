@@ -0,0 +1,85 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/pegasus_scan_context.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+static std::unique_ptr<pegasus_scan_context> create_test_context()
+{
+    return dsn::make_unique<pegasus_scan_context>(std::unique_ptr<rocksdb::Iterator>(),
+                                                  std::string("stop"),
+                                                  false,
+                                                  ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                  std::string(),
+                                                  ::dsn::apps::filter_type::FT_NO_FILTER,
+                                                  std::string(),
+                                                  100,
+                                                  false);
+}
+
+TEST(pegasus_context_cache, put_and_fetch)
+{
+    pegasus_context_cache cache;
+    std::vector<int64_t> handles;
+    for (int i = 0; i < 100; i++) {
+        handles.push_back(cache.put(create_test_context()));
+    }
+    for (int64_t handle : handles) {
+        ASSERT_GE(handle, SCAN_CONTEXT_ID_VALID_MIN);
+        ASSERT_NE(nullptr, cache.fetch(handle));
+        // the context is removed after fetched
+        ASSERT_EQ(nullptr, cache.fetch(handle));
+    }
+
+    int64_t handle = cache.alloc_handle();
+    ASSERT_EQ(nullptr, cache.fetch(handle));
+    cache.put(handle, create_test_context());
+    ASSERT_NE(nullptr, cache.fetch(handle));
+}
+
+TEST(pegasus_context_cache, remove_expired)
+{
+    pegasus_context_cache cache;
+    for (int i = 0; i < 10; i++) {
+        cache.put(create_test_context());
+    }
+    ASSERT_EQ(0, cache.remove_expired(1000 * 1000));
+    ASSERT_EQ(10, cache.remove_expired(0));
+    ASSERT_EQ(0, cache.remove_expired(0));
+
+    int64_t handle = cache.put(create_test_context());
+    cache.clear();
+    ASSERT_EQ(nullptr, cache.fetch(handle));
+}
+
+TEST(pegasus_context_cache, recycle_buffer)
+{
+    pegasus_context_cache cache;
+    int64_t handle = cache.put(create_test_context());
+
+    std::vector<::dsn::apps::key_value> buffer;
+    buffer.reserve(10);
+    cache.recycle_buffer(handle, buffer);
+    ASSERT_EQ(0, buffer.capacity());
+
+    // a smaller buffer doesn't replace the recycled one
+    buffer.reserve(5);
+    cache.recycle_buffer(handle, buffer);
+    ASSERT_EQ(5, buffer.capacity());
+
+    std::unique_ptr<pegasus_scan_context> context = cache.fetch(handle);
+    ASSERT_NE(nullptr, context);
+    ASSERT_EQ(10, context->kvs_buffer.capacity());
+
+    // the buffer is kept by the caller if the context is not in the cache
+    cache.recycle_buffer(handle, buffer);
+    ASSERT_EQ(5, buffer.capacity());
+}
+
+} // namespace server
+} // namespace pegasus
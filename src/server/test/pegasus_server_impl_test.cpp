@@ -2,6 +2,7 @@
 // This source code is licensed under the Apache License Version 2.0, which
 // can be found in the LICENSE file in the root directory of this source tree.
 
+#include <algorithm>
 #include <base/pegasus_key_schema.h>
 #include "pegasus_server_test_base.h"
 
@@ -64,5 +65,46 @@ TEST_F(pegasus_server_impl_test, default_data_version)
     ASSERT_EQ(_server->_pegasus_data_version, 1);
 }
 
+TEST_F(pegasus_server_impl_test, calc_split_keys)
+{
+    std::vector<std::string> split_keys;
+    _server->calc_split_keys(4, split_keys);
+    ASSERT_TRUE(split_keys.empty());
+
+    // flush the records into several ssts
+    const int sst_count = 8;
+    for (int i = 0; i < sst_count; ++i) {
+        for (int j = 0; j < 100; ++j) {
+            dsn::blob key;
+            pegasus_generate_key(key,
+                                 "hash_key_" + std::to_string(i),
+                                 "sort_key_" + std::to_string(1000 + j));
+            ASSERT_TRUE(_server->_db
+                            ->Put(rocksdb::WriteOptions(),
+                                  _server->_data_cf,
+                                  rocksdb::Slice(key.data(), key.length()),
+                                  std::string(1000, 'v'))
+                            .ok());
+        }
+        ASSERT_TRUE(_server->_db->Flush(rocksdb::FlushOptions(), _server->_data_cf).ok());
+    }
+
+    _server->calc_split_keys(1, split_keys);
+    ASSERT_TRUE(split_keys.empty());
+
+    _server->calc_split_keys(4, split_keys);
+    ASSERT_FALSE(split_keys.empty());
+    ASSERT_LE(split_keys.size(), 3);
+    ASSERT_TRUE(std::is_sorted(split_keys.begin(), split_keys.end()));
+    ASSERT_EQ(split_keys.end(), std::adjacent_find(split_keys.begin(), split_keys.end()));
+
+    // the split count is clamped to the configured maximum
+    ASSERT_EQ(1024, _server->_get_split_keys_max_split_count);
+    _server->_get_split_keys_max_split_count = 2;
+    _server->calc_split_keys(4, split_keys);
+    ASSERT_LE(split_keys.size(), 1);
+    _server->_get_split_keys_max_split_count = 1024;
+}
+
 } // namespace server
 } // namespace pegasus
@@ -10,6 +10,7 @@
 
 #include <dsn/utility/fail_point.h>
 #include <dsn/utility/defer.h>
+#include <set>
 
 namespace pegasus {
 namespace server {
@@ -89,6 +90,172 @@ public:
         dsn::fail::teardown();
     }
 
+    void test_read_your_writes_in_batch()
+    {
+        RPC_MOCKING(put_rpc) RPC_MOCKING(incr_rpc) RPC_MOCKING(check_and_set_rpc)
+        {
+            dsn::blob key;
+            pegasus_generate_key(key, std::string("hash"), std::string("counter"));
+            dsn::apps::update_request put_req;
+            put_req.key = key;
+            put_req.value.assign("10", 0, 2);
+            dsn::apps::incr_request incr_req;
+            incr_req.key = key;
+            incr_req.increment = 5;
+            dsn::apps::check_and_set_request cas_req;
+            cas_req.hash_key.assign("hash", 0, 4);
+            cas_req.check_sort_key.assign("counter", 0, 7);
+            cas_req.check_type = dsn::apps::cas_check_type::CT_VALUE_INT_EQUAL;
+            cas_req.check_operand.assign("20", 0, 2);
+            cas_req.set_value.assign("100", 0, 3);
+
+            // the incrs and the check_and_set see the writes before them in the same batch
+            dsn::message_ex *writes[] = {pegasus::create_put_request(put_req),
+                                         pegasus::create_incr_request(incr_req),
+                                         pegasus::create_incr_request(incr_req),
+                                         pegasus::create_check_and_set_request(cas_req)};
+            int err = _server_write->on_batched_write_requests(writes, 4, 1, 0);
+            ASSERT_EQ(0, err);
+            ASSERT_EQ(_server_write->_write_svc->_impl->_batch.Count(), 0);
+            ASSERT_TRUE(_server_write->_incr_rpc_batch.empty());
+            ASSERT_TRUE(_server_write->_check_and_set_rpc_batch.empty());
+
+            ASSERT_EQ(incr_rpc::mail_box().size(), 2);
+            std::set<int64_t> new_values;
+            for (auto &rpc : incr_rpc::mail_box()) {
+                ASSERT_EQ(0, rpc.response().error);
+                new_values.insert(rpc.response().new_value);
+            }
+            ASSERT_EQ(std::set<int64_t>({15, 20}), new_values);
+            ASSERT_EQ(check_and_set_rpc::mail_box().size(), 1);
+            ASSERT_EQ(0, check_and_set_rpc::mail_box()[0].response().error);
+
+            auto &impl = _server_write->_write_svc->_impl;
+            std::string raw_value;
+            ASSERT_TRUE(
+                impl->_db->Get(rocksdb::ReadOptions(), utils::to_rocksdb_slice(key), &raw_value)
+                    .ok());
+            dsn::blob value;
+            pegasus_extract_user_data(impl->_pegasus_data_version, std::move(raw_value), value);
+            ASSERT_EQ("100", value.to_string());
+        }
+    }
+
+    void test_blind_incr_in_batch()
+    {
+        RPC_MOCKING(put_rpc) RPC_MOCKING(incr_rpc) RPC_MOCKING(check_and_set_rpc)
+        {
+            _server_write->set_blind_incr(true);
+            _server_write->set_may_contain_ttl_records(false);
+
+            dsn::blob key;
+            pegasus_generate_key(key, std::string("hash"), std::string("counter"));
+            dsn::apps::update_request put_req;
+            put_req.key = key;
+            put_req.value.assign("10", 0, 2);
+            dsn::apps::incr_request incr_req;
+            incr_req.key = key;
+            incr_req.increment = 5;
+            dsn::apps::check_and_set_request cas_req;
+            cas_req.hash_key.assign("hash", 0, 4);
+            cas_req.check_sort_key.assign("counter", 0, 7);
+            cas_req.check_type = dsn::apps::cas_check_type::CT_VALUE_INT_EQUAL;
+            cas_req.check_operand.assign("20", 0, 2);
+            cas_req.set_value.assign("100", 0, 3);
+            cas_req.return_check_value = true;
+
+            // the check_and_set sees the blind increments before it in the same batch, which are
+            // merge operands in the batch
+            dsn::message_ex *writes[] = {pegasus::create_put_request(put_req),
+                                         pegasus::create_incr_request(incr_req),
+                                         pegasus::create_incr_request(incr_req),
+                                         pegasus::create_check_and_set_request(cas_req)};
+            int err = _server_write->on_batched_write_requests(writes, 4, 1, 0);
+            ASSERT_EQ(0, err);
+            ASSERT_EQ(_server_write->_write_svc->_impl->_batch.Count(), 0);
+
+            ASSERT_EQ(incr_rpc::mail_box().size(), 2);
+            for (auto &rpc : incr_rpc::mail_box()) {
+                ASSERT_EQ(0, rpc.response().error);
+            }
+            ASSERT_EQ(check_and_set_rpc::mail_box().size(), 1);
+            const auto &cas_resp = check_and_set_rpc::mail_box()[0].response();
+            ASSERT_EQ(0, cas_resp.error);
+            ASSERT_TRUE(cas_resp.check_value_exist);
+            ASSERT_EQ("20", cas_resp.check_value.to_string());
+
+            auto &impl = _server_write->_write_svc->_impl;
+            std::string raw_value;
+            ASSERT_TRUE(
+                impl->_db->Get(rocksdb::ReadOptions(), utils::to_rocksdb_slice(key), &raw_value)
+                    .ok());
+            dsn::blob value;
+            pegasus_extract_user_data(impl->_pegasus_data_version, std::move(raw_value), value);
+            ASSERT_EQ("100", value.to_string());
+
+            // once a record with ttl is written, the increments read the old value instead
+            incr_rpc::mail_box().clear();
+            put_req.expire_ts_seconds = utils::epoch_now() + 1000;
+            dsn::message_ex *ttl_writes[] = {pegasus::create_put_request(put_req),
+                                             pegasus::create_incr_request(incr_req)};
+            err = _server_write->on_batched_write_requests(ttl_writes, 2, 2, 0);
+            ASSERT_EQ(0, err);
+            ASSERT_EQ(incr_rpc::mail_box().size(), 1);
+            ASSERT_EQ(0, incr_rpc::mail_box()[0].response().error);
+            ASSERT_EQ(15, incr_rpc::mail_box()[0].response().new_value);
+
+            _server_write->set_blind_incr(false);
+        }
+    }
+
+    void test_check_and_set_v2()
+    {
+        RPC_MOCKING(put_rpc) RPC_MOCKING(check_and_set_rpc)
+        {
+            dsn::blob key1, key2;
+            pegasus_generate_key(key1, std::string("hash"), std::string("k1"));
+            pegasus_generate_key(key2, std::string("hash"), std::string("k2"));
+            dsn::apps::update_request put_req1, put_req2;
+            put_req1.key = key1;
+            put_req1.value.assign("1", 0, 1);
+            put_req2.key = key2;
+            put_req2.value.assign("2", 0, 1);
+            dsn::apps::check_and_set_request cas_req;
+            cas_req.hash_key.assign("hash", 0, 4);
+            cas_req.check_sort_key.assign("k1", 0, 2);
+            cas_req.check_type = dsn::apps::cas_check_type::CT_VALUE_BYTES_EQUAL;
+            cas_req.check_operand.assign("1", 0, 1);
+            cas_req.set_value.assign("3", 0, 1);
+            dsn::apps::cas_condition cond;
+            cond.check_sort_key.assign("k2", 0, 2);
+            cond.check_type = dsn::apps::cas_check_type::CT_VALUE_BYTES_EQUAL;
+            cond.check_operand.assign("2", 0, 1);
+            cas_req.extra_conditions.push_back(cond);
+
+            // the request with extra conditions is sent by the v2 code, which is handled the
+            // same as check_and_set
+            dsn::message_ex *writes[] = {
+                pegasus::create_put_request(put_req1),
+                pegasus::create_put_request(put_req2),
+                pegasus::create_check_and_set_request(cas_req,
+                                                      dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET_V2)};
+            int err = _server_write->on_batched_write_requests(writes, 3, 1, 0);
+            ASSERT_EQ(0, err);
+            ASSERT_TRUE(_server_write->_check_and_set_rpc_batch.empty());
+            ASSERT_EQ(check_and_set_rpc::mail_box().size(), 1);
+            ASSERT_EQ(0, check_and_set_rpc::mail_box()[0].response().error);
+
+            auto &impl = _server_write->_write_svc->_impl;
+            std::string raw_value;
+            ASSERT_TRUE(
+                impl->_db->Get(rocksdb::ReadOptions(), utils::to_rocksdb_slice(key1), &raw_value)
+                    .ok());
+            dsn::blob value;
+            pegasus_extract_user_data(impl->_pegasus_data_version, std::move(raw_value), value);
+            ASSERT_EQ("3", value.to_string());
+        }
+    }
+
     void verify_response(const dsn::apps::update_response &response, int err, int64_t decree)
     {
         ASSERT_EQ(response.error, err);
@@ -101,5 +268,11 @@ public:
 
 TEST_F(pegasus_server_write_test, batch_writes) { test_batch_writes(); }
 
+TEST_F(pegasus_server_write_test, read_your_writes_in_batch) { test_read_your_writes_in_batch(); }
+
+TEST_F(pegasus_server_write_test, blind_incr_in_batch) { test_blind_incr_in_batch(); }
+
+TEST_F(pegasus_server_write_test, check_and_set_v2) { test_check_and_set_v2(); }
+
 } // namespace server
 } // namespace pegasus
@@ -0,0 +1,86 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/pegasus_value_separation.h"
+
+#include <gtest/gtest.h>
+
+namespace pegasus {
+namespace server {
+
+TEST(pegasus_value_separation, reference)
+{
+    for (int64_t decree : std::vector<int64_t>{0, 1, 12345678, INT64_MAX}) {
+        std::string reference;
+        pegasus_value_separation::generate_reference(decree, reference);
+        ASSERT_EQ(pegasus_value_separation::REFERENCE_LENGTH, reference.size());
+
+        int64_t extracted = -1;
+        ASSERT_TRUE(pegasus_value_separation::extract_reference(reference, extracted));
+        ASSERT_EQ(decree, extracted);
+    }
+
+    int64_t decree = 0;
+    ASSERT_FALSE(pegasus_value_separation::extract_reference("", decree));
+    std::string reference;
+    pegasus_value_separation::generate_reference(1, reference);
+    ASSERT_FALSE(pegasus_value_separation::extract_reference(reference + "x", decree));
+}
+
+TEST(pegasus_value_separation, is_separated)
+{
+    std::string reference;
+    pegasus_value_separation::generate_reference(1, reference);
+    uint64_t timetag = generate_timetag(1000, 1, false);
+
+    pegasus_value_generator gen;
+    auto to_string = [](const rocksdb::SliceParts &parts) {
+        std::string value;
+        for (int i = 0; i < parts.num_parts; ++i) {
+            value.append(parts.parts[i].data(), parts.parts[i].size());
+        }
+        return value;
+    };
+    std::string raw_value = to_string(gen.generate_value(
+        1, reference, 0, timetag | pegasus_value_separation::SEPARATED_TAG));
+    ASSERT_TRUE(pegasus_value_separation::is_separated(1, raw_value));
+
+    // the record which is not tagged is never separated, even if it's like a reference
+    raw_value = to_string(gen.generate_value(1, reference, 0, timetag));
+    ASSERT_FALSE(pegasus_value_separation::is_separated(1, raw_value));
+
+    // data version 0 has no timetag
+    raw_value = to_string(gen.generate_value(0, reference, 0, 0));
+    ASSERT_FALSE(pegasus_value_separation::is_separated(0, raw_value));
+}
+
+TEST(pegasus_value_separation, blob_key)
+{
+    for (const std::string &raw_key : {std::string(), std::string("\x00\x02hksk", 6)}) {
+        std::string blob_key;
+        pegasus_value_separation::generate_blob_key(raw_key, 100, blob_key);
+        ASSERT_EQ(raw_key.size() + sizeof(uint64_t), blob_key.size());
+
+        dsn::string_view restored_key;
+        int64_t decree = 0;
+        ASSERT_TRUE(pegasus_value_separation::restore_blob_key(blob_key, restored_key, decree));
+        ASSERT_EQ(raw_key, std::string(restored_key.data(), restored_key.size()));
+        ASSERT_EQ(100, decree);
+    }
+
+    // the blob keys are ordered by decree, so the blobs flushed later are in a later range
+    std::string k1, k2, k3;
+    pegasus_value_separation::generate_blob_key("key", 9, k1);
+    pegasus_value_separation::generate_blob_key("key", 256, k2);
+    pegasus_value_separation::generate_blob_key("a", 257, k3);
+    ASSERT_LT(k1, k2);
+    ASSERT_LT(k2, k3);
+
+    dsn::string_view raw_key;
+    int64_t decree = 0;
+    ASSERT_FALSE(pegasus_value_separation::restore_blob_key("short", raw_key, decree));
+}
+
+} // namespace server
+} // namespace pegasus
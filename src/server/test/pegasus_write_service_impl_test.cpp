@@ -8,6 +8,7 @@
 #include "message_utils.h"
 
 #include <dsn/utility/defer.h>
+#include <rocksdb/sst_file_writer.h>
 
 namespace pegasus {
 namespace server {
@@ -52,6 +53,28 @@ public:
 
         SetUp();
     }
+
+    void put_sort_keys(const std::string &hash_key, int count, int64_t decree)
+    {
+        for (int i = 0; i < count; i++) {
+            std::string sort_key = "sort_key_" + std::to_string(i);
+            dsn::blob raw_key;
+            pegasus_generate_key(raw_key, hash_key, sort_key);
+            ASSERT_EQ(0, _write_impl->db_write_batch_put(decree, raw_key, "value", 0));
+        }
+        ASSERT_EQ(0, _write_impl->db_write(decree));
+        _write_impl->clear_up_batch_states(decree, 0);
+    }
+
+    bool exist(const std::string &hash_key, int i)
+    {
+        dsn::blob raw_key;
+        pegasus_generate_key(raw_key, hash_key, "sort_key_" + std::to_string(i));
+        std::string raw_value;
+        rocksdb::Status s = _write_impl->_db->Get(
+            _write_impl->_rd_opts, utils::to_rocksdb_slice(raw_key), &raw_value);
+        return s.ok();
+    }
 };
 
 TEST_F(pegasus_write_service_impl_test, put_verify_timetag)
@@ -140,5 +163,291 @@ TEST_F(pegasus_write_service_impl_test, verify_timetag_compatible_with_version_0
     dsn::fail::teardown();
 }
 
+TEST_F(pegasus_write_service_impl_test, delete_range)
+{
+    int64_t decree = 10;
+    put_sort_keys("h1", 8, decree++);
+    put_sort_keys("h2", 8, decree++);
+
+    std::string hash_key = "h1", start = "sort_key_2", stop = "sort_key_5";
+    dsn::apps::delete_range_request request;
+    dsn::apps::update_response response;
+    request.hash_key = dsn::blob(hash_key.data(), 0, hash_key.size());
+    request.start_sort_key = dsn::blob(start.data(), 0, start.size());
+    request.start_inclusive = false;
+    request.stop_sort_key = dsn::blob(stop.data(), 0, stop.size());
+    request.stop_inclusive = true;
+    ASSERT_EQ(0, _write_impl->delete_range(decree++, request, response));
+    ASSERT_EQ(0, response.error);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(i < 3 || i > 5, exist("h1", i)) << i;
+        ASSERT_TRUE(exist("h2", i)) << i;
+    }
+
+    // to the end of the hash key
+    request.stop_sort_key = dsn::blob();
+    ASSERT_EQ(0, _write_impl->delete_range(decree++, request, response));
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(i < 3, exist("h1", i)) << i;
+    }
+
+    // empty range
+    request.start_sort_key = dsn::blob(stop.data(), 0, stop.size());
+    request.stop_sort_key = dsn::blob(start.data(), 0, start.size());
+    ASSERT_EQ(0, _write_impl->delete_range(decree++, request, response));
+    ASSERT_EQ(0, response.error);
+
+    // the partition index mismatches
+    request.clear_partition = true;
+    request.partition_index = _gpid.get_partition_index() + 1;
+    ASSERT_EQ(0, _write_impl->delete_range(decree++, request, response));
+    ASSERT_EQ(rocksdb::Status::kInvalidArgument, response.error);
+    ASSERT_TRUE(exist("h2", 0));
+
+    request.partition_index = _gpid.get_partition_index();
+    ASSERT_EQ(0, _write_impl->delete_range(decree, request, response));
+    ASSERT_EQ(0, response.error);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_FALSE(exist("h1", i)) << i;
+        ASSERT_FALSE(exist("h2", i)) << i;
+    }
+}
+
+TEST_F(pegasus_write_service_impl_test, ingest)
+{
+    const std::string dir = "./ingest_test";
+    dsn::utils::filesystem::remove_path(dir);
+    int pidx = _gpid.get_partition_index();
+    ASSERT_TRUE(dsn::utils::filesystem::create_directory(bulk_load_info::partition_dir(dir, pidx)));
+    auto defer = dsn::defer([&dir]() { dsn::utils::filesystem::remove_path(dir); });
+
+    // file 0: sort_key_[0, 3) = "v0", file 1: sort_key_[3, 6) = "v1"
+    pegasus_value_generator gen;
+    for (int f = 0; f < 2; f++) {
+        rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), rocksdb::Options());
+        ASSERT_TRUE(writer.Open(bulk_load_info::sst_file(dir, pidx, f)).ok());
+        for (int i = f * 3; i < f * 3 + 3; i++) {
+            dsn::blob raw_key;
+            pegasus_generate_key(raw_key, std::string("h1"), "sort_key_" + std::to_string(i));
+            std::string user_data = "v" + std::to_string(f), raw_value;
+            rocksdb::SliceParts parts =
+                gen.generate_value(_write_impl->_pegasus_data_version, user_data, 0, 0);
+            for (int j = 0; j < parts.num_parts; j++) {
+                raw_value.append(parts.parts[j].data(), parts.parts[j].size());
+            }
+            ASSERT_TRUE(writer.Put(utils::to_rocksdb_slice(raw_key), raw_value).ok());
+        }
+        ASSERT_TRUE(writer.Finish().ok());
+    }
+
+    int64_t decree = 10;
+    dsn::apps::ingest_request request;
+    dsn::apps::update_response response;
+    request.dir = dir;
+    request.partition_index = pidx;
+
+    // no bulk load info, the write fails rather than skipping the data
+    ASSERT_EQ(rocksdb::Status::kIOError, _write_impl->ingest(decree++, request, response));
+    ASSERT_EQ(rocksdb::Status::kIOError, response.error);
+
+    bulk_load_info info;
+    info.partition_count = 8;
+    info.data_version = _write_impl->_pegasus_data_version + 1;
+    ASSERT_TRUE(info.save(dir));
+    ASSERT_EQ(0, _write_impl->ingest(decree++, request, response));
+    ASSERT_EQ(rocksdb::Status::kInvalidArgument, response.error);
+
+    info.data_version = _write_impl->_pegasus_data_version;
+    ASSERT_TRUE(info.save(dir));
+    request.partition_index = pidx + 1;
+    ASSERT_EQ(0, _write_impl->ingest(decree++, request, response));
+    ASSERT_EQ(rocksdb::Status::kInvalidArgument, response.error);
+    ASSERT_FALSE(exist("h1", 0));
+
+    request.partition_index = pidx;
+    ASSERT_EQ(0, _write_impl->ingest(decree, request, response));
+    ASSERT_EQ(0, response.error);
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(i < 6, exist("h1", i)) << i;
+    }
+    for (int i = 0; i < 6; i++) {
+        dsn::blob raw_key;
+        pegasus_generate_key(raw_key, std::string("h1"), "sort_key_" + std::to_string(i));
+        std::string raw_value;
+        ASSERT_TRUE(_write_impl->_db
+                        ->Get(_write_impl->_rd_opts, utils::to_rocksdb_slice(raw_key), &raw_value)
+                        .ok());
+        dsn::string_view user_data =
+            pegasus_extract_user_data(_write_impl->_pegasus_data_version, raw_value);
+        ASSERT_EQ(i < 3 ? "v0" : "v1", std::string(user_data.data(), user_data.size())) << i;
+    }
+}
+
+TEST_F(pegasus_write_service_impl_test, value_separation)
+{
+    _write_impl->set_value_separation_min_size(64);
+    const std::string large_value(100, 'x');
+    dsn::blob large_key, small_key;
+    pegasus_generate_key(large_key, std::string("h1"), std::string("large"));
+    pegasus_generate_key(small_key, std::string("h1"), std::string("small"));
+
+    int64_t decree = 10;
+    ASSERT_EQ(0, _write_impl->db_write_batch_put(decree, large_key, large_value, 0));
+    ASSERT_EQ(0, _write_impl->db_write_batch_put(decree, small_key, "value", 0));
+    ASSERT_EQ(0, _write_impl->db_write(decree));
+    _write_impl->clear_up_batch_states(decree, 0);
+
+    // the data column family keeps the reference of the large value only
+    std::string raw_value;
+    ASSERT_TRUE(_write_impl->_db
+                    ->Get(_write_impl->_rd_opts, utils::to_rocksdb_slice(large_key), &raw_value)
+                    .ok());
+    ASSERT_TRUE(
+        pegasus_value_separation::is_separated(_write_impl->_pegasus_data_version, raw_value));
+    dsn::string_view user_data =
+        pegasus_extract_user_data(_write_impl->_pegasus_data_version, raw_value);
+    int64_t referred_decree = 0;
+    ASSERT_TRUE(pegasus_value_separation::extract_reference(user_data, referred_decree));
+    ASSERT_EQ(decree, referred_decree);
+
+    std::string blob_key, blob_value;
+    pegasus_value_separation::generate_blob_key(large_key.to_string(), decree, blob_key);
+    ASSERT_TRUE(_write_impl->_db
+                    ->Get(_write_impl->_rd_opts, _write_impl->_blob_cf, blob_key, &blob_value)
+                    .ok());
+    ASSERT_EQ(large_value, blob_value);
+
+    dsn::blob value = dsn::blob::create_from_bytes(user_data.data(), user_data.length());
+    ASSERT_EQ(0,
+              _write_impl->db_read_separated_value(
+                  decree, large_key.to_string(), raw_value, value));
+    ASSERT_EQ(large_value, value.to_string());
+
+    // the separated record without blob is corrupted
+    ASSERT_TRUE(_write_impl->_db
+                    ->Delete(rocksdb::WriteOptions(), _write_impl->_blob_cf, blob_key)
+                    .ok());
+    value = dsn::blob::create_from_bytes(user_data.data(), user_data.length());
+    ASSERT_EQ(rocksdb::Status::kCorruption,
+              _write_impl->db_read_separated_value(
+                  decree, large_key.to_string(), raw_value, value));
+
+    ASSERT_TRUE(_write_impl->_db
+                    ->Get(_write_impl->_rd_opts, utils::to_rocksdb_slice(small_key), &raw_value)
+                    .ok());
+    ASSERT_FALSE(
+        pegasus_value_separation::is_separated(_write_impl->_pegasus_data_version, raw_value));
+    user_data = pegasus_extract_user_data(_write_impl->_pegasus_data_version, raw_value);
+    ASSERT_EQ("value", std::string(user_data.data(), user_data.size()));
+
+    // no separation
+    _write_impl->set_value_separation_min_size(0);
+    decree++;
+    ASSERT_EQ(0, _write_impl->db_write_batch_put(decree, large_key, large_value, 0));
+    ASSERT_EQ(0, _write_impl->db_write(decree));
+    _write_impl->clear_up_batch_states(decree, 0);
+    ASSERT_TRUE(_write_impl->_db
+                    ->Get(_write_impl->_rd_opts, utils::to_rocksdb_slice(large_key), &raw_value)
+                    .ok());
+    user_data = pegasus_extract_user_data(_write_impl->_pegasus_data_version, raw_value);
+    ASSERT_EQ(large_value, std::string(user_data.data(), user_data.size()));
+}
+
+TEST_F(pegasus_write_service_impl_test, composite_raw_keys)
+{
+    std::vector<dsn::blob> sort_keys;
+    for (int i = 0; i < 10; i++) {
+        sort_keys.emplace_back(dsn::blob::create_from_bytes("sort_key_" + std::to_string(i)));
+    }
+    sort_keys.emplace_back();
+    auto sort_key_of = [](const dsn::blob &sort_key) {
+        return dsn::string_view(sort_key.data(), sort_key.length());
+    };
+
+    _write_impl->reset_key_buffer_alloc_count();
+    _write_impl->composite_raw_keys("hash_key", sort_keys, sort_key_of);
+    ASSERT_LT(0, _write_impl->reset_key_buffer_alloc_count());
+    ASSERT_EQ(sort_keys.size(), _write_impl->_raw_keys.size());
+    for (size_t i = 0; i < sort_keys.size(); i++) {
+        dsn::blob raw_key;
+        pegasus_generate_key(raw_key, dsn::blob::create_from_bytes("hash_key"), sort_keys[i]);
+        ASSERT_EQ(raw_key.to_string(),
+                  std::string(_write_impl->_raw_keys[i].data(), _write_impl->_raw_keys[i].size()))
+            << i;
+    }
+
+    // the buffers are reused by the smaller requests
+    sort_keys.resize(5);
+    _write_impl->composite_raw_keys("hash_key", sort_keys, sort_key_of);
+    ASSERT_EQ(0, _write_impl->reset_key_buffer_alloc_count());
+    ASSERT_EQ(sort_keys.size(), _write_impl->_raw_keys.size());
+}
+
+TEST_F(pegasus_write_service_impl_test, check_and_mutate_with_extra_conditions)
+{
+    const std::string hash_key = "hash_key";
+    int64_t decree = 10;
+    put_sort_keys(hash_key, 2, decree);
+
+    auto condition = [](const std::string &sort_key,
+                        dsn::apps::cas_check_type::type check_type,
+                        const std::string &operand) {
+        dsn::apps::cas_condition cond;
+        cond.check_sort_key = dsn::blob::create_from_bytes(std::string(sort_key));
+        cond.check_type = check_type;
+        cond.check_operand = dsn::blob::create_from_bytes(std::string(operand));
+        return cond;
+    };
+
+    dsn::apps::check_and_mutate_request req;
+    req.hash_key = dsn::blob::create_from_bytes(std::string(hash_key));
+    req.check_sort_key = dsn::blob::create_from_bytes("sort_key_0");
+    req.check_type = dsn::apps::cas_check_type::CT_VALUE_EXIST;
+    req.mutate_list.resize(1);
+    req.mutate_list[0].operation = dsn::apps::mutate_operation::MO_PUT;
+    req.mutate_list[0].sort_key = dsn::blob::create_from_bytes("sort_key_3");
+    req.mutate_list[0].value = dsn::blob::create_from_bytes("value");
+    req.return_check_value = true;
+    req.extra_conditions.emplace_back(
+        condition("sort_key_1", dsn::apps::cas_check_type::CT_VALUE_BYTES_EQUAL, "value"));
+    req.extra_conditions.emplace_back(
+        condition("sort_key_2", dsn::apps::cas_check_type::CT_VALUE_NOT_EXIST, ""));
+
+    // all the checks passed
+    {
+        dsn::apps::check_and_mutate_response resp;
+        ASSERT_EQ(0, _write_impl->check_and_mutate(++decree, req, resp));
+        ASSERT_EQ(0, resp.error);
+        ASSERT_TRUE(exist(hash_key, 3));
+        ASSERT_TRUE(resp.check_value_returned);
+        ASSERT_TRUE(resp.check_value_exist);
+        ASSERT_EQ("value", resp.check_value.to_string());
+        ASSERT_EQ(2, resp.extra_check_values.size());
+        ASSERT_TRUE(resp.extra_check_values[0].exist);
+        ASSERT_EQ("value", resp.extra_check_values[0].value.to_string());
+        ASSERT_FALSE(resp.extra_check_values[1].exist);
+    }
+
+    // one of the checks failed
+    req.extra_conditions[1].check_type = dsn::apps::cas_check_type::CT_VALUE_EXIST;
+    req.mutate_list[0].sort_key = dsn::blob::create_from_bytes("sort_key_4");
+    {
+        dsn::apps::check_and_mutate_response resp;
+        ASSERT_EQ(0, _write_impl->check_and_mutate(++decree, req, resp));
+        ASSERT_EQ(rocksdb::Status::kTryAgain, resp.error);
+        ASSERT_FALSE(exist(hash_key, 4));
+        ASSERT_EQ(2, resp.extra_check_values.size());
+    }
+
+    // the check type of an extra condition is not supported
+    req.extra_conditions[1].check_type = static_cast<dsn::apps::cas_check_type::type>(100);
+    {
+        dsn::apps::check_and_mutate_response resp;
+        ASSERT_EQ(0, _write_impl->check_and_mutate(++decree, req, resp));
+        ASSERT_EQ(rocksdb::Status::kInvalidArgument, resp.error);
+        ASSERT_FALSE(exist(hash_key, 4));
+    }
+}
+
 } // namespace server
 } // namespace pegasus
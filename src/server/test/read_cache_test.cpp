@@ -0,0 +1,84 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/read_cache.h"
+
+#include <gtest/gtest.h>
+
+using pegasus::server::read_cache;
+
+TEST(read_cache_test, get_and_put)
+{
+    read_cache cache(1024 * 1024);
+    dsn::blob value;
+    ASSERT_FALSE(cache.get("k1", 100, value));
+
+    ASSERT_EQ(0, cache.put("k1", "v1", 0, 100, cache.version()));
+    ASSERT_TRUE(cache.get("k1", 100, value));
+    ASSERT_EQ("v1", value.to_string());
+
+    // overwrite
+    ASSERT_EQ(0, cache.put("k1", "v2", 0, 100, cache.version()));
+    ASSERT_TRUE(cache.get("k1", 100, value));
+    ASSERT_EQ("v2", value.to_string());
+    ASSERT_EQ(1, cache.count());
+}
+
+TEST(read_cache_test, expire)
+{
+    read_cache cache(1024 * 1024);
+    dsn::blob value;
+    cache.put("k1", "v1", 200, 100, cache.version());
+    ASSERT_TRUE(cache.get("k1", 199, value));
+    ASSERT_FALSE(cache.get("k1", 200, value));
+    ASSERT_EQ(0, cache.count());
+
+    // records without ttl expire with the default ttl
+    cache.set_default_ttl(50);
+    cache.put("k2", "v2", 0, 100, cache.version());
+    ASSERT_TRUE(cache.get("k2", 149, value));
+    ASSERT_FALSE(cache.get("k2", 150, value));
+}
+
+TEST(read_cache_test, invalidate)
+{
+    read_cache cache(1024 * 1024);
+    dsn::blob value;
+    cache.put("k1", "v1", 0, 100, cache.version());
+    cache.put("k2", "v2", 0, 100, cache.version());
+
+    // a read started before the write must not fill the cache
+    uint64_t version = cache.version();
+    cache.invalidate("k1");
+    ASSERT_FALSE(cache.get("k1", 100, value));
+    ASSERT_TRUE(cache.get("k2", 100, value));
+    ASSERT_EQ(0, cache.put("k1", "v1", 0, 100, version));
+    ASSERT_FALSE(cache.get("k1", 100, value));
+
+    cache.clear();
+    ASSERT_EQ(0, cache.count());
+}
+
+TEST(read_cache_test, evict)
+{
+    read_cache cache(16 * 1024);
+    std::string large_value(2048, 'x');
+    dsn::blob value;
+    // the value is too large to be cached
+    ASSERT_EQ(0, cache.put("k0", large_value, 0, 100, cache.version()));
+    ASSERT_FALSE(cache.get("k0", 100, value));
+
+    std::string small_value(256, 'x');
+    int evicted = 0;
+    for (int i = 0; i < 100; ++i) {
+        evicted += cache.put("k" + std::to_string(i), small_value, 0, 100, cache.version());
+        // keep k1 hot
+        cache.get("k1", 100, value);
+    }
+    ASSERT_GT(evicted, 0);
+    ASSERT_EQ(100, cache.count() + evicted);
+    ASSERT_TRUE(cache.get("k1", 100, value));
+    ASSERT_FALSE(cache.get("k2", 100, value));
+    ASSERT_TRUE(cache.get("k99", 100, value));
+}
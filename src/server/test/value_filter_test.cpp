@@ -0,0 +1,95 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/value_filter.h"
+
+#include <gtest/gtest.h>
+
+using pegasus::server::value_filter;
+using ::dsn::apps::cas_check_type;
+
+TEST(value_filter_test, init)
+{
+    value_filter filter;
+    std::string err;
+    ASSERT_TRUE(filter.init(cas_check_type::CT_NO_CHECK, dsn::blob(), 0, 0, err));
+    ASSERT_FALSE(filter.has_predicate());
+    ASSERT_TRUE(filter.init(cas_check_type::CT_VALUE_EXIST, dsn::blob(), 0, 0, err));
+    ASSERT_FALSE(filter.has_predicate());
+
+    ASSERT_FALSE(filter.init(cas_check_type::CT_VALUE_NOT_EXIST, dsn::blob(), 0, 0, err));
+    ASSERT_FALSE(filter.init(cas_check_type::CT_VALUE_NOT_EXIST_OR_EMPTY, dsn::blob(), 0, 0, err));
+    ASSERT_FALSE(filter.init(static_cast<cas_check_type::type>(100), dsn::blob(), 0, 0, err));
+    ASSERT_FALSE(filter.init(
+        cas_check_type::CT_VALUE_INT_LESS, dsn::blob::create_from_bytes("a"), 0, 0, err));
+    ASSERT_FALSE(filter.init(cas_check_type::CT_NO_CHECK, dsn::blob(), -1, 0, err));
+}
+
+TEST(value_filter_test, match)
+{
+    struct test_case
+    {
+        cas_check_type::type type;
+        std::string operand;
+        std::string value;
+        bool expect_match;
+    } tests[] = {
+        {cas_check_type::CT_VALUE_NOT_EMPTY, "", "", false},
+        {cas_check_type::CT_VALUE_NOT_EMPTY, "", "a", true},
+        {cas_check_type::CT_VALUE_MATCH_ANYWHERE, "bc", "abcd", true},
+        {cas_check_type::CT_VALUE_MATCH_ANYWHERE, "bd", "abcd", false},
+        {cas_check_type::CT_VALUE_MATCH_PREFIX, "ab", "abcd", true},
+        {cas_check_type::CT_VALUE_MATCH_PREFIX, "bc", "abcd", false},
+        {cas_check_type::CT_VALUE_MATCH_POSTFIX, "cd", "abcd", true},
+        {cas_check_type::CT_VALUE_MATCH_POSTFIX, "abcde", "abcd", false},
+        {cas_check_type::CT_VALUE_MATCH_POSTFIX, "", "", true},
+        {cas_check_type::CT_VALUE_BYTES_LESS, "b", "a", true},
+        {cas_check_type::CT_VALUE_BYTES_LESS, "b", "b", false},
+        {cas_check_type::CT_VALUE_BYTES_EQUAL, "b", "b", true},
+        {cas_check_type::CT_VALUE_BYTES_LESS_OR_EQUAL, "b", "c", false},
+        {cas_check_type::CT_VALUE_BYTES_GREATER_OR_EQUAL, "b", "c", true},
+        {cas_check_type::CT_VALUE_INT_LESS, "10", "9", true},
+        {cas_check_type::CT_VALUE_INT_LESS_OR_EQUAL, "10", "10", true},
+        {cas_check_type::CT_VALUE_INT_EQUAL, "10", "9", false},
+        {cas_check_type::CT_VALUE_INT_GREATER_OR_EQUAL, "10", "10", true},
+        {cas_check_type::CT_VALUE_INT_GREATER, "10", "10", false},
+        {cas_check_type::CT_VALUE_INT_GREATER, "10", "11", true},
+        {cas_check_type::CT_VALUE_INT_GREATER, "10", "abc", false},
+    };
+    for (const auto &test : tests) {
+        value_filter filter;
+        std::string err;
+        ASSERT_TRUE(filter.init(
+            test.type, dsn::blob::create_from_bytes(std::string(test.operand)), 0, 0, err));
+        ASSERT_TRUE(filter.has_predicate());
+        ASSERT_EQ(test.expect_match, filter.match(test.value))
+            << test.type << " " << test.operand << " " << test.value;
+    }
+}
+
+TEST(value_filter_test, project)
+{
+    struct test_case
+    {
+        int32_t offset;
+        int32_t length;
+        std::string value;
+        std::string expect;
+    } tests[] = {
+        {0, 0, "abcd", "abcd"},
+        {1, 0, "abcd", "bcd"},
+        {1, 2, "abcd", "bc"},
+        {2, 10, "abcd", "cd"},
+        {4, 1, "abcd", ""},
+        {10, 0, "abcd", ""},
+        {0, -1, "abcd", "abcd"},
+    };
+    for (const auto &test : tests) {
+        value_filter filter;
+        std::string err;
+        ASSERT_TRUE(filter.init(
+            cas_check_type::CT_NO_CHECK, dsn::blob(), test.offset, test.length, err));
+        ASSERT_EQ(test.expect, std::string(filter.project(test.value)));
+    }
+}
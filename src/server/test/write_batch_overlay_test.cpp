@@ -0,0 +1,119 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "server/write_batch_overlay.h"
+
+#include <gtest/gtest.h>
+
+using pegasus::server::write_batch_overlay;
+
+TEST(write_batch_overlay_test, lookup)
+{
+    rocksdb::WriteBatch batch;
+    write_batch_overlay overlay({0});
+    ASSERT_EQ(nullptr, overlay.lookup(batch, 0, "k1"));
+
+    batch.Put("k1", "v1");
+    batch.Put("k2", "v2");
+    const write_batch_overlay::record *r = overlay.lookup(batch, 0, "k1");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::PUT, r->type);
+    ASSERT_EQ("v1", r->value);
+    ASSERT_EQ(nullptr, overlay.lookup(batch, 0, "k3"));
+
+    // the records added after the last lookup are indexed incrementally
+    batch.Put("k1", "v1_new");
+    batch.Delete("k2");
+    r = overlay.lookup(batch, 0, "k1");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::PUT, r->type);
+    ASSERT_EQ("v1_new", r->value);
+    r = overlay.lookup(batch, 0, "k2");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::DELETE, r->type);
+
+    batch.Clear();
+    overlay.clear();
+    ASSERT_EQ(nullptr, overlay.lookup(batch, 0, "k1"));
+    batch.Put("k2", "v2");
+    r = overlay.lookup(batch, 0, "k2");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::PUT, r->type);
+    ASSERT_EQ("v2", r->value);
+    ASSERT_EQ(nullptr, overlay.lookup(batch, 0, "k1"));
+}
+
+TEST(write_batch_overlay_test, merge)
+{
+    rocksdb::WriteBatch batch;
+    write_batch_overlay overlay({0});
+
+    batch.Merge("k1", "op1");
+    batch.Put("k2", "v2");
+    batch.Merge("k2", "op2");
+    batch.Delete("k3");
+    batch.Merge("k3", "op3");
+
+    const write_batch_overlay::record *r = overlay.lookup(batch, 0, "k1");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::MERGE, r->type);
+    ASSERT_FALSE(r->has_base_value);
+    ASSERT_FALSE(r->base_deleted);
+    ASSERT_EQ(std::vector<std::string>({"op1"}), r->merge_operands);
+
+    r = overlay.lookup(batch, 0, "k2");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::MERGE, r->type);
+    ASSERT_TRUE(r->has_base_value);
+    ASSERT_EQ("v2", r->value);
+    ASSERT_EQ(std::vector<std::string>({"op2"}), r->merge_operands);
+
+    r = overlay.lookup(batch, 0, "k3");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::MERGE, r->type);
+    ASSERT_TRUE(r->base_deleted);
+    ASSERT_EQ(std::vector<std::string>({"op3"}), r->merge_operands);
+
+    // a put overwrites the merge operands
+    batch.Merge("k1", "op4");
+    batch.Put("k1", "v1");
+    r = overlay.lookup(batch, 0, "k1");
+    ASSERT_NE(nullptr, r);
+    ASSERT_EQ(write_batch_overlay::record_type::PUT, r->type);
+    ASSERT_EQ("v1", r->value);
+    ASSERT_TRUE(r->merge_operands.empty());
+}
+
+TEST(write_batch_overlay_test, other_column_families)
+{
+    rocksdb::WriteBatch batch;
+    // only column family 1 is indexed
+    write_batch_overlay overlay({1});
+    batch.Put("k1", "v1");
+    batch.DeleteRange("k1", "k2");
+    ASSERT_EQ(nullptr, overlay.lookup(batch, 0, "k1"));
+    ASSERT_EQ(nullptr, overlay.lookup(batch, 1, "k1"));
+}
+
+TEST(write_batch_overlay_test, lookup_after_each_write)
+{
+    rocksdb::WriteBatch batch;
+    write_batch_overlay overlay({0});
+    for (int i = 0; i < 1000; ++i) {
+        // each lookup decodes only the write appended just before it
+        std::string key = "k" + std::to_string(i % 10);
+        std::string value = "v" + std::to_string(i);
+        batch.Put(key, value);
+        const write_batch_overlay::record *r = overlay.lookup(batch, 0, key);
+        ASSERT_NE(nullptr, r);
+        ASSERT_EQ(write_batch_overlay::record_type::PUT, r->type);
+        ASSERT_EQ(value, r->value);
+    }
+    for (int i = 0; i < 10; ++i) {
+        const write_batch_overlay::record *r =
+            overlay.lookup(batch, 0, "k" + std::to_string(i));
+        ASSERT_NE(nullptr, r);
+        ASSERT_EQ("v" + std::to_string(990 + i), r->value);
+    }
+}
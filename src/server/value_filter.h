@@ -0,0 +1,202 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <string.h>
+#include <string>
+#include <dsn/c/api_utilities.h>
+#include <dsn/utility/blob.h>
+#include <dsn/utility/string_conv.h>
+#include <dsn/utility/string_view.h>
+#include <rrdb/rrdb_types.h>
+
+namespace pegasus {
+namespace server {
+
+// How a pattern matches a value, shared by the filter types of the keys and the check types of
+// the values.
+enum class pattern_match_type
+{
+    ANYWHERE,
+    PREFIX,
+    POSTFIX
+};
+
+inline pattern_match_type to_pattern_match_type(::dsn::apps::filter_type::type type)
+{
+    switch (type) {
+    case ::dsn::apps::filter_type::FT_MATCH_ANYWHERE:
+        return pattern_match_type::ANYWHERE;
+    case ::dsn::apps::filter_type::FT_MATCH_PREFIX:
+        return pattern_match_type::PREFIX;
+    case ::dsn::apps::filter_type::FT_MATCH_POSTFIX:
+        return pattern_match_type::POSTFIX;
+    default:
+        dassert(false, "not a match filter type: %d", type);
+    }
+    return pattern_match_type::ANYWHERE;
+}
+
+inline pattern_match_type to_pattern_match_type(::dsn::apps::cas_check_type::type type)
+{
+    switch (type) {
+    case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_ANYWHERE:
+        return pattern_match_type::ANYWHERE;
+    case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_PREFIX:
+        return pattern_match_type::PREFIX;
+    case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_POSTFIX:
+        return pattern_match_type::POSTFIX;
+    default:
+        dassert(false, "not a match check type: %d", type);
+    }
+    return pattern_match_type::ANYWHERE;
+}
+
+// returns true if `pattern` matches `value`, an empty pattern matches any value.
+inline bool match_pattern(pattern_match_type type, dsn::string_view value, dsn::string_view pattern)
+{
+    if (pattern.length() == 0)
+        return true;
+    if (value.length() < pattern.length())
+        return false;
+    switch (type) {
+    case pattern_match_type::ANYWHERE:
+        return value.find(pattern) != dsn::string_view::npos;
+    case pattern_match_type::PREFIX:
+        return ::memcmp(value.data(), pattern.data(), pattern.length()) == 0;
+    case pattern_match_type::POSTFIX:
+        return ::memcmp(value.data() + value.length() - pattern.length(),
+                        pattern.data(),
+                        pattern.length()) == 0;
+    }
+    return false;
+}
+
+// returns true if the result of comparing the value with the operand, which is negative, 0 or
+// positive, passes the bytes or int compare check type.
+inline bool match_compare_result(::dsn::apps::cas_check_type::type type, int c)
+{
+    // the compare types are ordered as less, less or equal, equal, greater or equal, greater
+    int op = type >= ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS
+                 ? type - ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS
+                 : type - ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS;
+    if (c < 0) {
+        return op <= 1;
+    } else if (c == 0) {
+        return op >= 1 && op <= 3;
+    } else { // c > 0
+        return op >= 3;
+    }
+}
+
+// value_filter is the value predicate and projection of multi_get and scan, which are applied
+// on the replica before the response is serialized, so that only the needed bytes of the
+// matched values are sent back.
+//
+// The predicate reuses the check types of check_and_set, except the ones on the absence of
+// value, which never pass for an existing record.
+class value_filter
+{
+public:
+    value_filter() = default;
+
+    // returns false and sets `err` if the arguments are invalid.
+    bool init(::dsn::apps::cas_check_type::type type,
+              const ::dsn::blob &operand,
+              int32_t offset,
+              int32_t length,
+              std::string &err)
+    {
+        if (type == ::dsn::apps::cas_check_type::CT_VALUE_NOT_EXIST ||
+            type == ::dsn::apps::cas_check_type::CT_VALUE_NOT_EXIST_OR_EMPTY ||
+            type < ::dsn::apps::cas_check_type::CT_NO_CHECK ||
+            type > ::dsn::apps::cas_check_type::CT_VALUE_INT_GREATER) {
+            err = "value filter type " + std::to_string(type) + " not supported";
+            return false;
+        }
+        if (type >= ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS &&
+            !dsn::buf2int64(operand, _operand_int)) {
+            err = "value filter operand is not an integer or out of range";
+            return false;
+        }
+        if (offset < 0) {
+            err = "value offset " + std::to_string(offset) + " is negative";
+            return false;
+        }
+
+        // every record exists
+        _type = type == ::dsn::apps::cas_check_type::CT_VALUE_EXIST
+                    ? ::dsn::apps::cas_check_type::CT_NO_CHECK
+                    : type;
+        _operand.assign(operand.data(), operand.length());
+        _offset = offset;
+        _length = length;
+        return true;
+    }
+
+    // the value has to be read for the predicate even if the request is `no_value`
+    bool has_predicate() const { return _type != ::dsn::apps::cas_check_type::CT_NO_CHECK; }
+
+    // returns true if the user data passes the predicate.
+    // for int compare, the value which is not a valid integer doesn't pass.
+    bool match(dsn::string_view value) const
+    {
+        switch (_type) {
+        case ::dsn::apps::cas_check_type::CT_NO_CHECK:
+            return true;
+        case ::dsn::apps::cas_check_type::CT_VALUE_NOT_EMPTY:
+            return value.length() != 0;
+        case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_ANYWHERE:
+        case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_PREFIX:
+        case ::dsn::apps::cas_check_type::CT_VALUE_MATCH_POSTFIX:
+            return match_pattern(to_pattern_match_type(_type), value, _operand);
+        case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS:
+        case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_LESS_OR_EQUAL:
+        case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_EQUAL:
+        case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_GREATER_OR_EQUAL:
+        case ::dsn::apps::cas_check_type::CT_VALUE_BYTES_GREATER:
+            return match_compare_result(_type, value.compare(dsn::string_view(_operand)));
+        case ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS:
+        case ::dsn::apps::cas_check_type::CT_VALUE_INT_LESS_OR_EQUAL:
+        case ::dsn::apps::cas_check_type::CT_VALUE_INT_EQUAL:
+        case ::dsn::apps::cas_check_type::CT_VALUE_INT_GREATER_OR_EQUAL:
+        case ::dsn::apps::cas_check_type::CT_VALUE_INT_GREATER: {
+            int64_t value_int;
+            if (!dsn::buf2int64(value, value_int)) {
+                return false;
+            }
+            return match_compare_result(_type,
+                                        (value_int > _operand_int) - (value_int < _operand_int));
+        }
+        default:
+            dassert(false, "unsupported value filter type: %d", _type);
+        }
+        return false;
+    }
+
+    // returns the bytes of value in [offset, offset + length), which may be shorter or empty
+    // if the value is not long enough.
+    dsn::string_view project(dsn::string_view value) const
+    {
+        if (_offset >= value.length()) {
+            return dsn::string_view();
+        }
+        value.remove_prefix(_offset);
+        if (_length > 0 && static_cast<size_t>(_length) < value.length()) {
+            value.remove_suffix(value.length() - _length);
+        }
+        return value;
+    }
+
+private:
+    ::dsn::apps::cas_check_type::type _type{::dsn::apps::cas_check_type::CT_NO_CHECK};
+    std::string _operand;
+    int64_t _operand_int{0};
+    uint32_t _offset{0};
+    int32_t _length{0}; // <= 0 means to the end of value
+};
+
+} // namespace server
+} // namespace pegasus
@@ -0,0 +1,184 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <rocksdb/slice.h>
+#include <rocksdb/write_batch.h>
+
+#include <dsn/c/api_utilities.h>
+
+namespace pegasus {
+namespace server {
+
+// write_batch_overlay indexes the records of a plain rocksdb::WriteBatch by key, so that the
+// read-modify-write operations can read the writes added earlier in the same batch.
+//
+// The batch is only indexed when it is looked up, and only the records appended since the last
+// lookup are decoded, so a batch is decoded once however many times it's looked up, and the
+// writes which are not followed by any read-modify-write operation cost nothing more than
+// appending to the WriteBatch.
+//
+// Only the records of the column families given to the constructor are indexed, and range
+// deletions are not supported, since DELETE_RANGE is never batched with the other writes.
+class write_batch_overlay : private rocksdb::WriteBatch::Handler
+{
+public:
+    enum class record_type
+    {
+        NOT_IN_BATCH,
+        PUT,
+        DELETE,
+        // only merge operands are added, on top of the record in the db.
+        MERGE,
+    };
+
+    struct record
+    {
+        record_type type{record_type::NOT_IN_BATCH};
+        // the value of PUT, or the base value of the merge operands if `has_base_value`.
+        std::string value;
+        // whether the merge operands are added on top of a PUT (`value`) or a DELETE.
+        bool base_deleted{false};
+        bool has_base_value{false};
+        // the merge operands in the order they are added.
+        std::vector<std::string> merge_operands;
+    };
+
+    explicit write_batch_overlay(std::vector<uint32_t> cf_ids) : _cf_ids(std::move(cf_ids))
+    {
+        _records.resize(_cf_ids.size());
+    }
+
+    // Returns the latest record of `key` of column family `cf_id` in `batch`, nullptr if the key
+    // is not written in the batch. The returned record is valid until the next lookup or clear.
+    const record *
+    lookup(const rocksdb::WriteBatch &batch, uint32_t cf_id, const rocksdb::Slice &key)
+    {
+        size_t index = cf_index(cf_id);
+        if (batch.Count() == 0 || index == _cf_ids.size()) {
+            return nullptr;
+        }
+        if (_indexed_count < static_cast<size_t>(batch.Count())) {
+            index_appended(batch);
+        }
+
+        auto &records = _records[index];
+        auto iter = records.find(std::string(key.data(), key.size()));
+        return iter == records.end() ? nullptr : &iter->second;
+    }
+
+    // Forgets all the records, should be called once the batch is cleared.
+    void clear()
+    {
+        for (auto &records : _records) {
+            records.clear();
+        }
+        _indexed_count = 0;
+        _indexed_size = BATCH_HEADER_SIZE;
+    }
+
+private:
+    // the header of the representation of a WriteBatch: sequence (fixed64) and count (fixed32)
+    static const size_t BATCH_HEADER_SIZE = 12;
+
+    // Indexes the records appended since the last lookup, which follow the first
+    // `_indexed_size` bytes of the representation of `batch`, by iterating a batch of them.
+    void index_appended(const rocksdb::WriteBatch &batch)
+    {
+        const std::string &data = batch.Data();
+        uint32_t count = static_cast<uint32_t>(batch.Count() - _indexed_count);
+        std::string appended(BATCH_HEADER_SIZE, '\0');
+        // the count is encoded in little endian
+        for (size_t i = 0; i < sizeof(count); ++i) {
+            appended[BATCH_HEADER_SIZE - sizeof(count) + i] = static_cast<char>(count >> (8 * i));
+        }
+        appended.append(data, _indexed_size, std::string::npos);
+
+        rocksdb::Status s = rocksdb::WriteBatch(std::move(appended)).Iterate(this);
+        dassert(s.ok(), "iterate write batch failed: %s", s.ToString().c_str());
+        _indexed_count = static_cast<size_t>(batch.Count());
+        _indexed_size = data.size();
+    }
+
+    rocksdb::Status
+    PutCF(uint32_t cf_id, const rocksdb::Slice &key, const rocksdb::Slice &value) override
+    {
+        record *r = next_record(cf_id, key);
+        if (r != nullptr) {
+            r->type = record_type::PUT;
+            r->value.assign(value.data(), value.size());
+            r->merge_operands.clear();
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status DeleteCF(uint32_t cf_id, const rocksdb::Slice &key) override
+    {
+        record *r = next_record(cf_id, key);
+        if (r != nullptr) {
+            r->type = record_type::DELETE;
+            r->value.clear();
+            r->merge_operands.clear();
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status
+    MergeCF(uint32_t cf_id, const rocksdb::Slice &key, const rocksdb::Slice &value) override
+    {
+        record *r = next_record(cf_id, key);
+        if (r != nullptr) {
+            if (r->type != record_type::MERGE) {
+                r->has_base_value = r->type == record_type::PUT;
+                r->base_deleted = r->type == record_type::DELETE;
+                r->type = record_type::MERGE;
+            }
+            r->merge_operands.emplace_back(value.data(), value.size());
+        }
+        return rocksdb::Status::OK();
+    }
+
+    rocksdb::Status
+    DeleteRangeCF(uint32_t cf_id, const rocksdb::Slice &, const rocksdb::Slice &) override
+    {
+        if (cf_index(cf_id) != _cf_ids.size()) {
+            return rocksdb::Status::NotSupported("range deletion is not indexed");
+        }
+        return rocksdb::Status::OK();
+    }
+
+    // Returns the record to update by the next entry of the batch, or nullptr if its column
+    // family is not indexed.
+    record *next_record(uint32_t cf_id, const rocksdb::Slice &key)
+    {
+        size_t index = cf_index(cf_id);
+        if (index == _cf_ids.size()) {
+            return nullptr;
+        }
+        return &_records[index][std::string(key.data(), key.size())];
+    }
+
+    size_t cf_index(uint32_t cf_id) const
+    {
+        size_t i = 0;
+        while (i < _cf_ids.size() && _cf_ids[i] != cf_id) {
+            ++i;
+        }
+        return i;
+    }
+
+    const std::vector<uint32_t> _cf_ids;
+    std::vector<std::unordered_map<std::string, record>> _records;
+    // count of the entries of the batch which are indexed
+    size_t _indexed_count{0};
+    // size of the representation of the batch which is indexed, including the header
+    size_t _indexed_size{BATCH_HEADER_SIZE};
+};
+
+} // namespace server
+} // namespace pegasus
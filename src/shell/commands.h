@@ -245,3 +245,9 @@ bool pause_dup(command_executor *e, shell_context *sc, arguments args);
 bool query_disk_capacity(command_executor *e, shell_context *sc, arguments args);
 
 bool query_disk_replica(command_executor *e, shell_context *sc, arguments args);
+
+// == bulk load (see 'commands/bulk_load.cpp') == //
+
+bool generate_sst(command_executor *e, shell_context *sc, arguments args);
+
+bool ingest_sst(command_executor *e, shell_context *sc, arguments args);
@@ -0,0 +1,552 @@
+// Copyright (c) 2017, Xiaomi, Inc.  All rights reserved.
+// This source code is licensed under the Apache License Version 2.0, which
+// can be found in the LICENSE file in the root directory of this source tree.
+
+#include "shell/commands.h"
+#include "base/pegasus_bulk_load.h"
+#include "server/expire_stats_collector.h"
+#include "server/hashkey_stats_collector.h"
+
+#include <queue>
+#include <rocksdb/sst_file_reader.h>
+#include <rocksdb/sst_file_writer.h>
+
+namespace {
+
+typedef std::pair<std::string, std::string> record;
+
+// the records of a partition buffered in memory, which are sorted and spilled into a run file
+// when the buffer is full. the runs are merged into the final sst files at the end.
+struct partition_records
+{
+    std::vector<record> records;
+    // the spilled run files, in the order they are generated
+    std::vector<std::string> runs;
+};
+
+// the options of the sst files, which have the same table properties collectors as the data
+// column family of the server, so that the ingested files have the statistics of the others.
+rocksdb::Options sst_file_options(uint64_t hashkey_stats_min_count)
+{
+    rocksdb::Options options;
+    if (hashkey_stats_min_count > 0) {
+        options.table_properties_collector_factories.emplace_back(
+            std::make_shared<pegasus::server::HashkeyStatsCollectorFactory>(
+                hashkey_stats_min_count));
+    }
+    options.table_properties_collector_factories.emplace_back(
+        std::make_shared<pegasus::server::ExpireStatsCollectorFactory>());
+    return options;
+}
+
+std::string spill_dir(const std::string &output_dir)
+{
+    return dsn::utils::filesystem::path_combine(output_dir, "spill");
+}
+
+// sort the records by key, and of the same keys, keep only the latter one in the input
+void sort_records(std::vector<record> &records)
+{
+    std::stable_sort(records.begin(), records.end(), [](const record &l, const record &r) {
+        return l.first < r.first;
+    });
+    size_t count = 0;
+    for (size_t i = 0; i < records.size(); ++i) {
+        if (i + 1 < records.size() && records[i].first == records[i + 1].first) {
+            continue;
+        }
+        if (count != i) {
+            records[count] = std::move(records[i]);
+        }
+        count++;
+    }
+    records.resize(count);
+}
+
+// writes the sorted records of a partition into the sst files of about `target_file_size`
+// bytes, so the key ranges of the files don't overlap.
+class sst_files_writer
+{
+public:
+    sst_files_writer(const std::string &output_dir,
+                     const rocksdb::Options &options,
+                     int partition_index,
+                     uint64_t target_file_size)
+        : _output_dir(output_dir),
+          _options(options),
+          _partition_index(partition_index),
+          _target_file_size(target_file_size)
+    {
+    }
+
+    bool put(const rocksdb::Slice &key, const rocksdb::Slice &value)
+    {
+        if (_writer == nullptr && !open_next_file()) {
+            return false;
+        }
+        rocksdb::Status s = _writer->Put(key, value);
+        if (!s.ok()) {
+            fprintf(stderr,
+                    "ERROR: write sst file %s failed: %s\n",
+                    _file.c_str(),
+                    s.ToString().c_str());
+            return false;
+        }
+        _written_count++;
+        if (_writer->FileSize() >= _target_file_size) {
+            return finish();
+        }
+        return true;
+    }
+
+    // finish the current file
+    bool finish()
+    {
+        if (_writer == nullptr) {
+            return true;
+        }
+        rocksdb::Status s = _writer->Finish();
+        _writer.reset();
+        if (!s.ok()) {
+            fprintf(stderr,
+                    "ERROR: finish sst file %s failed: %s\n",
+                    _file.c_str(),
+                    s.ToString().c_str());
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t written_count() const { return _written_count; }
+
+private:
+    bool open_next_file()
+    {
+        std::string pdir = pegasus::bulk_load_info::partition_dir(_output_dir, _partition_index);
+        if (!dsn::utils::filesystem::create_directory(pdir)) {
+            fprintf(stderr, "ERROR: create directory %s failed\n", pdir.c_str());
+            return false;
+        }
+        _file = pegasus::bulk_load_info::sst_file(_output_dir, _partition_index, _file_count++);
+        _writer.reset(new rocksdb::SstFileWriter(rocksdb::EnvOptions(), _options));
+        rocksdb::Status s = _writer->Open(_file);
+        if (!s.ok()) {
+            fprintf(stderr,
+                    "ERROR: open sst file %s failed: %s\n",
+                    _file.c_str(),
+                    s.ToString().c_str());
+            _writer.reset();
+            return false;
+        }
+        return true;
+    }
+
+    const std::string &_output_dir;
+    const rocksdb::Options &_options;
+    const int _partition_index;
+    const uint64_t _target_file_size;
+    std::unique_ptr<rocksdb::SstFileWriter> _writer;
+    std::string _file;
+    int _file_count{0};
+    uint64_t _written_count{0};
+};
+
+// sort the buffered records of a partition and spill them into a new run file
+bool spill_records(const std::string &output_dir,
+                   const rocksdb::Options &options,
+                   int partition_index,
+                   partition_records &p)
+{
+    if (p.records.empty()) {
+        return true;
+    }
+    sort_records(p.records);
+
+    std::string dir = spill_dir(output_dir);
+    if (!dsn::utils::filesystem::create_directory(dir)) {
+        fprintf(stderr, "ERROR: create directory %s failed\n", dir.c_str());
+        return false;
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "%d_%08d.sst", partition_index, static_cast<int>(p.runs.size()));
+    std::string file = dsn::utils::filesystem::path_combine(dir, name);
+    rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), options);
+    rocksdb::Status s = writer.Open(file);
+    for (size_t i = 0; s.ok() && i < p.records.size(); ++i) {
+        s = writer.Put(p.records[i].first, p.records[i].second);
+    }
+    if (s.ok()) {
+        s = writer.Finish();
+    }
+    if (!s.ok()) {
+        fprintf(
+            stderr, "ERROR: write run file %s failed: %s\n", file.c_str(), s.ToString().c_str());
+        return false;
+    }
+    p.runs.emplace_back(std::move(file));
+
+    p.records.clear();
+    p.records.shrink_to_fit();
+    return true;
+}
+
+// merge the sorted run files into `out`, and of the same keys, the one in the latest run wins
+bool merge_runs(const std::vector<std::string> &runs,
+                const rocksdb::Options &options,
+                sst_files_writer &out)
+{
+    std::vector<std::unique_ptr<rocksdb::SstFileReader>> readers;
+    // the iterators are released before the readers
+    std::vector<std::unique_ptr<rocksdb::Iterator>> iters;
+    for (const std::string &run : runs) {
+        readers.emplace_back(new rocksdb::SstFileReader(options));
+        rocksdb::Status s = readers.back()->Open(run);
+        if (!s.ok()) {
+            fprintf(
+                stderr, "ERROR: open run file %s failed: %s\n", run.c_str(), s.ToString().c_str());
+            return false;
+        }
+        iters.emplace_back(readers.back()->NewIterator(rocksdb::ReadOptions()));
+        iters.back()->SeekToFirst();
+    }
+
+    // the top is the run of the smallest key, and of the same keys, the latest run
+    auto greater = [&iters](size_t l, size_t r) {
+        int c = iters[l]->key().compare(iters[r]->key());
+        return c > 0 || (c == 0 && l < r);
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> heap(greater);
+    for (size_t i = 0; i < iters.size(); ++i) {
+        if (iters[i]->Valid()) {
+            heap.push(i);
+        }
+    }
+    std::string last_key;
+    bool has_last_key = false;
+    while (!heap.empty()) {
+        size_t i = heap.top();
+        heap.pop();
+        rocksdb::Iterator *it = iters[i].get();
+        if (!has_last_key || it->key() != rocksdb::Slice(last_key)) {
+            if (!out.put(it->key(), it->value())) {
+                return false;
+            }
+            last_key.assign(it->key().data(), it->key().size());
+            has_last_key = true;
+        }
+        it->Next();
+        if (it->Valid()) {
+            heap.push(i);
+        }
+    }
+    for (size_t i = 0; i < iters.size(); ++i) {
+        if (!iters[i]->status().ok()) {
+            fprintf(stderr,
+                    "ERROR: read run file %s failed: %s\n",
+                    runs[i].c_str(),
+                    iters[i]->status().ToString().c_str());
+            return false;
+        }
+    }
+    return out.finish();
+}
+
+// write the records of a partition into the final sst files, by merging the spilled runs with
+// the buffered records if there are any runs.
+bool write_partition(const std::string &output_dir,
+                     const rocksdb::Options &options,
+                     int partition_index,
+                     uint64_t target_file_size,
+                     partition_records &p,
+                     uint64_t &written_count)
+{
+    sst_files_writer out(output_dir, options, partition_index, target_file_size);
+    if (p.runs.empty()) {
+        sort_records(p.records);
+        for (const record &r : p.records) {
+            if (!out.put(r.first, r.second)) {
+                return false;
+            }
+        }
+        if (!out.finish()) {
+            return false;
+        }
+        p.records.clear();
+        p.records.shrink_to_fit();
+    } else {
+        if (!spill_records(output_dir, options, partition_index, p) ||
+            !merge_runs(p.runs, options, out)) {
+            return false;
+        }
+        for (const std::string &run : p.runs) {
+            dsn::utils::filesystem::remove_path(run);
+        }
+        p.runs.clear();
+    }
+    written_count += out.written_count();
+    return true;
+}
+
+} // anonymous namespace
+
+bool generate_sst(command_executor *e, shell_context *sc, arguments args)
+{
+    static struct option long_options[] = {{"input", required_argument, 0, 'i'},
+                                           {"output", required_argument, 0, 'o'},
+                                           {"partition_count", required_argument, 0, 'p'},
+                                           {"data_version", required_argument, 0, 'v'},
+                                           {"buffer_size_mb", required_argument, 0, 'b'},
+                                           {"hashkey_stats_min_count", required_argument, 0, 'm'},
+                                           {"target_file_size_mb", required_argument, 0, 'f'},
+                                           {0, 0, 0, 0}};
+
+    std::string input;
+    std::string output;
+    int32_t partition_count = 0;
+    int32_t data_version = pegasus::PEGASUS_DATA_VERSION_MAX;
+    int64_t buffer_size_mb = 1024;
+    // the same as `rocksdb_hashkey_stats_min_count` of the server by default
+    int64_t hashkey_stats_min_count = 1000;
+    int64_t target_file_size_mb = 256;
+    optind = 0;
+    while (true) {
+        int option_index = 0;
+        int c;
+        c = getopt_long(args.argc, args.argv, "i:o:p:v:b:m:f:", long_options, &option_index);
+        if (c == -1)
+            break;
+        switch (c) {
+        case 'i':
+            input = optarg;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        case 'p':
+            if (!dsn::buf2int32(optarg, partition_count) || partition_count <= 0) {
+                fprintf(stderr, "ERROR: invalid partition_count param: %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'v':
+            if (!dsn::buf2int32(optarg, data_version) || data_version < 0 ||
+                data_version > pegasus::PEGASUS_DATA_VERSION_MAX) {
+                fprintf(stderr, "ERROR: invalid data_version param: %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'b':
+            if (!dsn::buf2int64(optarg, buffer_size_mb) || buffer_size_mb <= 0) {
+                fprintf(stderr, "ERROR: invalid buffer_size_mb param: %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'm':
+            if (!dsn::buf2int64(optarg, hashkey_stats_min_count) || hashkey_stats_min_count < 0) {
+                fprintf(stderr, "ERROR: invalid hashkey_stats_min_count param: %s\n", optarg);
+                return false;
+            }
+            break;
+        case 'f':
+            if (!dsn::buf2int64(optarg, target_file_size_mb) || target_file_size_mb <= 0) {
+                fprintf(stderr, "ERROR: invalid target_file_size_mb param: %s\n", optarg);
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    if (input.empty() || output.empty() || partition_count == 0) {
+        fprintf(stderr, "ERROR: input, output and partition_count should be specified\n");
+        return false;
+    }
+
+    std::ifstream in(input);
+    if (!in.is_open()) {
+        fprintf(stderr, "ERROR: open input file %s failed\n", input.c_str());
+        return true;
+    }
+    if (dsn::utils::filesystem::path_exists(pegasus::bulk_load_info::info_file(output))) {
+        fprintf(stderr, "ERROR: output %s is already a bulk load directory\n", output.c_str());
+        return true;
+    }
+    if (!dsn::utils::filesystem::create_directory(output)) {
+        fprintf(stderr, "ERROR: create directory %s failed\n", output.c_str());
+        return true;
+    }
+
+    // the timetag of all the records, the cluster id of which is unknown offline
+    uint64_t timetag = pegasus::generate_timetag(dsn_now_us(), 0, false);
+    // the records expire after ttl_seconds since now, rather than since they are ingested
+    uint32_t epoch_now = pegasus::utils::epoch_now();
+    rocksdb::Options options = sst_file_options(static_cast<uint64_t>(hashkey_stats_min_count));
+    pegasus::pegasus_value_generator value_generator;
+    std::vector<partition_records> partitions(partition_count);
+    uint64_t buffer_size = 0;
+    uint64_t line_count = 0;
+    uint64_t written_count = 0;
+    std::string line;
+    std::vector<std::string> fields;
+    std::string hash_key, sort_key, value;
+    while (std::getline(in, line)) {
+        line_count++;
+        if (line.empty()) {
+            continue;
+        }
+        // hash_key \t sort_key \t ttl_seconds \t value, where the strings are escaped
+        fields.clear();
+        boost::split(fields, line, boost::is_any_of("\t"));
+        int32_t ttl_seconds = 0;
+        if (fields.size() != 4 || pegasus::utils::c_unescape_string(fields[0], hash_key) < 0 ||
+            pegasus::utils::c_unescape_string(fields[1], sort_key) < 0 ||
+            !dsn::buf2int32(fields[2], ttl_seconds) || ttl_seconds < 0 ||
+            pegasus::utils::c_unescape_string(fields[3], value) < 0) {
+            fprintf(stderr, "ERROR: invalid record at line %" PRIu64 "\n", line_count);
+            return true;
+        }
+
+        dsn::blob key;
+        pegasus::pegasus_generate_key(key, hash_key, sort_key);
+        int pidx = static_cast<int>(pegasus::pegasus_key_hash(key) % partition_count);
+        uint32_t expire_ts = ttl_seconds == 0 ? 0 : epoch_now + ttl_seconds;
+        rocksdb::SliceParts parts =
+            value_generator.generate_value(data_version, value, expire_ts, timetag);
+        std::string raw_value;
+        for (int i = 0; i < parts.num_parts; ++i) {
+            raw_value.append(parts.parts[i].data(), parts.parts[i].size());
+        }
+        buffer_size += key.length() + raw_value.size();
+        partitions[pidx].records.emplace_back(key.to_string(), std::move(raw_value));
+
+        if (buffer_size >= buffer_size_mb << 20) {
+            for (int i = 0; i < partition_count; ++i) {
+                if (!spill_records(output, options, i, partitions[i])) {
+                    return true;
+                }
+            }
+            buffer_size = 0;
+            fprintf(stderr, "INFO: processed %" PRIu64 " lines\n", line_count);
+        }
+    }
+    // each partition gets the sst files of non-overlapping key ranges, which are ingested by
+    // the server at once without overlapping the others in level 0
+    for (int i = 0; i < partition_count; ++i) {
+        if (!write_partition(output,
+                             options,
+                             i,
+                             static_cast<uint64_t>(target_file_size_mb) << 20,
+                             partitions[i],
+                             written_count)) {
+            return true;
+        }
+    }
+    dsn::utils::filesystem::remove_path(spill_dir(output));
+
+    pegasus::bulk_load_info info;
+    info.partition_count = partition_count;
+    info.data_version = static_cast<uint32_t>(data_version);
+    if (!info.save(output)) {
+        fprintf(stderr, "ERROR: write bulk load info into %s failed\n", output.c_str());
+        return true;
+    }
+    fprintf(stderr,
+            "OK: generated %" PRIu64 " records from %" PRIu64 " lines into %s\n",
+            written_count,
+            line_count,
+            output.c_str());
+    return true;
+}
+
+bool ingest_sst(command_executor *e, shell_context *sc, arguments args)
+{
+    static struct option long_options[] = {{"input", required_argument, 0, 'i'},
+                                           {"partition", required_argument, 0, 'p'},
+                                           {"timeout_ms", required_argument, 0, 't'},
+                                           {0, 0, 0, 0}};
+
+    std::string input;
+    int32_t partition = -1;
+    int timeout_ms = 600000;
+    optind = 0;
+    while (true) {
+        int option_index = 0;
+        int c;
+        c = getopt_long(args.argc, args.argv, "i:p:t:", long_options, &option_index);
+        if (c == -1)
+            break;
+        switch (c) {
+        case 'i':
+            input = optarg;
+            break;
+        case 'p':
+            if (!dsn::buf2int32(optarg, partition) || partition < 0) {
+                fprintf(stderr, "ERROR: invalid partition param: %s\n", optarg);
+                return false;
+            }
+            break;
+        case 't':
+            if (!dsn::buf2int32(optarg, timeout_ms) || timeout_ms <= 0) {
+                fprintf(stderr, "ERROR: invalid timeout_ms param: %s\n", optarg);
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+    }
+    if (input.empty()) {
+        fprintf(stderr, "ERROR: input is not specified\n");
+        return false;
+    }
+
+    pegasus::bulk_load_info info;
+    if (!info.load(input)) {
+        fprintf(stderr, "ERROR: load bulk load info from %s failed\n", input.c_str());
+        return true;
+    }
+
+    int32_t app_id = 0;
+    int32_t partition_count = 0;
+    std::vector<::dsn::partition_configuration> partitions;
+    ::dsn::error_code err =
+        sc->ddl_client->list_app(sc->current_app_name, app_id, partition_count, partitions);
+    if (err != ::dsn::ERR_OK) {
+        fprintf(stderr,
+                "ERROR: list app %s failed: %s\n",
+                sc->current_app_name.c_str(),
+                err.to_string());
+        return true;
+    }
+    if (info.partition_count != partition_count) {
+        fprintf(stderr,
+                "ERROR: partition count %d of %s mismatches %d of app %s\n",
+                info.partition_count,
+                input.c_str(),
+                partition_count,
+                sc->current_app_name.c_str());
+        return true;
+    }
+    if (partition >= partition_count) {
+        fprintf(stderr, "ERROR: invalid partition param: %d\n", partition);
+        return true;
+    }
+
+    for (int i = 0; i < partition_count; i++) {
+        if (partition != -1 && i != partition)
+            continue;
+        pegasus::pegasus_client::internal_info ingest_info;
+        int ret = sc->pg_client->ingest_partition(i, input, timeout_ms, &ingest_info);
+        if (ret != pegasus::PERR_OK) {
+            fprintf(stderr,
+                    "ERROR: ingest partition %d failed: %s {server=%s}\n",
+                    i,
+                    sc->pg_client->get_error_string(ret),
+                    ingest_info.server.c_str());
+            return true;
+        }
+        fprintf(stderr, "INFO: ingest partition %d succeed\n", i);
+    }
+    fprintf(stderr, "OK\n");
+    return true;
+}
@@ -40,7 +40,8 @@ bool data_operations(command_executor *e, shell_context *sc, arguments args)
         {"full_scan", full_scan},
         {"copy_data", copy_data},
         {"clear_data", clear_data},
-        {"count_data", count_data}};
+        {"count_data", count_data},
+        {"ingest_sst", ingest_sst}};
 
     if (args.argc <= 0) {
         return false;
@@ -514,6 +515,32 @@ bool multi_del_range(command_executor *e, shell_context *sc, arguments args)
     fprintf(stderr, "silent: %s\n", silent ? "true" : "false");
     fprintf(stderr, "\n");
 
+    if (options.sort_key_filter_type == pegasus::pegasus_client::FT_NO_FILTER) {
+        // the whole range is deleted on the server by one range deletion, without scanning
+        pegasus::pegasus_client::internal_info del_info;
+        int del_ret = sc->pg_client->delete_range(hash_key,
+                                                  start_sort_key,
+                                                  stop_sort_key,
+                                                  options.start_inclusive,
+                                                  options.stop_inclusive,
+                                                  sc->timeout_ms,
+                                                  &del_info);
+        if (file != stderr) {
+            fclose(file);
+        }
+        if (del_ret != pegasus::PERR_OK) {
+            fprintf(stderr,
+                    "ERROR: delete range failed: %s {app_id=%d, partition_index=%d, server=%s}\n",
+                    sc->pg_client->get_error_string(del_ret),
+                    del_info.app_id,
+                    del_info.partition_index,
+                    del_info.server.c_str());
+        } else {
+            fprintf(stderr, "OK, range deleted.\n");
+        }
+        return true;
+    }
+
     int count = 0;
     bool error_occured = false;
     pegasus::pegasus_client::pegasus_scanner *scanner = nullptr;
@@ -1003,14 +1030,23 @@ bool exist(command_executor *e, shell_context *sc, arguments args)
 
 bool sortkey_count(command_executor *e, shell_context *sc, arguments args)
 {
-    if (args.argc != 2) {
+    if (args.argc != 2 && args.argc != 3) {
         return false;
     }
 
+    bool approximate = false;
+    if (args.argc == 3) {
+        std::string opt = sds_to_string(args.argv[2]);
+        if (opt != "-a" && opt != "--approximate") {
+            return false;
+        }
+        approximate = true;
+    }
+
     std::string hash_key = sds_to_string(args.argv[1]);
     int64_t count;
     pegasus::pegasus_client::internal_info info;
-    int ret = sc->pg_client->sortkey_count(hash_key, count, sc->timeout_ms, &info);
+    int ret = sc->pg_client->sortkey_count(hash_key, count, sc->timeout_ms, &info, approximate);
     if (ret != pegasus::PERR_OK) {
         fprintf(stderr, "ERROR: %s\n", sc->pg_client->get_error_string(ret));
     } else {
@@ -1716,6 +1752,7 @@ bool copy_data(command_executor *e, shell_context *sc, arguments args)
 
     std::vector<pegasus::pegasus_client::pegasus_scanner *> raw_scanners;
     options.timeout_ms = timeout_ms;
+    options.bulk_scan = true;
     if (sort_key_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
         if (sort_key_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
             options.sort_key_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
@@ -1968,8 +2005,47 @@ bool clear_data(command_executor *e, shell_context *sc, arguments args)
         return false;
     }
 
+    if (options.hash_key_filter_type == pegasus::pegasus_client::FT_NO_FILTER &&
+        sort_key_filter_type == pegasus::pegasus_client::FT_NO_FILTER &&
+        value_filter_type == pegasus::pegasus_client::FT_NO_FILTER) {
+        // clear the partitions on the server by range deletions, without scanning
+        std::vector<pegasus::pegasus_client::pegasus_scanner *> raw_scanners;
+        int ret = sc->pg_client->get_unordered_scanners(INT_MAX, options, raw_scanners);
+        if (ret != pegasus::PERR_OK) {
+            fprintf(stderr,
+                    "ERROR: query partition count failed: %s\n",
+                    sc->pg_client->get_error_string(ret));
+            return true;
+        }
+        int partition_count = raw_scanners.size();
+        for (auto p : raw_scanners)
+            delete p;
+        if (partition >= partition_count) {
+            fprintf(stderr, "ERROR: invalid partition param: %d\n", partition);
+            return true;
+        }
+        for (int i = 0; i < partition_count; i++) {
+            if (partition != -1 && i != partition)
+                continue;
+            pegasus::pegasus_client::internal_info info;
+            ret = sc->pg_client->clear_partition(i, timeout_ms, &info);
+            if (ret != pegasus::PERR_OK) {
+                fprintf(stderr,
+                        "ERROR: clear partition %d failed: %s {server=%s}\n",
+                        i,
+                        sc->pg_client->get_error_string(ret),
+                        info.server.c_str());
+                return true;
+            }
+            fprintf(stderr, "INFO: clear partition %d succeed\n", i);
+        }
+        fprintf(stderr, "OK\n");
+        return true;
+    }
+
     std::vector<pegasus::pegasus_client::pegasus_scanner *> raw_scanners;
     options.timeout_ms = timeout_ms;
+    options.bulk_scan = true;
     if (sort_key_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
         if (sort_key_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
             options.sort_key_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
@@ -2251,6 +2327,7 @@ bool count_data(command_executor *e, shell_context *sc, arguments args)
 
     std::vector<pegasus::pegasus_client::pegasus_scanner *> raw_scanners;
     options.timeout_ms = timeout_ms;
+    options.bulk_scan = true;
     if (sort_key_filter_type != pegasus::pegasus_client::FT_NO_FILTER) {
         if (sort_key_filter_type == pegasus::pegasus_client::FT_MATCH_EXACT)
             options.sort_key_filter_type = pegasus::pegasus_client::FT_MATCH_PREFIX;
@@ -121,6 +121,28 @@ bool mlog_dump(command_executor *e, shell_context *sc, arguments args)
                            << "\" : \"" << pegasus::utils::c_escape_string(sort_key, sc->escape_all)
                            << "\"" << std::endl;
                     }
+                } else if (msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_DELETE_RANGE) {
+                    ::dsn::apps::delete_range_request update;
+                    ::dsn::unmarshall(request, update);
+                    if (update.clear_partition) {
+                        os << INDENT << "[DELETE_RANGE] partition " << update.partition_index
+                           << std::endl;
+                    } else {
+                        os << INDENT << "[DELETE_RANGE] \""
+                           << pegasus::utils::c_escape_string(update.hash_key, sc->escape_all)
+                           << "\" : " << (update.start_inclusive ? "[" : "(") << "\""
+                           << pegasus::utils::c_escape_string(update.start_sort_key,
+                                                              sc->escape_all)
+                           << "\", \""
+                           << pegasus::utils::c_escape_string(update.stop_sort_key,
+                                                              sc->escape_all)
+                           << "\"" << (update.stop_inclusive ? "]" : ")") << std::endl;
+                    }
+                } else if (msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_INGEST) {
+                    ::dsn::apps::ingest_request update;
+                    ::dsn::unmarshall(request, update);
+                    os << INDENT << "[INGEST] partition " << update.partition_index << " from \""
+                       << update.dir << "\"" << std::endl;
                 } else if (msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_INCR) {
                     ::dsn::apps::incr_request update;
                     ::dsn::unmarshall(request, update);
@@ -130,7 +152,8 @@ bool mlog_dump(command_executor *e, shell_context *sc, arguments args)
                        << pegasus::utils::c_escape_string(hash_key, sc->escape_all) << "\" : \""
                        << pegasus::utils::c_escape_string(sort_key, sc->escape_all) << "\" => "
                        << update.increment << std::endl;
-                } else if (msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET) {
+                } else if (msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET ||
+                           msg->local_rpc_code == ::dsn::apps::RPC_RRDB_RRDB_CHECK_AND_SET_V2) {
                     dsn::apps::check_and_set_request update;
                     dsn::unmarshall(request, update);
                     auto set_sort_key =
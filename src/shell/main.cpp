@@ -219,7 +219,10 @@ static command_executor commands[] = {
         "exist", "check value exist", "<hash_key> <sort_key>", data_operations,
     },
     {
-        "count", "get sort key count for a single hash key", "<hash_key>", data_operations,
+        "count",
+        "get sort key count for a single hash key",
+        "<hash_key> [-a|--approximate]",
+        data_operations,
     },
     {
         "ttl", "query ttl for a specific key", "<hash_key> <sort_key>", data_operations,
@@ -290,6 +293,23 @@ static command_executor commands[] = {
         "[-d|--diff_hash_key] [-a|--stat_size] [-n|--top_count num] [-r|--run_seconds num]",
         data_operations,
     },
+    {
+        "generate_sst",
+        "generate the sst files of bulk load from the records of "
+        "'hash_key<TAB>sort_key<TAB>ttl_seconds<TAB>value' per line, the records with "
+        "ttl_seconds expire after ttl_seconds since the files are generated, not ingested",
+        "<-i|--input file_name> <-o|--output dir> <-p|--partition_count num> "
+        "[-v|--data_version num] [-b|--buffer_size_mb num] [-m|--hashkey_stats_min_count num] "
+        "[-f|--target_file_size_mb num]",
+        generate_sst,
+    },
+    {
+        "ingest_sst",
+        "ingest the sst files of bulk load into app, the dir should be accessible from all the "
+        "replica servers",
+        "<-i|--input dir> [-p|--partition num] [-t|--timeout_ms num]",
+        data_operations,
+    },
     {
         "remote_command",
         "send remote command to servers",
@@ -1288,6 +1288,204 @@ TEST(basic, multi_set_get_del)
     ASSERT_EQ(0, count);
 }
 
+TEST(basic, batch_multi_get)
+{
+    // multi_set on several hash keys, which are located in different partitions
+    const int hash_key_count = 20;
+    std::map<std::string, std::string> kvs;
+    kvs["basic_test_sort_key_1"] = "basic_test_value_1";
+    kvs["basic_test_sort_key_2"] = "basic_test_value_2";
+    for (int i = 0; i < hash_key_count; i++) {
+        int ret = client->multi_set("basic_test_batch_hash_key_" + std::to_string(i), kvs);
+        ASSERT_EQ(PERR_OK, ret);
+    }
+
+    // batch_multi_get, the last hash key is not exist
+    std::vector<pegasus_client::batch_multi_get_item> items(hash_key_count + 1);
+    for (int i = 0; i <= hash_key_count; i++) {
+        items[i].hashkey = "basic_test_batch_hash_key_" + std::to_string(i);
+        if (i % 2 == 0) {
+            items[i].sortkeys.insert("basic_test_sort_key_1");
+            items[i].sortkeys.insert("basic_test_sort_key_3");
+        }
+    }
+    std::vector<pegasus_client::batch_multi_get_result> results;
+    int ret = client->batch_multi_get(items, results);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(hash_key_count + 1, results.size());
+    for (int i = 0; i < hash_key_count; i++) {
+        ASSERT_EQ(PERR_OK, results[i].error);
+        if (i % 2 == 0) {
+            ASSERT_EQ(1, results[i].values.size());
+            ASSERT_EQ("basic_test_value_1", results[i].values["basic_test_sort_key_1"]);
+        } else {
+            ASSERT_EQ(kvs, results[i].values);
+        }
+    }
+    ASSERT_EQ(PERR_OK, results[hash_key_count].error);
+    ASSERT_TRUE(results[hash_key_count].values.empty());
+
+    // batch_multi_get with limit count 1
+    ret = client->batch_multi_get(items, results, 1);
+    ASSERT_EQ(PERR_OK, ret);
+    for (int i = 1; i < hash_key_count; i += 2) {
+        ASSERT_EQ(PERR_INCOMPLETE, results[i].error);
+        ASSERT_EQ(1, results[i].values.size());
+    }
+
+    // invalid hash key
+    items.back().hashkey.clear();
+    ret = client->batch_multi_get(items, results);
+    ASSERT_EQ(PERR_INVALID_HASH_KEY, ret);
+
+    // del
+    for (int i = 0; i < hash_key_count; i++) {
+        int64_t deleted_count;
+        ret = client->multi_del("basic_test_batch_hash_key_" + std::to_string(i),
+                                {"basic_test_sort_key_1", "basic_test_sort_key_2"},
+                                deleted_count);
+        ASSERT_EQ(PERR_OK, ret);
+        ASSERT_EQ(2, deleted_count);
+    }
+}
+
+TEST(basic, batch_get_set_del)
+{
+    // batch_set on several hash keys, which are located in different partitions
+    const int hash_key_count = 20;
+    std::vector<pegasus_client::batch_set_item> items;
+    std::vector<pegasus_client::batch_key> keys;
+    for (int i = 0; i < hash_key_count; i++) {
+        std::string hash_key = "basic_test_batch_kv_hash_key_" + std::to_string(i);
+        for (int j = 0; j < 2; j++) {
+            std::string sort_key = "basic_test_sort_key_" + std::to_string(j);
+            // the items of the same hash key with different ttls
+            items.emplace_back(hash_key, sort_key, hash_key + sort_key, j * 1000);
+            keys.emplace_back(hash_key, sort_key);
+        }
+    }
+    std::vector<int> errors;
+    int ret = client->batch_set(items, errors);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(std::vector<int>(items.size(), PERR_OK), errors);
+
+    // batch_get, with a duplicate key and a not existing key
+    keys.push_back(keys.front());
+    keys.emplace_back("basic_test_batch_kv_hash_key_0", "basic_test_sort_key_2");
+    std::vector<pegasus_client::batch_get_result> results;
+    ret = client->batch_get(keys, results);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(keys.size(), results.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        ASSERT_EQ(PERR_OK, results[i].error);
+        ASSERT_EQ(items[i].value, results[i].value);
+    }
+    ASSERT_EQ(PERR_OK, results[items.size()].error);
+    ASSERT_EQ(items.front().value, results[items.size()].value);
+    ASSERT_EQ(PERR_NOT_FOUND, results.back().error);
+
+    // async_batch_get
+    std::atomic<bool> callbacked(false);
+    client->async_batch_get(keys,
+                            [&](int err, std::vector<pegasus_client::batch_get_result> &&r) {
+                                ASSERT_EQ(PERR_OK, err);
+                                ASSERT_EQ(keys.size(), r.size());
+                                ASSERT_EQ(items.back().value, r[items.size() - 1].value);
+                                callbacked.store(true, std::memory_order_seq_cst);
+                            });
+    while (!callbacked.load(std::memory_order_seq_cst))
+        usleep(100);
+
+    // invalid hash key
+    keys.emplace_back("", "basic_test_sort_key_0");
+    ret = client->batch_get(keys, results);
+    ASSERT_EQ(PERR_INVALID_HASH_KEY, ret);
+    ret = client->batch_del(keys, errors);
+    ASSERT_EQ(PERR_INVALID_HASH_KEY, ret);
+    keys.pop_back();
+
+    // batch_del
+    ret = client->batch_del(keys, errors);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(std::vector<int>(keys.size(), PERR_OK), errors);
+    ret = client->batch_get(keys, results);
+    ASSERT_EQ(PERR_OK, ret);
+    for (const auto &result : results) {
+        ASSERT_EQ(PERR_NOT_FOUND, result.error);
+    }
+}
+
+TEST(basic, multi_get_value_filter)
+{
+    std::map<std::string, std::string> kvs;
+    kvs["k1"] = "{\"id\":1,\"name\":\"a\"}";
+    kvs["k2"] = "{\"id\":2,\"name\":\"b\"}";
+    kvs["k3"] = "10";
+    kvs["k4"] = "20";
+    int ret = client->multi_set("basic_test_value_filter_hash_key", kvs);
+    ASSERT_EQ(PERR_OK, ret);
+
+    // filter by prefix and project the id field
+    pegasus_client::multi_get_options options;
+    options.value_filter_type = pegasus_client::CT_VALUE_MATCH_PREFIX;
+    options.value_filter_operand = "{";
+    options.value_offset = 6;
+    options.value_length = 1;
+    std::map<std::string, std::string> values;
+    ret = client->multi_get("basic_test_value_filter_hash_key", "", "", options, values);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(2, values.size());
+    ASSERT_EQ("1", values["k1"]);
+    ASSERT_EQ("2", values["k2"]);
+
+    // filter by int compare, the values which are not integers are filtered
+    options = pegasus_client::multi_get_options();
+    options.value_filter_type = pegasus_client::CT_VALUE_INT_GREATER;
+    options.value_filter_operand = "15";
+    ret = client->multi_get("basic_test_value_filter_hash_key", "", "", options, values);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(1, values.size());
+    ASSERT_EQ("20", values["k4"]);
+
+    // with no_value
+    options.no_value = true;
+    ret = client->multi_get("basic_test_value_filter_hash_key", "", "", options, values);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(1, values.size());
+    ASSERT_EQ("", values["k4"]);
+
+    // invalid operand
+    options.value_filter_operand = "abc";
+    ret = client->multi_get("basic_test_value_filter_hash_key", "", "", options, values);
+    ASSERT_EQ(PERR_INVALID_ARGUMENT, ret);
+
+    // scan with value filter and projection
+    pegasus_client::scan_options scan_options;
+    scan_options.value_filter_type = pegasus_client::CT_VALUE_MATCH_ANYWHERE;
+    scan_options.value_filter_operand = "\"b\"";
+    scan_options.value_offset = 6;
+    scan_options.value_length = 1;
+    pegasus_client::pegasus_scanner *scanner = nullptr;
+    ret = client->get_scanner("basic_test_value_filter_hash_key", "", "", scan_options, scanner);
+    ASSERT_EQ(PERR_OK, ret);
+    std::string hash_key, sort_key, value;
+    std::map<std::string, std::string> scanned;
+    while (PERR_OK == (ret = scanner->next(hash_key, sort_key, value))) {
+        scanned[sort_key] = value;
+    }
+    ASSERT_EQ(PERR_SCAN_COMPLETE, ret);
+    delete scanner;
+    ASSERT_EQ(1, scanned.size());
+    ASSERT_EQ("2", scanned["k2"]);
+
+    // del
+    int64_t deleted_count;
+    ret = client->multi_del(
+        "basic_test_value_filter_hash_key", {"k1", "k2", "k3", "k4"}, deleted_count);
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(4, deleted_count);
+}
+
 TEST(basic, set_get_del_async)
 {
     std::atomic<bool> callbacked(false);
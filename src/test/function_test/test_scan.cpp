@@ -7,14 +7,18 @@
 #include <vector>
 #include <map>
 
+#include <dsn/dist/replication/replication_ddl_client.h>
 #include <dsn/service_api_c.h>
 #include <unistd.h>
 #include <pegasus/client.h>
 #include <gtest/gtest.h>
 
+#include "global_env.h"
+
 using namespace ::pegasus;
 
 extern pegasus_client *client;
+extern std::shared_ptr<dsn::replication::replication_ddl_client> ddl_client;
 static const char CCH[] = "_0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
 static char buffer[256];
 static std::map<std::string, std::map<std::string, std::string>> base;
@@ -397,3 +401,196 @@ TEST_F(scan, OVERALL)
     }
     compare(data, base);
 }
+
+TEST_F(scan, OVERALL_PREFETCH)
+{
+    ddebug("TEST OVERALL_SCAN_PREFETCH...");
+    pegasus_client::scan_options options;
+    options.batch_size = 10;
+    options.prefetch_batch_count = 2;
+    std::vector<pegasus_client::pegasus_scanner *> scanners;
+    int ret = client->get_unordered_scanners(3, options, scanners);
+    ASSERT_EQ(0, ret) << "Error occurred when getting scanner. error="
+                      << client->get_error_string(ret);
+    ASSERT_LE(scanners.size(), 3);
+
+    std::string hash_key;
+    std::string sort_key;
+    std::string value;
+    std::map<std::string, std::map<std::string, std::string>> data;
+    for (auto scanner : scanners) {
+        ASSERT_NE(nullptr, scanner);
+        while (PERR_OK == (ret = (scanner->next(hash_key, sort_key, value)))) {
+            check_and_put(data, hash_key, sort_key, value);
+        }
+        ASSERT_EQ(PERR_SCAN_COMPLETE, ret) << "Error occurred when scan. error="
+                                           << client->get_error_string(ret);
+        delete scanner;
+    }
+    compare(data, base);
+
+    // the scanners are destroyed while prefetching
+    scanners.clear();
+    ret = client->get_unordered_scanners(3, options, scanners);
+    ASSERT_EQ(0, ret) << "Error occurred when getting scanner. error="
+                      << client->get_error_string(ret);
+    for (auto scanner : scanners) {
+        ASSERT_NE(nullptr, scanner);
+        ASSERT_EQ(PERR_OK, scanner->next(hash_key, sort_key, value));
+        delete scanner;
+    }
+}
+
+TEST_F(scan, OVERALL_NEXT_BATCH)
+{
+    ddebug("TEST OVERALL_SCAN_NEXT_BATCH...");
+    pegasus_client::scan_options options;
+    options.batch_size = 10;
+    std::vector<pegasus_client::pegasus_scanner *> scanners;
+    int ret = client->get_unordered_scanners(3, options, scanners);
+    ASSERT_EQ(0, ret) << "Error occurred when getting scanner. error="
+                      << client->get_error_string(ret);
+    ASSERT_LE(scanners.size(), 3);
+
+    std::map<std::string, std::map<std::string, std::string>> data;
+    std::vector<pegasus_client::kv_view> kvs;
+    for (auto scanner : scanners) {
+        ASSERT_NE(nullptr, scanner);
+        std::string hash_key, sort_key, value;
+        // mix next() and next_batch() in one scan
+        ret = scanner->next(hash_key, sort_key, value);
+        if (ret == PERR_OK) {
+            check_and_put(data, hash_key, sort_key, value);
+        }
+        while (ret == PERR_OK && PERR_OK == (ret = scanner->next_batch(kvs))) {
+            ASSERT_FALSE(kvs.empty());
+            for (const auto &kv : kvs) {
+                check_and_put(data,
+                              std::string(kv.hash_key, kv.hash_key_length),
+                              std::string(kv.sort_key, kv.sort_key_length),
+                              std::string(kv.value, kv.value_length));
+            }
+        }
+        ASSERT_EQ(PERR_SCAN_COMPLETE, ret) << "Error occurred when scan. error="
+                                           << client->get_error_string(ret);
+        ASSERT_TRUE(kvs.empty());
+        delete scanner;
+    }
+    compare(data, base);
+}
+
+TEST_F(scan, OVERALL_SPLIT)
+{
+    ddebug("TEST OVERALL_SCAN_SPLIT...");
+    pegasus_client::scan_options options;
+    options.split_count_per_partition = 4;
+    std::vector<pegasus_client::pegasus_scanner *> scanners;
+    int ret = client->get_unordered_scanners(100, options, scanners);
+    ASSERT_EQ(0, ret) << "Error occurred when getting scanner. error="
+                      << client->get_error_string(ret);
+    ASSERT_LE(scanners.size(), 100);
+
+    std::string hash_key;
+    std::string sort_key;
+    std::string value;
+    std::map<std::string, std::map<std::string, std::string>> data;
+    for (auto scanner : scanners) {
+        ASSERT_NE(nullptr, scanner);
+        while (PERR_OK == (ret = (scanner->next(hash_key, sort_key, value)))) {
+            check_and_put(data, hash_key, sort_key, value);
+        }
+        ASSERT_EQ(PERR_SCAN_COMPLETE, ret) << "Error occurred when scan. error="
+                                           << client->get_error_string(ret);
+        delete scanner;
+    }
+    compare(data, base);
+}
+
+TEST_F(scan, OVERALL_PARALLEL)
+{
+    ddebug("TEST OVERALL_PARALLEL_SCAN...");
+    pegasus_client::scan_options options;
+    options.batch_size = 10;
+    pegasus_client::parallel_scan_options parallel_options;
+    parallel_options.worker_count = 3;
+    parallel_options.max_scans_per_server = 1;
+
+    std::map<std::string, std::map<std::string, std::string>> data;
+    int ret = client->parallel_scan(
+        options, parallel_options, [&data](std::vector<pegasus_client::kv_view> &&kvs) {
+            EXPECT_FALSE(kvs.empty());
+            for (const auto &kv : kvs) {
+                check_and_put(data,
+                              std::string(kv.hash_key, kv.hash_key_length),
+                              std::string(kv.sort_key, kv.sort_key_length),
+                              std::string(kv.value, kv.value_length));
+            }
+            return true;
+        });
+    ASSERT_EQ(PERR_OK, ret) << "Error occurred when scan. error=" << client->get_error_string(ret);
+    compare(data, base);
+
+    // stop the scan by the consumer
+    int batch_count = 0;
+    ret = client->parallel_scan(options,
+                                parallel_options,
+                                [&batch_count](std::vector<pegasus_client::kv_view> &&kvs) {
+                                    return ++batch_count < 2;
+                                });
+    ASSERT_EQ(PERR_OK, ret);
+    ASSERT_EQ(2, batch_count);
+
+    parallel_options.worker_count = 0;
+    ret = client->parallel_scan(
+        options, parallel_options, [](std::vector<pegasus_client::kv_view> &&kvs) {
+            return true;
+        });
+    ASSERT_EQ(PERR_INVALID_ARGUMENT, ret);
+}
+
+TEST_F(scan, COPY_DATA_KEEPS_SOURCE)
+{
+    ddebug("TEST COPY_DATA_KEEPS_SOURCE...");
+    const std::string target_app_name = "copy_data_target";
+    dsn::error_code err = ddl_client->create_app(target_app_name, "pegasus", 4, 3, {}, false);
+    ASSERT_EQ(dsn::ERR_OK, err);
+
+    // copy the whole table without any filter by the shell
+    char command[1024];
+    snprintf(command,
+             sizeof(command),
+             "cd %s && printf 'use %s\\ncopy_data -c onebox -a %s\\n' | ./run.sh shell",
+             global_env::instance()._pegasus_root.c_str(),
+             client->get_app_name(),
+             target_app_name.c_str());
+    system(command);
+
+    // both the source and the target have all the data
+    pegasus_client *target_client =
+        pegasus_client_factory::get_client("mycluster", target_app_name.c_str());
+    for (pegasus_client *c : {client, target_client}) {
+        pegasus_client::scan_options options;
+        std::vector<pegasus_client::pegasus_scanner *> scanners;
+        int ret = c->get_unordered_scanners(3, options, scanners);
+        ASSERT_EQ(PERR_OK, ret) << "Error occurred when getting scanner. error="
+                                << c->get_error_string(ret);
+
+        std::string hash_key;
+        std::string sort_key;
+        std::string value;
+        std::map<std::string, std::map<std::string, std::string>> data;
+        for (auto scanner : scanners) {
+            ASSERT_NE(nullptr, scanner);
+            while (PERR_OK == (ret = (scanner->next(hash_key, sort_key, value)))) {
+                check_and_put(data, hash_key, sort_key, value);
+            }
+            ASSERT_EQ(PERR_SCAN_COMPLETE, ret) << "Error occurred when scan. error="
+                                               << c->get_error_string(ret);
+            delete scanner;
+        }
+        compare(data, base);
+    }
+
+    err = ddl_client->drop_app(target_app_name, 0);
+    ASSERT_EQ(dsn::ERR_OK, err);
+}